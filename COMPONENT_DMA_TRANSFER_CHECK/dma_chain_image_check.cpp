@@ -0,0 +1,112 @@
+/******************************************************************************
+* File Name:   dma_chain_image_check.cpp
+*
+* Description: Compile-time checks of dma_chain_image.hpp. Builds the demo chain of
+*              main.c as a register image in flash and arms it with plain stores.
+*              Built only with COMPONENTS+=DMA_TRANSFER_CHECK in the Makefile.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_chain_image.hpp"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Size of the demo regions defined in main.c */
+#define DMA_CHAIN_IMAGE_CHECK_SIZE      16U
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Demo regions of main.c */
+extern "C"
+{
+extern const uint8_t g_region1Src[DMA_CHAIN_IMAGE_CHECK_SIZE];
+extern uint8_t g_region1Dst[DMA_CHAIN_IMAGE_CHECK_SIZE];
+extern const uint8_t g_region2Src[DMA_CHAIN_IMAGE_CHECK_SIZE];
+extern uint8_t g_region2Dst[DMA_CHAIN_IMAGE_CHECK_SIZE];
+}
+
+/* The USER_DMA descriptors of the design: PING continues to PONG without a
+ * trigger, both wait for the trigger to be deactivated */
+static constexpr auto g_demoChain = dma::chain(
+    dma::copy(dma::memory(g_region1Src), dma::memory(g_region1Dst))
+        .trigger(CY_DMAC_DESCR_LIST).retrigger(CY_DMAC_WAIT_FOR_REACT),
+    dma::copy(dma::memory(g_region2Src), dma::memory(g_region2Dst))
+        .trigger(CY_DMAC_SINGLE_DESCR).retrigger(CY_DMAC_WAIT_FOR_REACT));
+
+static_assert(2U == g_demoChain.size, "PING and PONG");
+
+/* Each of these fails to compile, naming the broken rule:
+ *
+ *   .width(CY_DMAC_WORD_WORD) on byte arrays    chain_error::source_misaligned
+ *   .count(17UL) on 16-byte arrays              chain_error::source_out_of_bounds
+ *   CY_DMAC_DESCR_LIST on the last segment      chain_error::descriptor_list_at_end
+ *   byte array to a halfword array              chain_error::width_not_encodable
+ *   three segments                              static_assert
+ */
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+extern "C" void dma_chain_image_check_arm(void);
+
+/********************************************************************************
+* Function Name: dma_chain_image_check_arm
+*********************************************************************************
+* Summary:
+* Arms USER_DMA with the demo chain: eight stores from the image in flash
+* and the descriptor selection, in place of two Cy_DMAC_Descriptor_Init()
+* and four address calls.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_image_check_arm(void)
+{
+    g_demoChain.arm(USER_DMA_CHANNEL);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/******************************************************************************
+* File Name:   dma_transfer_check.cpp
+*
+* Description: Zero-overhead check of dma_transfer.hpp. Each function
+*              configures the same descriptor as its C reference in
+*              dma_transfer_check_ref.c, through dma::Transfer.
+*              tools/zero_overhead.py disassembles both object files and fails
+*              when a pair differs. Built only with
+*              COMPONENTS+=DMA_TRANSFER_CHECK in the Makefile.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_transfer.hpp"
+#include "dma_transfer_check.h"
+
+/********************************************************************************
+* Function Name: dma_transfer_check_configure_cpp
+*********************************************************************************
+* Summary:
+* Same descriptor as dma_transfer_check_configure_c() through
+* dma::Transfer::configure().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_en_dmac_status_t: Status of the descriptor initialization
+*
+********************************************************************************/
+cy_en_dmac_status_t dma_transfer_check_configure_cpp(void)
+{
+    return dma::make_transfer(g_checkSrc, g_checkDst)
+               .configure(USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, USER_DMA_ping_config);
+}
+
+/********************************************************************************
+* Function Name: dma_transfer_check_segment_cpp
+*********************************************************************************
+* Summary:
+* Same descriptor as dma_transfer_check_segment_c() through
+* dma::Transfer::segment().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_en_dmac_status_t: Status of the descriptor initialization
+*
+********************************************************************************/
+cy_en_dmac_status_t dma_transfer_check_segment_cpp(void)
+{
+    const dma_chain_segment_t segment =
+        dma::make_transfer(g_checkSrc, g_checkDst).segment(CY_DMAC_DESCR_LIST, true);
+
+    return dma_chain_config(USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &segment);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   dma_transfer_check.h
+*
+* Description: This file contains the declarations shared by the C reference
+*              functions in dma_transfer_check_ref.c and their C++
+*              counterparts in dma_transfer_check.cpp.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_TRANSFER_CHECK_H
+#define DMA_TRANSFER_CHECK_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_chain.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Number of words of the check buffers */
+#define DMA_TRANSFER_CHECK_COUNT        16UL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Buffers shared by both sides of each pair. They have external linkage, so
+ * both objects refer to them by name and the relocations compare equal. */
+extern const uint32_t g_checkSrc[DMA_TRANSFER_CHECK_COUNT];
+extern uint32_t g_checkDst[DMA_TRANSFER_CHECK_COUNT];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+cy_en_dmac_status_t dma_transfer_check_configure_c(void);
+cy_en_dmac_status_t dma_transfer_check_configure_cpp(void);
+cy_en_dmac_status_t dma_transfer_check_segment_c(void);
+cy_en_dmac_status_t dma_transfer_check_segment_cpp(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_TRANSFER_CHECK_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/******************************************************************************
+* File Name:   dma_transfer_check_ref.c
+*
+* Description: This file contains the C reference functions of the
+*              zero-overhead check of dma_transfer.hpp. They are compiled as C,
+*              with the C flags of the build, so the comparison is against the
+*              code an application written in C gets. Built only with
+*              COMPONENTS+=DMA_TRANSFER_CHECK in the Makefile.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_transfer_check.h"
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Buffers shared by both sides of each pair */
+const uint32_t g_checkSrc[DMA_TRANSFER_CHECK_COUNT] = { 0UL };
+uint32_t g_checkDst[DMA_TRANSFER_CHECK_COUNT];
+
+/********************************************************************************
+* Function Name: dma_transfer_check_configure_c
+*********************************************************************************
+* Summary:
+* Reference: configures PING for a word copy with the PDL calls, as main.c
+* configures the demo descriptors.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_en_dmac_status_t: Status of the descriptor initialization
+*
+********************************************************************************/
+cy_en_dmac_status_t dma_transfer_check_configure_c(void)
+{
+    cy_stc_dmac_descriptor_config_t config = USER_DMA_ping_config;
+    cy_en_dmac_status_t status;
+
+    config.dataCount         = DMA_TRANSFER_CHECK_COUNT;
+    config.dataTransferWidth = CY_DMAC_WORD_WORD;
+    config.srcAddrIncrement  = true;
+    config.dstAddrIncrement  = true;
+
+    status = Cy_DMAC_Descriptor_Init(USER_DMA_HW, USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &config);
+    if (CY_DMAC_SUCCESS == status)
+    {
+        Cy_DMAC_Descriptor_SetSrcAddress(USER_DMA_HW, USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, g_checkSrc);
+        Cy_DMAC_Descriptor_SetDstAddress(USER_DMA_HW, USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, g_checkDst);
+    }
+
+    return status;
+}
+
+/********************************************************************************
+* Function Name: dma_transfer_check_segment_c
+*********************************************************************************
+* Summary:
+* Reference: configures PONG for a word copy through dma_chain_config().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_en_dmac_status_t: Status of the descriptor initialization
+*
+********************************************************************************/
+cy_en_dmac_status_t dma_transfer_check_segment_c(void)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = g_checkSrc,
+        .dst          = g_checkDst,
+        .count        = DMA_TRANSFER_CHECK_COUNT,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_DESCR_LIST,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+
+    return dma_chain_config(USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &segment);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,476 @@
+/******************************************************************************
+* File Name:   dma_rtos.c
+*
+* Description: This file contains the FreeRTOS adapter. dma_rtos_wait() blocks
+*              the calling task on a direct-to-task notification that the
+*              channel callback gives from the DMAC interrupt, and measures the
+*              latency from that interrupt to the task running again. Each
+*              channel has a mutex; FreeRTOS mutexes raise the priority of the
+*              holder to that of the highest waiting task. Built only with
+*              COMPONENTS+=FREERTOS in the Makefile.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_rtos.h"
+#include "dma_benchmark.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+#if (configUSE_MUTEXES != 1)
+#error "dma_rtos.c requires configUSE_MUTEXES"
+#endif
+
+#if (DMA_RTOS_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES)
+#error "DMA_RTOS_NOTIFY_INDEX exceeds configTASK_NOTIFICATION_ARRAY_ENTRIES"
+#endif
+
+/* Transfers and bytes per transfer of the benchmark */
+#define DMA_RTOS_BENCHMARK_TRANSFERS    32UL
+#define DMA_RTOS_BENCHMARK_SIZE         256UL
+
+/* Channel of the benchmark */
+#define DMA_RTOS_BENCHMARK_CHANNEL      USER_DMA_CHANNEL
+
+/* Bound of one benchmark transfer */
+#define DMA_RTOS_BENCHMARK_TIMEOUT_MS   10UL
+
+/* Flash source of the benchmark, past the vector table */
+#define DMA_RTOS_BENCHMARK_SRC          (CY_FLASH_BASE + 0x100UL)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Task blocked in dma_rtos_wait() per channel, or NULL */
+static TaskHandle_t volatile g_rtosWaiters[DMA_CHAIN_CHANNELS];
+
+/* Timestamp of the last completion interrupt per channel */
+static volatile uint32_t g_rtosIsrStamps[DMA_CHAIN_CHANNELS];
+
+/* Channel mutexes */
+static SemaphoreHandle_t g_rtosMutexes[DMA_CHAIN_CHANNELS];
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+static StaticSemaphore_t g_rtosMutexBuffers[DMA_CHAIN_CHANNELS];
+#endif
+
+/* Wake latency statistics */
+static dma_rtos_latency_t g_rtosLatency;
+
+/* Benchmark destination */
+static CY_ALIGN(4) uint8_t g_rtosBuffer[DMA_RTOS_BENCHMARK_SIZE];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void dma_rtos_callback(uint32_t channel);
+static void dma_rtos_record_latency(uint32_t cycles);
+
+/********************************************************************************
+* Function Name: dma_rtos_init
+*********************************************************************************
+* Summary:
+* Creates the channel mutexes and clears the latency statistics. Call it once,
+* before the tasks that use the adapter run.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_rtos_init(void)
+{
+    uint32_t channel;
+
+    for (channel = 0UL; channel < DMA_CHAIN_CHANNELS; channel++)
+    {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        g_rtosMutexes[channel] = xSemaphoreCreateMutexStatic(&g_rtosMutexBuffers[channel]);
+#else
+        g_rtosMutexes[channel] = xSemaphoreCreateMutex();
+#endif
+        g_rtosWaiters[channel] = NULL;
+    }
+
+    dma_rtos_reset_latency();
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_attach
+*********************************************************************************
+* Summary:
+* Registers the adapter as the completion callback of a channel, replacing the
+* callback of any driver that used it. Descriptors configured with
+* interrupt = true then wake the task waiting on the channel.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_rtos_attach(uint32_t channel)
+{
+    g_rtosWaiters[channel] = NULL;
+    dma_chain_register_callback(channel, dma_rtos_callback);
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_lock
+*********************************************************************************
+* Summary:
+* Takes the mutex of a channel. While a lower-priority task holds it, that
+* task runs at the priority of the highest task waiting here, so a task of
+* middle priority cannot hold up the channel owner. Not callable from an
+* interrupt.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  timeoutTicks: Longest wait, or portMAX_DELAY
+*
+* Return:
+*  bool: true if the calling task now owns the channel
+*
+********************************************************************************/
+bool dma_rtos_lock(uint32_t channel, TickType_t timeoutTicks)
+{
+    return (pdTRUE == xSemaphoreTake(g_rtosMutexes[channel], timeoutTicks));
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_unlock
+*********************************************************************************
+* Summary:
+* Gives back the mutex of a channel taken with dma_rtos_lock().
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_rtos_unlock(uint32_t channel)
+{
+    (void) xSemaphoreGive(g_rtosMutexes[channel]);
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_wait
+*********************************************************************************
+* Summary:
+* Blocks the calling task until the descriptor has a response, for at most a
+* number of ticks. The descriptor must interrupt on completion and the channel
+* must be attached. A completion that arrives before the task blocks is seen
+* in the response; the notification it leaves behind only makes a later wait
+* check the response once more.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: CY_DMAC_DESCRIPTOR_PING or CY_DMAC_DESCRIPTOR_PONG
+*  timeoutTicks: Longest wait, or portMAX_DELAY
+*
+* Return:
+*  dma_chain_status_t: DMA_CHAIN_STATUS_DONE, the error of the descriptor or
+*                      DMA_CHAIN_STATUS_TIMEOUT
+*
+********************************************************************************/
+dma_chain_status_t dma_rtos_wait(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                 TickType_t timeoutTicks)
+{
+    TimeOut_t timeout;
+    TickType_t remaining = timeoutTicks;
+    cy_en_dmac_response_t response;
+    uint32_t wake;
+    bool notified;
+    bool expired = false;
+
+    g_rtosWaiters[channel] = xTaskGetCurrentTaskHandle();
+    vTaskSetTimeOutState(&timeout);
+
+    response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, descriptor);
+    while ((DMA_CHAIN_RESPONSE_PENDING == response) && !expired)
+    {
+        notified = (0UL != ulTaskNotifyTakeIndexed(DMA_RTOS_NOTIFY_INDEX, pdTRUE, remaining));
+        wake = DMA_RTOS_TIMESTAMP();
+
+        response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, descriptor);
+        if (DMA_CHAIN_RESPONSE_PENDING != response)
+        {
+            if (notified)
+            {
+                dma_rtos_record_latency(wake - g_rtosIsrStamps[channel]);
+            }
+            else
+            {
+                /* Completed as the wait timed out */
+            }
+        }
+        else
+        {
+            expired = (pdFALSE != xTaskCheckForTimeOut(&timeout, &remaining));
+        }
+    }
+
+    g_rtosWaiters[channel] = NULL;
+
+    return dma_chain_status(response);
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_get_latency
+*********************************************************************************
+* Summary:
+* Copies the wake latency statistics.
+*
+* Parameters:
+*  latency: Receives the statistics
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_rtos_get_latency(dma_rtos_latency_t *latency)
+{
+    taskENTER_CRITICAL();
+    *latency = g_rtosLatency;
+    taskEXIT_CRITICAL();
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_reset_latency
+*********************************************************************************
+* Summary:
+* Clears the wake latency statistics.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_rtos_reset_latency(void)
+{
+    taskENTER_CRITICAL();
+    g_rtosLatency.wakes       = 0UL;
+    g_rtosLatency.minCycles   = UINT32_MAX;
+    g_rtosLatency.maxCycles   = 0UL;
+    g_rtosLatency.totalCycles = 0UL;
+    taskEXIT_CRITICAL();
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_timestamp
+*********************************************************************************
+* Summary:
+* Returns the kernel tick count scaled to CPU cycles plus the cycles elapsed
+* in the current tick. Callable from tasks and interrupts. A tick interrupt
+* that is pending while the SysTick counter has already reloaded is counted.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Timestamp in CPU cycles, wrapping
+*
+********************************************************************************/
+uint32_t dma_rtos_timestamp(void)
+{
+    uint32_t period = SysTick->LOAD + 1UL;
+    uint32_t interruptState;
+    uint32_t ticks;
+    uint32_t count;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    count = SysTick->VAL;
+    ticks = (uint32_t) xTaskGetTickCountFromISR();
+    if ((0UL != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) && (count > (period >> 1U)))
+    {
+        ticks++;
+    }
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    return ((ticks * period) + (period - 1UL - count));
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_benchmark_run
+*********************************************************************************
+* Summary:
+* Copies DMA_RTOS_BENCHMARK_TRANSFERS blocks from flash to SRAM on the user
+* channel, blocking on each completion, and writes the wake latency as CSV.
+* Call it from a task after dma_rtos_init(). The user channel stays attached
+* to the adapter. UART_HW must be initialized.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_rtos_benchmark_run(void)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = (const void *) DMA_RTOS_BENCHMARK_SRC,
+        .dst          = g_rtosBuffer,
+        .count        = DMA_RTOS_BENCHMARK_SIZE / 4UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+    dma_rtos_latency_t latency;
+    uint32_t i;
+    bool ok = true;
+
+    dma_rtos_attach(DMA_RTOS_BENCHMARK_CHANNEL);
+    dma_rtos_reset_latency();
+
+    (void) dma_rtos_lock(DMA_RTOS_BENCHMARK_CHANNEL, portMAX_DELAY);
+    for (i = 0UL; i < DMA_RTOS_BENCHMARK_TRANSFERS; i++)
+    {
+        (void) dma_chain_config(DMA_RTOS_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+        dma_chain_start(DMA_RTOS_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        dma_chain_trigger();
+
+        ok = ok && (DMA_CHAIN_STATUS_DONE ==
+                    dma_rtos_wait(DMA_RTOS_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING,
+                                  pdMS_TO_TICKS(DMA_RTOS_BENCHMARK_TIMEOUT_MS)));
+    }
+    dma_rtos_unlock(DMA_RTOS_BENCHMARK_CHANNEL);
+
+    dma_rtos_get_latency(&latency);
+
+    dma_benchmark_csv_comment("dma_rtos");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("transfers");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("samples");
+    dma_benchmark_csv_str("min");
+    dma_benchmark_csv_str("mean");
+    dma_benchmark_csv_str("max");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    dma_benchmark_csv_begin("rtos_wake");
+    dma_benchmark_csv_u32(DMA_RTOS_BENCHMARK_TRANSFERS);
+    dma_benchmark_csv_u32(DMA_RTOS_BENCHMARK_SIZE);
+    dma_benchmark_csv_u32(latency.wakes);
+    dma_benchmark_csv_u32((0UL != latency.wakes) ? latency.minCycles : 0UL);
+    dma_benchmark_csv_u32((0UL != latency.wakes) ? (latency.totalCycles / latency.wakes) : 0UL);
+    dma_benchmark_csv_u32(latency.maxCycles);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_record_latency
+*********************************************************************************
+* Summary:
+* Adds one wake latency to the statistics.
+*
+* Parameters:
+*  cycles: Cycles from the completion interrupt to the woken task
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_rtos_record_latency(uint32_t cycles)
+{
+    taskENTER_CRITICAL();
+    g_rtosLatency.wakes++;
+    g_rtosLatency.totalCycles += cycles;
+    if (cycles < g_rtosLatency.minCycles)
+    {
+        g_rtosLatency.minCycles = cycles;
+    }
+    if (cycles > g_rtosLatency.maxCycles)
+    {
+        g_rtosLatency.maxCycles = cycles;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/********************************************************************************
+* Function Name: dma_rtos_callback
+*********************************************************************************
+* Summary:
+* Channel completion callback: stamps the completion and notifies the waiting
+* task, switching to it on return from the interrupt if it has a higher
+* priority than the interrupted task.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_rtos_callback(uint32_t channel)
+{
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    TaskHandle_t waiter = g_rtosWaiters[channel];
+
+    g_rtosIsrStamps[channel] = DMA_RTOS_TIMESTAMP();
+
+    if (NULL != waiter)
+    {
+        vTaskNotifyGiveIndexedFromISR(waiter, DMA_RTOS_NOTIFY_INDEX, &higherPriorityTaskWoken);
+    }
+    else
+    {
+        /* No task is waiting; the response holds the completion */
+    }
+
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+/* [] END OF FILE */
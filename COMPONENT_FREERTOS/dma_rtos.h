@@ -0,0 +1,111 @@
+/******************************************************************************
+* File Name:   dma_rtos.h
+*
+* Description: This file contains the declarations of the FreeRTOS adapter. A
+*              task blocks on a direct-to-task notification that the DMAC
+*              interrupt gives on completion, instead of polling the descriptor
+*              response. Built only with COMPONENTS+=FREERTOS in the Makefile.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_RTOS_H
+#define DMA_RTOS_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "dma_chain.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Notification index reserved for DMA completions. Other uses of the same
+ * index by a waiting task would end its wait early. */
+#ifndef DMA_RTOS_NOTIFY_INDEX
+#define DMA_RTOS_NOTIFY_INDEX           0U
+#endif
+
+/* Timestamp of the wake latency measurement, in CPU cycles. FreeRTOS owns
+ * SysTick, so the default combines the kernel tick count with the SysTick
+ * counter. Ports without SysTick, such as the POSIX port, override it. */
+#ifndef DMA_RTOS_TIMESTAMP
+#define DMA_RTOS_TIMESTAMP()            dma_rtos_timestamp()
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Cycles from the DMAC interrupt to the return of the woken task */
+typedef struct
+{
+    uint32_t wakes;                     /* Number of measured wakes */
+    uint32_t minCycles;                 /* Shortest latency */
+    uint32_t maxCycles;                 /* Longest latency */
+    uint32_t totalCycles;               /* Sum of the latencies */
+} dma_rtos_latency_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void dma_rtos_init(void);
+void dma_rtos_attach(uint32_t channel);
+bool dma_rtos_lock(uint32_t channel, TickType_t timeoutTicks);
+void dma_rtos_unlock(uint32_t channel);
+dma_chain_status_t dma_rtos_wait(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                 TickType_t timeoutTicks);
+void dma_rtos_get_latency(dma_rtos_latency_t *latency);
+void dma_rtos_reset_latency(void);
+uint32_t dma_rtos_timestamp(void);
+void dma_rtos_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_RTOS_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,479 @@
+/******************************************************************************
+* File Name:   baud_tune.c
+*
+* Description: This file contains the runtime UART baud rate tuning. After the
+*              BAUD_TUNE_COMMAND character, the device prompts with "BAUD?" and
+*              the host sends the requested rate as decimal digits and CR. The
+*              device finds the closest divider and oversampling, answers
+*              "BAUD <rate>" at the old rate and switches.
+*              The host then sends the test pattern at the new rate, the device
+*              echoes it, and the host confirms with 'K'. Without a confirmation
+*              within BAUD_TUNE_TIMEOUT_MS, both sides return to the old rate.
+*
+*              While a tuned rate is active, baud_tune_poll() counts frame and
+*              parity errors and falls back to the default rate when they exceed
+*              BAUD_TUNE_ERROR_LIMIT per window. See tools/baud_tune.py.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "baud_tune.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+#include "uart_fmt.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Largest division of a 16-bit integer divider */
+#define BAUD_TUNE_DIVIDER_MAX           65536UL
+
+/* Characters of the requested rate */
+#define BAUD_TUNE_RATE_DIGITS           8UL
+
+/* Confirmation of the host */
+#define BAUD_TUNE_CONFIRM               'K'
+
+/* Receive errors counted by the fallback */
+#define BAUD_TUNE_RX_ERRORS             (CY_SCB_UART_RX_ERR_FRAME | CY_SCB_UART_RX_ERR_PARITY)
+
+/* Test pattern: byte i is i * BAUD_TUNE_PATTERN_STEP + BAUD_TUNE_PATTERN_SEED,
+ * covering alternating and long runs of equal bits */
+#define BAUD_TUNE_PATTERN_STEP          37U
+#define BAUD_TUNE_PATTERN_SEED          0x55U
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Setting of the design */
+static const baud_tune_setting_t g_baudTuneDefault =
+{
+    .divider    = BAUD_TUNE_DEFAULT_DIVIDER,
+    .oversample = BAUD_TUNE_DEFAULT_OVERSAMPLE,
+    .baudRate   = BAUD_TUNE_DEFAULT_BAUD_RATE
+};
+
+/* Active setting */
+static baud_tune_setting_t g_baudTuneActive =
+{
+    .divider    = BAUD_TUNE_DEFAULT_DIVIDER,
+    .oversample = BAUD_TUNE_DEFAULT_OVERSAMPLE,
+    .baudRate   = BAUD_TUNE_DEFAULT_BAUD_RATE
+};
+
+/* A setting other than the default is active */
+static bool g_baudTuneTuned = false;
+
+/* Error monitor of the fallback */
+static uint32_t g_baudTuneErrors = 0UL;
+static uint32_t g_baudTuneWindowStart = 0UL;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static bool baud_tune_get(uint32_t *data, uint32_t timeout);
+static bool baud_tune_read_rate(uint32_t *baudRate);
+static bool baud_tune_check_pattern(void);
+static void baud_tune_wait_tx(void);
+
+/********************************************************************************
+* Function Name: baud_tune_find
+*********************************************************************************
+* Summary:
+* Finds the integer divider and oversampling closest to a baud rate. Higher
+* oversampling is preferred when the error is equal.
+*
+* Parameters:
+*  baudRate: Requested baud rate
+*  setting: Returns the setting
+*
+* Return:
+*  bool: true if the error is within BAUD_TUNE_MAX_ERROR_PPM
+*
+********************************************************************************/
+bool baud_tune_find(uint32_t baudRate, baud_tune_setting_t *setting)
+{
+    uint32_t clock = Cy_SysClk_ClkPeriGetFrequency();
+    uint32_t bestError = UINT32_MAX;
+    uint32_t oversample;
+    uint32_t divider;
+    uint32_t actual;
+    uint32_t error;
+
+    if (0UL == baudRate)
+    {
+        return false;
+    }
+
+    for (oversample = BAUD_TUNE_OVERSAMPLE_MAX; oversample >= BAUD_TUNE_OVERSAMPLE_MIN; oversample--)
+    {
+        divider = (clock + ((baudRate * oversample) / 2UL)) / (baudRate * oversample);
+        if ((0UL == divider) || (divider > BAUD_TUNE_DIVIDER_MAX))
+        {
+            continue;
+        }
+
+        actual = clock / (divider * oversample);
+        error = (uint32_t) (((uint64_t) ((actual > baudRate) ? (actual - baudRate) : (baudRate - actual)) *
+                             1000000ULL) / baudRate);
+        if (error < bestError)
+        {
+            bestError = error;
+            setting->divider = divider;
+            setting->oversample = oversample;
+            setting->baudRate = actual;
+        }
+    }
+
+    return (bestError <= BAUD_TUNE_MAX_ERROR_PPM);
+}
+
+/********************************************************************************
+* Function Name: baud_tune_apply
+*********************************************************************************
+* Summary:
+* Reinitializes UART_HW with a clock setting. Data in the FIFOs is discarded;
+* the FIFO trigger levels are those of UART_config. The caller waits until
+* transmission is complete.
+*
+* Parameters:
+*  setting: Setting to apply
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void baud_tune_apply(const baud_tune_setting_t *setting)
+{
+    cy_stc_scb_uart_config_t config = UART_config;
+
+    config.oversample = setting->oversample;
+
+    Cy_SCB_UART_Disable(UART_HW, NULL);
+
+    (void) Cy_SysClk_PeriphDisableDivider(BAUD_TUNE_DIVIDER_TYPE, BAUD_TUNE_DIVIDER_NUM);
+    (void) Cy_SysClk_PeriphSetDivider(BAUD_TUNE_DIVIDER_TYPE, BAUD_TUNE_DIVIDER_NUM, setting->divider - 1UL);
+    (void) Cy_SysClk_PeriphEnableDivider(BAUD_TUNE_DIVIDER_TYPE, BAUD_TUNE_DIVIDER_NUM);
+
+    (void) Cy_SCB_UART_Init(UART_HW, &config, NULL);
+    Cy_SCB_UART_Enable(UART_HW);
+
+    g_baudTuneActive = *setting;
+    g_baudTuneTuned = (setting->divider != g_baudTuneDefault.divider) ||
+                      (setting->oversample != g_baudTuneDefault.oversample);
+    g_baudTuneErrors = 0UL;
+    g_baudTuneWindowStart = cycle_count_now();
+    event_trace_record(EVENT_TRACE_USER, setting->baudRate);
+}
+
+/********************************************************************************
+* Function Name: baud_tune_negotiate
+*********************************************************************************
+* Summary:
+* Runs the negotiation after BAUD_TUNE_COMMAND was received. UART_HW must be
+* read by polling during the negotiation, and no transmission may be in
+* progress.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the new rate is active, false if the old rate is kept
+*
+********************************************************************************/
+bool baud_tune_negotiate(void)
+{
+    baud_tune_setting_t previous = g_baudTuneActive;
+    baud_tune_setting_t setting;
+    uint32_t confirm;
+    bool ok;
+
+    (void) uart_fmt_str("BAUD?\r\n");
+    if (!baud_tune_read_rate(&setting.baudRate) || !baud_tune_find(setting.baudRate, &setting))
+    {
+        (void) uart_fmt_str("BAUD ERR\r\n");
+        return false;
+    }
+
+    (void) uart_fmt_str("BAUD ");
+    (void) uart_fmt_u32(setting.baudRate);
+    (void) uart_fmt_str("\r\n");
+    baud_tune_wait_tx();
+    baud_tune_apply(&setting);
+
+    ok = baud_tune_check_pattern();
+    if (ok)
+    {
+        baud_tune_wait_tx();
+        ok = baud_tune_get(&confirm, CYCLE_COUNT_MS_TO_CYCLES(BAUD_TUNE_TIMEOUT_MS)) &&
+             (BAUD_TUNE_CONFIRM == confirm);
+    }
+
+    if (!ok)
+    {
+        baud_tune_apply(&previous);
+        (void) uart_fmt_str("BAUD FAIL\r\n");
+    }
+
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_poll
+*********************************************************************************
+* Summary:
+* Counts receive errors while a tuned rate is active and returns to the
+* default rate when BAUD_TUNE_ERROR_LIMIT errors occur within a window. Call
+* periodically, for example from the main loop.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if UART_HW was reinitialized with the default rate
+*
+********************************************************************************/
+bool baud_tune_poll(void)
+{
+    uint32_t status;
+    bool fallback = false;
+
+    if (!g_baudTuneTuned)
+    {
+        return false;
+    }
+
+    status = Cy_SCB_GetRxInterruptStatus(UART_HW) & BAUD_TUNE_RX_ERRORS;
+    if (0UL != status)
+    {
+        Cy_SCB_ClearRxInterrupt(UART_HW, status);
+        g_baudTuneErrors++;
+    }
+
+    if (g_baudTuneErrors >= BAUD_TUNE_ERROR_LIMIT)
+    {
+        baud_tune_wait_tx();
+        baud_tune_apply(&g_baudTuneDefault);
+        (void) uart_fmt_str("BAUD FALLBACK\r\n");
+        fallback = true;
+    }
+    else if (cycle_count_elapsed(g_baudTuneWindowStart) >= CYCLE_COUNT_MS_TO_CYCLES(BAUD_TUNE_ERROR_WINDOW_MS))
+    {
+        g_baudTuneErrors = 0UL;
+        g_baudTuneWindowStart = cycle_count_now();
+    }
+    else
+    {
+        /* Window in progress */
+    }
+
+    return fallback;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_get_baud_rate
+*********************************************************************************
+* Summary:
+* Returns the active baud rate.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Baud rate
+*
+********************************************************************************/
+uint32_t baud_tune_get_baud_rate(void)
+{
+    return g_baudTuneActive.baudRate;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_get_setting
+*********************************************************************************
+* Summary:
+* Returns the active clock setting, so that a user of UART_HW at another rate
+* can restore it with baud_tune_apply().
+*
+* Parameters:
+*  setting: Active setting
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void baud_tune_get_setting(baud_tune_setting_t *setting)
+{
+    *setting = g_baudTuneActive;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_get
+*********************************************************************************
+* Summary:
+* Waits for a received character.
+*
+* Parameters:
+*  data: Returns the character
+*  timeout: Timeout in CPU cycles
+*
+* Return:
+*  bool: true if a character was received
+*
+********************************************************************************/
+static bool baud_tune_get(uint32_t *data, uint32_t timeout)
+{
+    uint32_t start = cycle_count_now();
+
+    while (0UL == Cy_SCB_UART_GetNumInRxFifo(UART_HW))
+    {
+        if (cycle_count_elapsed(start) >= timeout)
+        {
+            return false;
+        }
+    }
+    *data = Cy_SCB_UART_Get(UART_HW);
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_read_rate
+*********************************************************************************
+* Summary:
+* Reads the requested baud rate as decimal digits terminated by CR.
+*
+* Parameters:
+*  baudRate: Returns the baud rate
+*
+* Return:
+*  bool: true if a valid number was received
+*
+********************************************************************************/
+static bool baud_tune_read_rate(uint32_t *baudRate)
+{
+    uint32_t value = 0UL;
+    uint32_t digits = 0UL;
+    uint32_t data;
+
+    while (baud_tune_get(&data, CYCLE_COUNT_MS_TO_CYCLES(BAUD_TUNE_TIMEOUT_MS)))
+    {
+        if ('\r' == data)
+        {
+            *baudRate = value;
+            return (0UL != digits);
+        }
+        if ((data < '0') || (data > '9') || (digits >= BAUD_TUNE_RATE_DIGITS))
+        {
+            return false;
+        }
+        value = (value * 10UL) + (data - '0');
+        digits++;
+    }
+
+    return false;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_check_pattern
+*********************************************************************************
+* Summary:
+* Receives the test pattern at the new rate and echoes it when it is correct
+* and no receive errors occurred.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the pattern was received correctly
+*
+********************************************************************************/
+static bool baud_tune_check_pattern(void)
+{
+    uint8_t expected = BAUD_TUNE_PATTERN_SEED;
+    uint32_t data;
+    uint32_t i;
+
+    Cy_SCB_ClearRxInterrupt(UART_HW, BAUD_TUNE_RX_ERRORS);
+
+    for (i = 0UL; i < BAUD_TUNE_PATTERN_SIZE; i++)
+    {
+        if (!baud_tune_get(&data, CYCLE_COUNT_MS_TO_CYCLES(BAUD_TUNE_TIMEOUT_MS)) || (expected != data))
+        {
+            return false;
+        }
+        expected += BAUD_TUNE_PATTERN_STEP;
+    }
+
+    if (0UL != (Cy_SCB_GetRxInterruptStatus(UART_HW) & BAUD_TUNE_RX_ERRORS))
+    {
+        return false;
+    }
+
+    expected = BAUD_TUNE_PATTERN_SEED;
+    for (i = 0UL; i < BAUD_TUNE_PATTERN_SIZE; i++)
+    {
+        (void) uart_fmt_char((char) expected);
+        expected += BAUD_TUNE_PATTERN_STEP;
+    }
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: baud_tune_wait_tx
+*********************************************************************************
+* Summary:
+* Waits until the last character is shifted out, for at most
+* UART_FMT_TIMEOUT_MS.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void baud_tune_wait_tx(void)
+{
+    (void) uart_fmt_flush();
+}
+
+/* [] END OF FILE */
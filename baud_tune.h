@@ -0,0 +1,130 @@
+/******************************************************************************
+* File Name:   baud_tune.h
+*
+* Description: Public interface of the runtime UART baud rate tuning.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef BAUD_TUNE_H
+#define BAUD_TUNE_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Peripheral clock divider of UART_HW (peri div_16[1] in the design) */
+#ifndef BAUD_TUNE_DIVIDER_TYPE
+#define BAUD_TUNE_DIVIDER_TYPE          CY_SYSCLK_DIV_16_BIT
+#endif
+
+#ifndef BAUD_TUNE_DIVIDER_NUM
+#define BAUD_TUNE_DIVIDER_NUM           1UL
+#endif
+
+/* Setting of the design: 48 MHz / 35 / 12 */
+#define BAUD_TUNE_DEFAULT_BAUD_RATE     115200UL
+#define BAUD_TUNE_DEFAULT_DIVIDER       35UL
+#define BAUD_TUNE_DEFAULT_OVERSAMPLE    12UL
+
+/* Oversampling range of the SCB UART */
+#define BAUD_TUNE_OVERSAMPLE_MIN        8UL
+#define BAUD_TUNE_OVERSAMPLE_MAX        16UL
+
+/* Largest baud rate error accepted, in ppm of the requested rate */
+#ifndef BAUD_TUNE_MAX_ERROR_PPM
+#define BAUD_TUNE_MAX_ERROR_PPM         20000UL
+#endif
+
+/* Time the host has to answer at the new rate */
+#ifndef BAUD_TUNE_TIMEOUT_MS
+#define BAUD_TUNE_TIMEOUT_MS            500UL
+#endif
+
+/* Receive errors within BAUD_TUNE_ERROR_WINDOW_MS that cause a fallback to
+ * the default rate */
+#ifndef BAUD_TUNE_ERROR_LIMIT
+#define BAUD_TUNE_ERROR_LIMIT           4UL
+#endif
+
+#ifndef BAUD_TUNE_ERROR_WINDOW_MS
+#define BAUD_TUNE_ERROR_WINDOW_MS       1000UL
+#endif
+
+/* Bytes of the test pattern exchanged at the new rate */
+#define BAUD_TUNE_PATTERN_SIZE          64UL
+
+/* Terminal command that starts a negotiation */
+#define BAUD_TUNE_COMMAND               'u'
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* UART clock setting */
+typedef struct
+{
+    uint32_t divider;                   /* Peripheral clock division (1 to 65536) */
+    uint32_t oversample;                /* Clocks per bit */
+    uint32_t baudRate;                  /* Resulting baud rate */
+} baud_tune_setting_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+bool baud_tune_find(uint32_t baudRate, baud_tune_setting_t *setting);
+void baud_tune_apply(const baud_tune_setting_t *setting);
+bool baud_tune_negotiate(void);
+bool baud_tune_poll(void);
+uint32_t baud_tune_get_baud_rate(void);
+void baud_tune_get_setting(baud_tune_setting_t *setting);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* BAUD_TUNE_H */
+
+/* [] END OF FILE */
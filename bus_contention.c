@@ -0,0 +1,455 @@
+/******************************************************************************
+* File Name:   bus_contention.c
+*
+* Description: This file contains the bus contention benchmark. A calibrated CPU
+*              workload runs while the PING/PONG chain streams SRAM to SRAM in the
+*              background. For every CHANNEL_PRIORITY setting it reports the CPU
+*              slowdown caused by the DMAC on the shared AHB and the DMA
+*              throughput achieved at the same time.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "bus_contention.h"
+#include "dma_benchmark.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Each descriptor moves half of the chain */
+#define BUS_CONTENTION_DESCR_SIZE       (BUS_CONTENTION_CHAIN_SIZE / 2UL)
+
+/* Words accessed by the SRAM workload per pass */
+#define BUS_CONTENTION_SRAM_WORDS       64UL
+
+/* Words read by the flash workload per pass */
+#define BUS_CONTENTION_FLASH_WORDS      256UL
+
+/* Flash window read by the flash workload, past the vector table */
+#define BUS_CONTENTION_FLASH_OFFSET     0x100UL
+
+/* Permille scale of the slowdown */
+#define BUS_CONTENTION_PERMILLE         1000UL
+
+/* The stream source, the stream destination and the SRAM working set follow
+ * each other in the shared benchmark buffer */
+#if (((2UL * BUS_CONTENTION_CHAIN_SIZE) + (BUS_CONTENTION_SRAM_WORDS * 4UL)) > DMA_BENCHMARK_MAX_SIZE)
+#error "BUS_CONTENTION_CHAIN_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* CPU workload, runs the given number of passes and returns a checksum */
+typedef uint32_t (*bus_contention_workload_t)(uint32_t passes);
+
+/* Workload under test */
+typedef struct
+{
+    bus_contention_workload_t function;
+    const char *name;
+} bus_contention_case_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Background stream buffers, in the shared benchmark buffer */
+static uint32_t *g_contentionSrc = NULL;
+static uint32_t *g_contentionDst = NULL;
+
+/* Working set of the SRAM workload, in the shared benchmark buffer */
+static uint32_t *g_contentionSram = NULL;
+
+/* Stream state, shared with the DMAC interrupt */
+static volatile bool g_contentionStreaming = false;
+static volatile uint32_t g_contentionBytes = 0UL;
+static volatile uint32_t g_contentionIsrCycles = 0UL;
+
+/* Keeps the workload results alive */
+static volatile uint32_t g_contentionSink;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static uint32_t bus_contention_idle(uint32_t passes);
+static uint32_t bus_contention_sram(uint32_t passes);
+static uint32_t bus_contention_flash(uint32_t passes);
+static uint32_t bus_contention_calibrate(bus_contention_workload_t workload);
+static uint32_t bus_contention_measure(bus_contention_workload_t workload, uint32_t passes);
+static void bus_contention_arm(void);
+static void bus_contention_stream_start(void);
+static void bus_contention_stream_stop(void);
+static void bus_contention_callback(uint32_t channel);
+
+/* Workloads of the benchmark */
+static const bus_contention_case_t g_contentionCases[] =
+{
+    { bus_contention_idle,  "idle"  },
+    { bus_contention_sram,  "sram"  },
+    { bus_contention_flash, "flash" }
+};
+
+/********************************************************************************
+* Function Name: bus_contention_run
+*********************************************************************************
+* Summary:
+* Runs each workload without DMA traffic to get its baseline, then with the
+* background stream active, and writes the results as CSV. The "idle"
+* workload only spins in registers, so its row gives the DMA throughput with
+* no CPU bus traffic. The stream is the only active channel, so the channel
+* priority, which only arbitrates between DMAC channels, does not change the
+* result and is left as configured. The USER_DMA descriptors are reprogrammed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void bus_contention_run(void)
+{
+    uint32_t *scratch = (uint32_t *) dma_benchmark_scratch();
+    uint32_t c;
+    uint32_t passes;
+    uint32_t baseCycles;
+    uint32_t cycles;
+    uint32_t cpuCycles;
+    uint32_t slowdown;
+
+    g_contentionSrc = scratch;
+    g_contentionDst = &scratch[BUS_CONTENTION_CHAIN_SIZE / 4UL];
+    g_contentionSram = &scratch[(2UL * BUS_CONTENTION_CHAIN_SIZE) / 4UL];
+
+    dma_chain_register_callback(BUS_CONTENTION_CHANNEL, bus_contention_callback);
+
+    dma_benchmark_csv_comment("bus_contention");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("workload");
+    dma_benchmark_csv_str("base_cycles");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("isr_cycles");
+    dma_benchmark_csv_str("slowdown_permille");
+    dma_benchmark_csv_str("dma_bytes");
+    dma_benchmark_csv_str("dma_bytes_per_kcycle");
+    dma_benchmark_csv_end();
+
+    for (c = 0UL; c < (sizeof(g_contentionCases) / sizeof(g_contentionCases[0])); c++)
+    {
+        passes = bus_contention_calibrate(g_contentionCases[c].function);
+        baseCycles = bus_contention_measure(g_contentionCases[c].function, passes);
+
+        bus_contention_stream_start();
+        cycles = bus_contention_measure(g_contentionCases[c].function, passes);
+        bus_contention_stream_stop();
+
+        /* Time spent re-arming the chain is not bus contention */
+        cpuCycles = (cycles > g_contentionIsrCycles) ? (cycles - g_contentionIsrCycles) : 0UL;
+        slowdown = (cpuCycles > baseCycles) ?
+                   (uint32_t) (((uint64_t) (cpuCycles - baseCycles) * BUS_CONTENTION_PERMILLE) / baseCycles) :
+                   0UL;
+
+        dma_benchmark_csv_begin("contention");
+        dma_benchmark_csv_str(g_contentionCases[c].name);
+        dma_benchmark_csv_u32(baseCycles);
+        dma_benchmark_csv_u32(cycles);
+        dma_benchmark_csv_u32(g_contentionIsrCycles);
+        dma_benchmark_csv_u32(slowdown);
+        dma_benchmark_csv_u32(g_contentionBytes);
+        dma_benchmark_csv_u32((uint32_t) (((uint64_t) g_contentionBytes * 1000UL) / cycles));
+        dma_benchmark_csv_end();
+    }
+
+    dma_chain_register_callback(BUS_CONTENTION_CHANNEL, NULL);
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: bus_contention_idle
+*********************************************************************************
+* Summary:
+* Workload without bus accesses other than instruction fetch.
+*
+* Parameters:
+*  passes: Number of passes
+*
+* Return:
+*  uint32_t: Checksum
+*
+********************************************************************************/
+static uint32_t bus_contention_idle(uint32_t passes)
+{
+    uint32_t sum = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < (passes * BUS_CONTENTION_SRAM_WORDS); i++)
+    {
+        sum = (sum << 1U) ^ i;
+    }
+
+    return sum;
+}
+
+/********************************************************************************
+* Function Name: bus_contention_sram
+*********************************************************************************
+* Summary:
+* SRAM-heavy workload. Every pass reads, modifies and writes back each word of
+* the working set.
+*
+* Parameters:
+*  passes: Number of passes
+*
+* Return:
+*  uint32_t: Checksum
+*
+********************************************************************************/
+static uint32_t bus_contention_sram(uint32_t passes)
+{
+    uint32_t sum = 0UL;
+    uint32_t pass;
+    uint32_t i;
+
+    for (pass = 0UL; pass < passes; pass++)
+    {
+        for (i = 0UL; i < BUS_CONTENTION_SRAM_WORDS; i++)
+        {
+            g_contentionSram[i] += pass;
+            sum ^= g_contentionSram[i];
+        }
+    }
+
+    return sum;
+}
+
+/********************************************************************************
+* Function Name: bus_contention_flash
+*********************************************************************************
+* Summary:
+* Flash-heavy workload. Every pass sums a window of flash.
+*
+* Parameters:
+*  passes: Number of passes
+*
+* Return:
+*  uint32_t: Checksum
+*
+********************************************************************************/
+static uint32_t bus_contention_flash(uint32_t passes)
+{
+    const volatile uint32_t *flash = (const volatile uint32_t *) (CY_FLASH_BASE + BUS_CONTENTION_FLASH_OFFSET);
+    uint32_t sum = 0UL;
+    uint32_t pass;
+    uint32_t i;
+
+    for (pass = 0UL; pass < passes; pass++)
+    {
+        for (i = 0UL; i < BUS_CONTENTION_FLASH_WORDS; i++)
+        {
+            sum += flash[i];
+        }
+    }
+
+    return sum;
+}
+
+/********************************************************************************
+* Function Name: bus_contention_calibrate
+*********************************************************************************
+* Summary:
+* Returns the number of passes after which the workload runs for about
+* BUS_CONTENTION_TARGET_CYCLES without DMA traffic.
+*
+* Parameters:
+*  workload: Workload to calibrate
+*
+* Return:
+*  uint32_t: Number of passes, at least 1
+*
+********************************************************************************/
+static uint32_t bus_contention_calibrate(bus_contention_workload_t workload)
+{
+    uint32_t perPass = bus_contention_measure(workload, 1UL);
+    uint32_t passes = (0UL != perPass) ? (BUS_CONTENTION_TARGET_CYCLES / perPass) : 1UL;
+
+    return (0UL != passes) ? passes : 1UL;
+}
+
+/********************************************************************************
+* Function Name: bus_contention_measure
+*********************************************************************************
+* Summary:
+* Runs the workload once and returns its duration.
+*
+* Parameters:
+*  workload: Workload to run
+*  passes: Number of passes
+*
+* Return:
+*  uint32_t: CPU cycles
+*
+********************************************************************************/
+static uint32_t bus_contention_measure(bus_contention_workload_t workload, uint32_t passes)
+{
+    uint32_t start = cycle_count_now();
+
+    g_contentionSink = workload(passes);
+
+    return cycle_count_elapsed(start);
+}
+
+/********************************************************************************
+* Function Name: bus_contention_arm
+*********************************************************************************
+* Summary:
+* Configures the PING/PONG chain over the stream buffers and triggers it.
+* PING continues into PONG, PONG interrupts on completion.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void bus_contention_arm(void)
+{
+    dma_chain_segment_t segment =
+    {
+        .src          = g_contentionSrc,
+        .dst          = g_contentionDst,
+        .count        = BUS_CONTENTION_DESCR_SIZE / 4UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_DESCR_LIST,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = false
+    };
+
+    (void) dma_chain_config(BUS_CONTENTION_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+
+    segment.src         = &g_contentionSrc[BUS_CONTENTION_DESCR_SIZE / 4UL];
+    segment.dst         = &g_contentionDst[BUS_CONTENTION_DESCR_SIZE / 4UL];
+    segment.triggerType = CY_DMAC_SINGLE_DESCR;
+    segment.interrupt   = true;
+    (void) dma_chain_config(BUS_CONTENTION_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &segment);
+
+    dma_chain_start(BUS_CONTENTION_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+    dma_chain_trigger();
+}
+
+/********************************************************************************
+* Function Name: bus_contention_stream_start
+*********************************************************************************
+* Summary:
+* Starts the background stream.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void bus_contention_stream_start(void)
+{
+    g_contentionBytes = 0UL;
+    g_contentionIsrCycles = 0UL;
+    g_contentionStreaming = true;
+
+    bus_contention_arm();
+}
+
+/********************************************************************************
+* Function Name: bus_contention_stream_stop
+*********************************************************************************
+* Summary:
+* Stops re-arming the stream and waits for the chain in flight to complete.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void bus_contention_stream_stop(void)
+{
+    g_contentionStreaming = false;
+
+    (void) dma_chain_wait(BUS_CONTENTION_CHANNEL, CY_DMAC_DESCRIPTOR_PONG);
+}
+
+/********************************************************************************
+* Function Name: bus_contention_callback
+*********************************************************************************
+* Summary:
+* PONG completion callback. Accounts the chain and re-arms it while the stream
+* is active.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void bus_contention_callback(uint32_t channel)
+{
+    uint32_t start = cycle_count_now();
+
+    CY_UNUSED_PARAMETER(channel);
+
+    g_contentionBytes += BUS_CONTENTION_CHAIN_SIZE;
+
+    if (g_contentionStreaming)
+    {
+        bus_contention_arm();
+    }
+
+    g_contentionIsrCycles += cycle_count_elapsed(start);
+}
+
+/* [] END OF FILE */
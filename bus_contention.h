@@ -0,0 +1,84 @@
+/******************************************************************************
+* File Name:   bus_contention.h
+*
+* Description: Public interface of the bus contention benchmark.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef BUS_CONTENTION_H
+#define BUS_CONTENTION_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_benchmark.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Target duration of one calibrated CPU workload run, in CPU cycles */
+#ifndef BUS_CONTENTION_TARGET_CYCLES
+#define BUS_CONTENTION_TARGET_CYCLES    480000UL
+#endif
+
+/* Bytes moved by one PING/PONG chain of the background stream, a multiple
+ * of 8. Source and destination are in the shared benchmark buffer. */
+#ifndef BUS_CONTENTION_CHAIN_SIZE
+#define BUS_CONTENTION_CHAIN_SIZE       (DMA_BENCHMARK_MAX_SIZE / 4UL)
+#endif
+
+/* DMAC channel of the background stream */
+#define BUS_CONTENTION_CHANNEL          USER_DMA_CHANNEL
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void bus_contention_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* BUS_CONTENTION_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,143 @@
+/******************************************************************************
+* File Name:   cycle_count.c
+*
+* Description: This file implements a free-running 32-bit CPU cycle counter on
+*              top of the 24-bit SysTick timer of the Cortex-M0+. The M0+ has no
+*              DWT cycle counter, so SysTick is clocked from the CPU clock and its
+*              wraps are counted in the SysTick callback.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* SysTick callback slot used for the wrap counter */
+#define CYCLE_COUNT_CALLBACK_SLOT       0UL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Number of SysTick wraps since cycle_count_init() */
+static volatile uint32_t g_cycleCountWraps = 0UL;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void cycle_count_wrap_callback(void);
+
+/********************************************************************************
+* Function Name: cycle_count_init
+*********************************************************************************
+* Summary:
+* Starts SysTick from the CPU clock with the full 24-bit reload value and
+* registers the wrap callback. Must be called once before cycle_count_now().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void cycle_count_init(void)
+{
+    g_cycleCountWraps = 0UL;
+
+    Cy_SysTick_Init(CY_SYSTICK_CLOCK_SOURCE_CLK_CPU, CYCLE_COUNT_RELOAD);
+    (void) Cy_SysTick_SetCallback(CYCLE_COUNT_CALLBACK_SLOT, cycle_count_wrap_callback);
+}
+
+/********************************************************************************
+* Function Name: cycle_count_now
+*********************************************************************************
+* Summary:
+* Returns the current value of the extended 32-bit cycle counter. Safe to call
+* from interrupt context and with interrupts masked: a wrap that is pending but
+* not yet serviced is accounted for.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: CPU cycles since cycle_count_init(), modulo 2^32
+*
+********************************************************************************/
+uint32_t cycle_count_now(void)
+{
+    uint32_t wraps;
+    uint32_t ticks;
+
+    do
+    {
+        wraps = g_cycleCountWraps;
+        ticks = CYCLE_COUNT_RELOAD - Cy_SysTick_GetValue();
+    } while (wraps != g_cycleCountWraps);
+
+    /* The counter reloaded but the callback has not run yet */
+    if ((0UL != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) && (ticks < (CYCLE_COUNT_RELOAD >> 1U)))
+    {
+        wraps++;
+    }
+
+    return ((wraps << CYCLE_COUNT_HW_BITS) + ticks);
+}
+
+/********************************************************************************
+* Function Name: cycle_count_wrap_callback
+*********************************************************************************
+* Summary:
+* SysTick callback. Extends the hardware counter by one wrap.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void cycle_count_wrap_callback(void)
+{
+    g_cycleCountWraps++;
+}
+
+/* [] END OF FILE */
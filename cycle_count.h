@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name:   cycle_count.h
+*
+* Description: Public interface of the CPU cycle counter used to time DMA and
+*              CPU operations.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef CYCLE_COUNT_H
+#define CYCLE_COUNT_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* SysTick reload value. The 24-bit counter wraps every 2^24 CPU cycles. */
+#define CYCLE_COUNT_RELOAD              0x00FFFFFFUL
+
+/* Number of counter bits provided by the SysTick hardware */
+#define CYCLE_COUNT_HW_BITS             24U
+
+/* CPU cycles in a number of milliseconds at the current core clock */
+#define CYCLE_COUNT_MS_TO_CYCLES(ms)    ((SystemCoreClock / 1000UL) * (ms))
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void cycle_count_init(void);
+uint32_t cycle_count_now(void);
+
+/********************************************************************************
+* Function Name: cycle_count_elapsed
+*********************************************************************************
+* Summary:
+* Returns the number of CPU cycles since a timestamp taken with
+* cycle_count_now(). Correct across one 32-bit wrap of the extended counter.
+*
+* Parameters:
+*  start: Timestamp returned by cycle_count_now()
+*
+* Return:
+*  uint32_t: Elapsed CPU cycles
+*
+********************************************************************************/
+__STATIC_INLINE uint32_t cycle_count_elapsed(uint32_t start)
+{
+    return (cycle_count_now() - start);
+}
+
+/********************************************************************************
+* Function Name: cycle_count_expired
+*********************************************************************************
+* Summary:
+* Reports whether a deadline of a number of cycles after a timestamp has
+* passed. Used to bound polling loops.
+*
+* Parameters:
+*  start: Timestamp returned by cycle_count_now()
+*  cycles: Length of the deadline in CPU cycles
+*
+* Return:
+*  bool: true once at least the given number of cycles has elapsed
+*
+********************************************************************************/
+__STATIC_INLINE bool cycle_count_expired(uint32_t start, uint32_t cycles)
+{
+    return (cycle_count_elapsed(start) >= cycles);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CYCLE_COUNT_H */
+
+/* [] END OF FILE */
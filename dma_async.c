@@ -0,0 +1,384 @@
+/******************************************************************************
+* File Name:   dma_async.c
+*
+* Description: This file contains the benchmark of the stackless tasks. Several
+*              "DMA in, process, DMA out" pipelines run once one after the other
+*              with blocking waits and once as tasks that await their copies, so
+*              the CPU processes a block of one pipeline while the DMA queue
+*              copies the blocks of the others.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "dma_async.h"
+#include "dma_benchmark.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Pipelines, blocks per pipeline and bytes per block of the benchmark. The
+ * output and the work blocks share the benchmark buffer: 128-byte blocks
+ * with the default 2 KB buffer, 64-byte blocks with 1 KB. */
+#define DMA_ASYNC_BENCHMARK_PIPELINES   4UL
+#define DMA_ASYNC_BENCHMARK_BLOCKS      2UL
+#define DMA_ASYNC_BENCHMARK_SIZE        (DMA_BENCHMARK_MAX_SIZE / 16UL)
+
+/* Flash source of the benchmark, past the vector table */
+#define DMA_ASYNC_BENCHMARK_SRC         (CY_FLASH_BASE + 0x100UL)
+
+/* Bytes of flash read by one pipeline */
+#define DMA_ASYNC_BENCHMARK_STRIDE      (DMA_ASYNC_BENCHMARK_BLOCKS * DMA_ASYNC_BENCHMARK_SIZE)
+
+/* Output of all pipelines, followed by one work block per pipeline */
+#define DMA_ASYNC_BENCHMARK_OUTPUT_SIZE (DMA_ASYNC_BENCHMARK_PIPELINES * DMA_ASYNC_BENCHMARK_STRIDE)
+#define DMA_ASYNC_BENCHMARK_WORK_SIZE   (DMA_ASYNC_BENCHMARK_PIPELINES * DMA_ASYNC_BENCHMARK_SIZE)
+
+#if ((DMA_ASYNC_BENCHMARK_OUTPUT_SIZE + DMA_ASYNC_BENCHMARK_WORK_SIZE) > DMA_BENCHMARK_MAX_SIZE)
+#error "The async benchmark exceeds the shared benchmark buffer"
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* State of one pipeline. It is all a suspended pipeline needs. */
+typedef struct
+{
+    dma_async_t task;                   /* Resume point */
+    dma_queue_request_t request;        /* Copy in progress */
+    const uint8_t *src;                 /* Input blocks in flash */
+    uint8_t *dst;                       /* Output blocks */
+    uint8_t *work;                      /* Block being processed */
+    uint32_t block;                     /* Index of the current block */
+    bool ok;                            /* Every copy completed */
+} dma_async_pipeline_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+static dma_async_pipeline_t g_asyncPipelines[DMA_ASYNC_BENCHMARK_PIPELINES];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void dma_async_pipeline_init(dma_async_pipeline_t *pipeline, uint32_t index);
+static void dma_async_pipeline_copy(dma_async_pipeline_t *pipeline, const void *src, void *dst);
+static void dma_async_pipeline_process(dma_async_pipeline_t *pipeline);
+static dma_async_status_t dma_async_pipeline_run(dma_async_pipeline_t *pipeline);
+static void dma_async_pipeline_block(dma_async_pipeline_t *pipeline);
+static uint32_t dma_async_benchmark_measure(bool tasks, bool *ok);
+
+/********************************************************************************
+* Function Name: dma_async_benchmark_run
+*********************************************************************************
+* Summary:
+* Runs DMA_ASYNC_BENCHMARK_PIPELINES pipelines with blocking waits and as
+* tasks, and writes the cycles and the state size of a pipeline as CSV. Each
+* pipeline copies its blocks from flash to a work buffer, inverts them and
+* copies them to the output. dma_queue_init(), the cycle counter and UART_HW
+* must be initialized.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_async_benchmark_run(void)
+{
+    uint32_t cycles;
+    uint32_t m;
+    bool ok;
+
+    dma_benchmark_csv_comment("dma_async");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("pipelines");
+    dma_benchmark_csv_str("blocks");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("state_bytes");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (m = 0UL; m < 2UL; m++)
+    {
+        cycles = dma_async_benchmark_measure((1UL == m), &ok);
+
+        dma_benchmark_csv_begin("async");
+        dma_benchmark_csv_str((1UL == m) ? "tasks" : "blocking");
+        dma_benchmark_csv_u32(DMA_ASYNC_BENCHMARK_PIPELINES);
+        dma_benchmark_csv_u32(DMA_ASYNC_BENCHMARK_BLOCKS);
+        dma_benchmark_csv_u32(DMA_ASYNC_BENCHMARK_SIZE);
+        dma_benchmark_csv_u32(cycles);
+        dma_benchmark_csv_u32((uint32_t) sizeof(dma_async_pipeline_t));
+        dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+        dma_benchmark_csv_end();
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dma_async_benchmark_measure
+*********************************************************************************
+* Summary:
+* Runs all pipelines to the end and checks the output.
+*
+* Parameters:
+*  tasks: Run the pipelines as tasks instead of one after the other
+*  ok: Set to true if every copy completed and the output is correct
+*
+* Return:
+*  uint32_t: Cycles from the first copy to the last completion
+*
+********************************************************************************/
+static uint32_t dma_async_benchmark_measure(bool tasks, bool *ok)
+{
+    const uint8_t *src = (const uint8_t *) DMA_ASYNC_BENCHMARK_SRC;
+    uint8_t *output = dma_benchmark_scratch();
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t i;
+    uint32_t running;
+    bool done = true;
+
+    (void) memset(output, 0, DMA_ASYNC_BENCHMARK_OUTPUT_SIZE);
+    for (i = 0UL; i < DMA_ASYNC_BENCHMARK_PIPELINES; i++)
+    {
+        dma_async_pipeline_init(&g_asyncPipelines[i], i);
+    }
+
+    start = cycle_count_now();
+    if (tasks)
+    {
+        /* The main loop of an application: call every task until all are done */
+        do
+        {
+            running = 0UL;
+            for (i = 0UL; i < DMA_ASYNC_BENCHMARK_PIPELINES; i++)
+            {
+                if (DMA_ASYNC_WAITING == dma_async_pipeline_run(&g_asyncPipelines[i]))
+                {
+                    running++;
+                }
+            }
+        } while (0UL != running);
+    }
+    else
+    {
+        for (i = 0UL; i < DMA_ASYNC_BENCHMARK_PIPELINES; i++)
+        {
+            for (g_asyncPipelines[i].block = 0UL; g_asyncPipelines[i].block < DMA_ASYNC_BENCHMARK_BLOCKS;
+                 g_asyncPipelines[i].block++)
+            {
+                dma_async_pipeline_block(&g_asyncPipelines[i]);
+            }
+        }
+    }
+    cycles = cycle_count_elapsed(start);
+
+    for (i = 0UL; i < DMA_ASYNC_BENCHMARK_OUTPUT_SIZE; i++)
+    {
+        done = done && (0xFFU == (uint8_t) (output[i] ^ src[i]));
+    }
+    for (i = 0UL; i < DMA_ASYNC_BENCHMARK_PIPELINES; i++)
+    {
+        done = done && g_asyncPipelines[i].ok;
+    }
+    *ok = done;
+
+    return cycles;
+}
+
+/********************************************************************************
+* Function Name: dma_async_pipeline_init
+*********************************************************************************
+* Summary:
+* Sets a pipeline to process its own part of the flash source into its own
+* part of the output, starting from the first block. The output and the work
+* block are parts of the shared benchmark buffer.
+*
+* Parameters:
+*  pipeline: Pipeline state
+*  index: Pipeline number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_async_pipeline_init(dma_async_pipeline_t *pipeline, uint32_t index)
+{
+    const uint8_t *src = (const uint8_t *) DMA_ASYNC_BENCHMARK_SRC;
+    uint8_t *buffer = dma_benchmark_scratch();
+
+    dma_async_init(&pipeline->task);
+    pipeline->src   = &src[index * DMA_ASYNC_BENCHMARK_STRIDE];
+    pipeline->dst   = &buffer[index * DMA_ASYNC_BENCHMARK_STRIDE];
+    pipeline->work  = &buffer[DMA_ASYNC_BENCHMARK_OUTPUT_SIZE + (index * DMA_ASYNC_BENCHMARK_SIZE)];
+    pipeline->block = 0UL;
+    pipeline->ok    = true;
+}
+
+/********************************************************************************
+* Function Name: dma_async_pipeline_copy
+*********************************************************************************
+* Summary:
+* Submits one block copy of a pipeline to the DMA queue.
+*
+* Parameters:
+*  pipeline: Pipeline state
+*  src: Source block
+*  dst: Destination block
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_async_pipeline_copy(dma_async_pipeline_t *pipeline, const void *src, void *dst)
+{
+    pipeline->request.src      = src;
+    pipeline->request.dst      = dst;
+    pipeline->request.size     = DMA_ASYNC_BENCHMARK_SIZE;
+    pipeline->request.callback = NULL;
+    pipeline->request.context  = NULL;
+
+    (void) dma_queue_submit(&pipeline->request);
+}
+
+/********************************************************************************
+* Function Name: dma_async_pipeline_process
+*********************************************************************************
+* Summary:
+* Processing step of a pipeline: inverts the work buffer. Also records the
+* response of the copy that filled it.
+*
+* Parameters:
+*  pipeline: Pipeline state
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_async_pipeline_process(dma_async_pipeline_t *pipeline)
+{
+    uint32_t i;
+
+    pipeline->ok = pipeline->ok && (CY_DMAC_DONE == pipeline->request.response);
+
+    for (i = 0UL; i < DMA_ASYNC_BENCHMARK_SIZE; i++)
+    {
+        pipeline->work[i] = (uint8_t) ~pipeline->work[i];
+    }
+}
+
+/********************************************************************************
+* Function Name: dma_async_pipeline_run
+*********************************************************************************
+* Summary:
+* Pipeline as a task: copies each block in, processes it and copies it out,
+* returning to the caller while a copy is in progress. A copy that does not
+* complete within DMA_ASYNC_TIMEOUT_MS ends the pipeline.
+*
+* Parameters:
+*  pipeline: Pipeline state
+*
+* Return:
+*  dma_async_status_t: DMA_ASYNC_WAITING until the last block is copied out
+*
+********************************************************************************/
+static dma_async_status_t dma_async_pipeline_run(dma_async_pipeline_t *pipeline)
+{
+    DMA_ASYNC_BEGIN(&pipeline->task);
+
+    for (pipeline->block = 0UL; pipeline->block < DMA_ASYNC_BENCHMARK_BLOCKS; pipeline->block++)
+    {
+        dma_async_pipeline_copy(pipeline, &pipeline->src[pipeline->block * DMA_ASYNC_BENCHMARK_SIZE],
+                                pipeline->work);
+        DMA_ASYNC_AWAIT_TIMEOUT(&pipeline->task, dma_async_request_done(&pipeline->request),
+                                CYCLE_COUNT_MS_TO_CYCLES(DMA_ASYNC_TIMEOUT_MS));
+        if (!dma_async_request_done(&pipeline->request))
+        {
+            pipeline->ok = false;
+            DMA_ASYNC_EXIT(&pipeline->task);
+        }
+
+        dma_async_pipeline_process(pipeline);
+
+        dma_async_pipeline_copy(pipeline, pipeline->work,
+                                &pipeline->dst[pipeline->block * DMA_ASYNC_BENCHMARK_SIZE]);
+        DMA_ASYNC_AWAIT_TIMEOUT(&pipeline->task, dma_async_request_done(&pipeline->request),
+                                CYCLE_COUNT_MS_TO_CYCLES(DMA_ASYNC_TIMEOUT_MS));
+        pipeline->ok = pipeline->ok && (CY_DMAC_DONE == pipeline->request.response);
+    }
+
+    DMA_ASYNC_END(&pipeline->task);
+}
+
+/********************************************************************************
+* Function Name: dma_async_pipeline_block
+*********************************************************************************
+* Summary:
+* Blocking counterpart of one iteration of dma_async_pipeline_run(): the CPU
+* waits for each copy.
+*
+* Parameters:
+*  pipeline: Pipeline state
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_async_pipeline_block(dma_async_pipeline_t *pipeline)
+{
+    dma_async_pipeline_copy(pipeline, &pipeline->src[pipeline->block * DMA_ASYNC_BENCHMARK_SIZE],
+                            pipeline->work);
+    (void) dma_queue_wait(&pipeline->request);
+
+    dma_async_pipeline_process(pipeline);
+
+    dma_async_pipeline_copy(pipeline, pipeline->work,
+                            &pipeline->dst[pipeline->block * DMA_ASYNC_BENCHMARK_SIZE]);
+    pipeline->ok = pipeline->ok && (CY_DMAC_DONE == dma_queue_wait(&pipeline->request));
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,231 @@
+/******************************************************************************
+* File Name:   dma_async.h
+*
+* Description: This file contains the stackless tasks that await DMA completions
+*              and UART drains. A task is a function that the main loop calls
+*              until it reports DMA_ASYNC_DONE. At each await it returns with
+*              its resume point saved in a dma_async_t, so any number of
+*              pipelines share the stack of the main loop.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_ASYNC_H
+#define DMA_ASYNC_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_chain.h"
+#include "dma_queue.h"
+#include "uart_tx_dma.h"
+#include "cycle_count.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Default bound of an await with a timeout */
+#ifndef DMA_ASYNC_TIMEOUT_MS
+#define DMA_ASYNC_TIMEOUT_MS            100UL
+#endif
+
+/* Resume points of a task that has not started and of a finished task */
+#define DMA_ASYNC_START                 0UL
+#define DMA_ASYNC_FINISHED              0xFFFFFFFFUL
+
+/* Opens the body of a task. The resume point is a case label, so local
+ * variables do not keep their value across an await: keep the task state in
+ * the structure that holds the dma_async_t. An await must not be placed in a
+ * switch statement of the body, and at most one await fits on a source line. */
+#define DMA_ASYNC_BEGIN(task)           switch ((task)->line) { case DMA_ASYNC_START:
+
+/* Returns DMA_ASYNC_WAITING until the condition is true. The condition is
+ * evaluated on every call of the task and must not have side effects. */
+#define DMA_ASYNC_AWAIT(task, condition)                                        \
+    do                                                                          \
+    {                                                                           \
+        (task)->line = (uint32_t) __LINE__;                                     \
+        case __LINE__:                                                          \
+        if (!(condition))                                                       \
+        {                                                                       \
+            return DMA_ASYNC_WAITING;                                           \
+        }                                                                       \
+    } while (0)
+
+/* Awaits the condition for at most a number of CPU cycles. The task tests
+ * the condition again to tell a completion from a timeout. */
+#define DMA_ASYNC_AWAIT_TIMEOUT(task, condition, timeoutCycles)                 \
+    do                                                                          \
+    {                                                                           \
+        (task)->start = cycle_count_now();                                      \
+        DMA_ASYNC_AWAIT((task), (condition) ||                                  \
+                        cycle_count_expired((task)->start, (timeoutCycles)));   \
+    } while (0)
+
+/* Returns DMA_ASYNC_WAITING once, so that the other tasks can run */
+#define DMA_ASYNC_YIELD(task)                                                   \
+    do                                                                          \
+    {                                                                           \
+        (task)->line = (uint32_t) __LINE__;                                     \
+        return DMA_ASYNC_WAITING;                                               \
+        case __LINE__:                                                          \
+        ;                                                                       \
+    } while (0)
+
+/* Finishes the task early */
+#define DMA_ASYNC_EXIT(task)                                                    \
+    do                                                                          \
+    {                                                                           \
+        (task)->line = DMA_ASYNC_FINISHED;                                      \
+        return DMA_ASYNC_DONE;                                                  \
+    } while (0)
+
+/* Closes the body of a task. A finished task reports DMA_ASYNC_DONE on every
+ * later call until dma_async_init() restarts it. */
+#define DMA_ASYNC_END(task)             } (task)->line = DMA_ASYNC_FINISHED; return DMA_ASYNC_DONE
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Result of one call of a task */
+typedef enum
+{
+    DMA_ASYNC_WAITING = 0,              /* Suspended at an await */
+    DMA_ASYNC_DONE                      /* Finished */
+} dma_async_status_t;
+
+/* Resume point of a task, 8 bytes per task */
+typedef struct
+{
+    uint32_t line;                      /* Source line of the await, or DMA_ASYNC_START */
+    uint32_t start;                     /* Timestamp of the await with a timeout */
+} dma_async_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void dma_async_benchmark_run(void);
+
+/********************************************************************************
+* Function Name: dma_async_init
+*********************************************************************************
+* Summary:
+* Sets a task to start from the beginning of its body on its next call.
+*
+* Parameters:
+*  task: Resume point of the task
+*
+* Return:
+*  void
+*
+********************************************************************************/
+__STATIC_INLINE void dma_async_init(dma_async_t *task)
+{
+    task->line = DMA_ASYNC_START;
+    task->start = 0UL;
+}
+
+/********************************************************************************
+* Function Name: dma_async_descriptor_done
+*********************************************************************************
+* Summary:
+* Await condition: the descriptor has a response. The descriptor must have
+* been configured, which clears its response, before the task awaits it.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: CY_DMAC_DESCRIPTOR_PING or CY_DMAC_DESCRIPTOR_PONG
+*
+* Return:
+*  bool: true once the descriptor completed or failed
+*
+********************************************************************************/
+__STATIC_INLINE bool dma_async_descriptor_done(uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    return (DMA_CHAIN_RESPONSE_PENDING != Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, descriptor));
+}
+
+/********************************************************************************
+* Function Name: dma_async_request_done
+*********************************************************************************
+* Summary:
+* Await condition: a request submitted to the DMA queue has a response.
+*
+* Parameters:
+*  request: Submitted request
+*
+* Return:
+*  bool: true once the copy completed or failed
+*
+********************************************************************************/
+__STATIC_INLINE bool dma_async_request_done(const dma_queue_request_t *request)
+{
+    return (DMA_CHAIN_RESPONSE_PENDING != request->response);
+}
+
+/********************************************************************************
+* Function Name: dma_async_uart_drained
+*********************************************************************************
+* Summary:
+* Await condition: the DMA transmitter is idle and the last byte has left the
+* UART shifter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true once the UART has nothing left to send
+*
+********************************************************************************/
+__STATIC_INLINE bool dma_async_uart_drained(void)
+{
+    return (!uart_tx_dma_is_busy() && Cy_SCB_UART_IsTxComplete(UART_HW));
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_ASYNC_H */
+
+/* [] END OF FILE */
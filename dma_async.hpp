@@ -0,0 +1,447 @@
+/******************************************************************************
+* File Name:   dma_async.hpp
+*
+* Description: Header-only C++20 coroutine layer over dma_async.h.
+*              dma::async::task is a coroutine that co_awaits DMA completions
+*              and UART drains; dma::async::scheduler resumes each suspended
+*              task once its condition holds. Coroutine frames come from a
+*              fixed pool, never from the heap. Requires a compiler with C++20
+*              coroutine support; otherwise use the DMA_ASYNC_* macros.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_ASYNC_HPP
+#define DMA_ASYNC_HPP
+
+#if !defined(__cplusplus) || !defined(__cpp_impl_coroutine)
+#error "dma_async.hpp requires C++20 coroutines; use the DMA_ASYNC_* macros of dma_async.h"
+#endif
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <cstdint>
+#include <cstddef>
+#include <coroutine>
+#include <utility>
+#include "dma_async.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Size and number of coroutine frames. A frame holds the locals that live
+ * across a co_await, the awaiter and a few words of bookkeeping. A task whose
+ * frame does not fit, or that finds the pool empty, is not created. The pool
+ * (512 bytes by default) is only linked into images that create a task. */
+#ifndef DMA_ASYNC_FRAME_SIZE
+#define DMA_ASYNC_FRAME_SIZE            128U
+#endif
+
+#ifndef DMA_ASYNC_FRAMES
+#define DMA_ASYNC_FRAMES                4U
+#endif
+
+namespace dma
+{
+namespace async
+{
+
+/********************************************************************************
+* Class Name: frame_pool
+*********************************************************************************
+* Summary:
+* Fixed pool of coroutine frames. Tasks are created and destroyed from the
+* main loop only, so the pool takes no critical section.
+*
+********************************************************************************/
+class frame_pool
+{
+public:
+    static void *allocate(std::size_t size) noexcept
+    {
+        void *frame = nullptr;
+        std::size_t i;
+
+        if (size <= DMA_ASYNC_FRAME_SIZE)
+        {
+            for (i = 0U; (i < DMA_ASYNC_FRAMES) && (nullptr == frame); i++)
+            {
+                if (!m_used[i])
+                {
+                    m_used[i] = true;
+                    frame = m_frames[i].bytes;
+                }
+            }
+        }
+
+        return frame;
+    }
+
+    static void release(void *frame) noexcept
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(frame);
+
+        m_used[static_cast<std::size_t>(bytes - m_frames[0].bytes) / sizeof(slot)] = false;
+    }
+
+private:
+    struct alignas(std::max_align_t) slot
+    {
+        unsigned char bytes[DMA_ASYNC_FRAME_SIZE];
+    };
+
+    static_assert((sizeof(slot) % alignof(std::max_align_t)) == 0U,
+                  "DMA_ASYNC_FRAME_SIZE must be a multiple of the frame alignment");
+
+    static inline slot m_frames[DMA_ASYNC_FRAMES];
+    static inline bool m_used[DMA_ASYNC_FRAMES];
+};
+
+/********************************************************************************
+* Class Name: task
+*********************************************************************************
+* Summary:
+* Coroutine returning nothing. It starts suspended and runs only from poll(),
+* which resumes it when the condition it awaits holds. A task that could not
+* get a frame is not valid() and is done() from the start. The frame is
+* released when the task object is destroyed.
+*
+********************************************************************************/
+class task
+{
+public:
+    struct promise_type
+    {
+        /* Condition of the pending co_await, or nullptr to resume on the next poll */
+        bool (*ready)(const void *awaiter) noexcept = nullptr;
+        const void *awaiter = nullptr;
+
+        task get_return_object() noexcept
+        {
+            return task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        static task get_return_object_on_allocation_failure() noexcept
+        {
+            return task();
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            /* Built without exceptions */
+            CY_ASSERT(false);
+        }
+
+        static void *operator new(std::size_t size) noexcept
+        {
+            return frame_pool::allocate(size);
+        }
+
+        static void operator delete(void *frame) noexcept
+        {
+            frame_pool::release(frame);
+        }
+    };
+
+    task() noexcept = default;
+
+    task(task &&other) noexcept :
+        m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    task &operator=(task &&other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    task(const task &) = delete;
+    task &operator=(const task &) = delete;
+
+    ~task()
+    {
+        destroy();
+    }
+
+    bool valid() const noexcept
+    {
+        return static_cast<bool>(m_handle);
+    }
+
+    bool done() const noexcept
+    {
+        return (!m_handle || m_handle.done());
+    }
+
+    /****************************************************************************
+    * Function Name: poll
+    *****************************************************************************
+    * Summary:
+    * Resumes the task if it has not started or if the condition it awaits
+    * holds. The task runs until its next co_await that is not ready.
+    *
+    * Parameters:
+    *  void
+    *
+    * Return:
+    *  bool: true while the task is not done
+    *
+    ****************************************************************************/
+    bool poll() noexcept
+    {
+        if (!done())
+        {
+            promise_type &promise = m_handle.promise();
+
+            if ((nullptr == promise.ready) || promise.ready(promise.awaiter))
+            {
+                promise.ready = nullptr;
+                m_handle.resume();
+            }
+        }
+
+        return !done();
+    }
+
+private:
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept :
+        m_handle(handle)
+    {
+    }
+
+    void destroy() noexcept
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/********************************************************************************
+* Class Name: awaiter
+*********************************************************************************
+* Summary:
+* co_await on a condition with a deadline. The task suspends until the
+* condition holds or the deadline passes; co_await returns whether the
+* condition holds, so false is a timeout. The awaiter lives in the frame
+* while the task is suspended.
+*
+* Template Parameters:
+*  Condition: Callable returning bool, without side effects
+*
+********************************************************************************/
+template <typename Condition>
+class awaiter
+{
+public:
+    awaiter(Condition condition, std::uint32_t timeoutCycles) noexcept :
+        m_condition(condition),
+        m_start(cycle_count_now()),
+        m_timeout(timeoutCycles)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return ready(this);
+    }
+
+    void await_suspend(std::coroutine_handle<task::promise_type> handle) const noexcept
+    {
+        handle.promise().ready = &ready;
+        handle.promise().awaiter = this;
+    }
+
+    bool await_resume() const noexcept
+    {
+        return m_condition();
+    }
+
+private:
+    static bool ready(const void *self) noexcept
+    {
+        const awaiter *pending = static_cast<const awaiter *>(self);
+
+        return (pending->m_condition() || cycle_count_expired(pending->m_start, pending->m_timeout));
+    }
+
+    Condition m_condition;
+    std::uint32_t m_start;
+    std::uint32_t m_timeout;
+};
+
+/* Default deadline of the awaitables, DMA_ASYNC_TIMEOUT_MS */
+inline std::uint32_t default_timeout() noexcept
+{
+    return CYCLE_COUNT_MS_TO_CYCLES(DMA_ASYNC_TIMEOUT_MS);
+}
+
+/* co_await descriptor_done(channel, descriptor): the descriptor has a response */
+inline auto descriptor_done(std::uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                            std::uint32_t timeoutCycles = default_timeout()) noexcept
+{
+    return awaiter([channel, descriptor]() noexcept { return dma_async_descriptor_done(channel, descriptor); },
+                   timeoutCycles);
+}
+
+/* co_await request_done(request): a request of the DMA queue has a response */
+inline auto request_done(const dma_queue_request_t &request,
+                         std::uint32_t timeoutCycles = default_timeout()) noexcept
+{
+    return awaiter([&request]() noexcept { return dma_async_request_done(&request); },
+                   timeoutCycles);
+}
+
+/* co_await uart_drained(): the UART has nothing left to send */
+inline auto uart_drained(std::uint32_t timeoutCycles = default_timeout()) noexcept
+{
+    return awaiter([]() noexcept { return dma_async_uart_drained(); }, timeoutCycles);
+}
+
+/* co_await yield(): lets the other tasks run once */
+inline std::suspend_always yield() noexcept
+{
+    return {};
+}
+
+/********************************************************************************
+* Class Name: scheduler
+*********************************************************************************
+* Summary:
+* Runs up to N tasks. The main loop calls poll() until it returns false. A
+* finished task keeps its slot and frame until a new task takes the slot.
+*
+* Template Parameters:
+*  N: Number of task slots
+*
+********************************************************************************/
+template <std::size_t N>
+class scheduler
+{
+public:
+    /****************************************************************************
+    * Function Name: spawn
+    *****************************************************************************
+    * Summary:
+    * Takes a task into a free slot. It first runs on the next poll().
+    *
+    * Parameters:
+    *  newTask: Task returned by a coroutine
+    *
+    * Return:
+    *  bool: false if the task has no frame or all slots hold running tasks
+    *
+    ****************************************************************************/
+    bool spawn(task &&newTask) noexcept
+    {
+        bool spawned = false;
+        std::size_t i;
+
+        if (newTask.valid())
+        {
+            for (i = 0U; (i < N) && !spawned; i++)
+            {
+                if (m_tasks[i].done())
+                {
+                    m_tasks[i] = std::move(newTask);
+                    spawned = true;
+                }
+            }
+        }
+
+        return spawned;
+    }
+
+    /****************************************************************************
+    * Function Name: poll
+    *****************************************************************************
+    * Summary:
+    * Polls every task once.
+    *
+    * Parameters:
+    *  void
+    *
+    * Return:
+    *  bool: true while a task is not done
+    *
+    ****************************************************************************/
+    bool poll() noexcept
+    {
+        bool running = false;
+        std::size_t i;
+
+        for (i = 0U; i < N; i++)
+        {
+            running = m_tasks[i].poll() || running;
+        }
+
+        return running;
+    }
+
+private:
+    task m_tasks[N];
+};
+
+} /* namespace async */
+} /* namespace dma */
+
+#endif /* DMA_ASYNC_HPP */
+
+/* [] END OF FILE */
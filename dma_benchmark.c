@@ -0,0 +1,611 @@
+/******************************************************************************
+* File Name:   dma_benchmark.c
+*
+* Description: This file contains the DMA benchmark suite. It sweeps transfer
+*              size, transfer width, descriptor chain length and trigger type,
+*              times DMA copies against CPU copies with the SysTick cycle counter
+*              and writes one CSV row per configuration to UART_HW.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "dma_benchmark.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+#include "uart_fmt.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Smallest transfer of the size sweep, in bytes */
+#define DMA_BENCHMARK_MIN_SIZE          1UL
+
+/* SRAM sources use the upper half of the destination buffer */
+#define DMA_BENCHMARK_SRAM_MAX_SIZE     (DMA_BENCHMARK_MAX_SIZE / 2UL)
+
+/* Flash sources start past the vector table of the application image */
+#define DMA_BENCHMARK_FLASH_SRC_OFFSET  0x100UL
+
+/* Longest descriptor chain of the sweep */
+#define DMA_BENCHMARK_MAX_CHAIN         8UL
+
+/* Value written to the destination before every run */
+#define DMA_BENCHMARK_FILL              0xA5U
+
+/* Number of descriptors per channel */
+#define DMA_BENCHMARK_DESCRIPTORS       2UL
+
+/* Software triggers per element after which a single-element copy stops
+ * triggering; dma_chain_wait() then bounds the wait. A counter keeps the
+ * clock out of the measured loop. */
+#define DMA_BENCHMARK_TRIGGER_LIMIT     4UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Trigger type swept by the benchmark */
+typedef struct
+{
+    cy_en_dmac_trigger_type_t type;
+    const char *name;
+} dma_benchmark_trigger_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Destination buffer. The upper half doubles as the SRAM source. The other
+ * benchmarks use it as scratch through dma_benchmark_scratch(). */
+static CY_ALIGN(4) uint8_t g_benchmarkBuffer[DMA_BENCHMARK_MAX_SIZE];
+
+/* Transfer widths of the sweep */
+static const cy_en_dmac_data_transfer_width_t g_benchmarkWidths[] =
+{
+    CY_DMAC_BYTE_BYTE,
+    CY_DMAC_HALFWORD_HALFWORD,
+    CY_DMAC_WORD_WORD
+};
+
+/* Trigger types of the sweep */
+static const dma_benchmark_trigger_t g_benchmarkTriggers[] =
+{
+    { CY_DMAC_SINGLE_ELEMENT, "element" },
+    { CY_DMAC_SINGLE_DESCR,   "descr"   },
+    { CY_DMAC_DESCR_LIST,     "list"    }
+};
+
+/* Descriptors in chain order */
+static const cy_en_dmac_descriptor_t g_benchmarkDescriptors[DMA_BENCHMARK_DESCRIPTORS] =
+{
+    CY_DMAC_DESCRIPTOR_PING,
+    CY_DMAC_DESCRIPTOR_PONG
+};
+
+/* Cost of an empty cycle_count_now() / cycle_count_elapsed() pair */
+static uint32_t g_benchmarkOverhead = 0UL;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void dma_benchmark_calibrate(void);
+static void dma_benchmark_sweep(const char *srcName, const uint8_t *src, uint32_t maxSize);
+static uint32_t dma_benchmark_dma_copy(const uint8_t *src, uint8_t *dst, uint32_t size,
+                                       cy_en_dmac_data_transfer_width_t width, uint32_t chain,
+                                       cy_en_dmac_trigger_type_t trigger);
+static uint32_t dma_benchmark_cpu_copy(const uint8_t *src, uint8_t *dst, uint32_t size,
+                                       uint32_t elementSize);
+static void dma_benchmark_report(const char *srcName, uint32_t size, uint32_t elementSize,
+                                 uint32_t chain, const char *trigger, const char *method,
+                                 uint32_t cycles, bool ok);
+
+/********************************************************************************
+* Function Name: dma_benchmark_run
+*********************************************************************************
+* Summary:
+* Runs the copy sweep for a flash source and an SRAM source and writes the
+* results as CSV. cycle_count_init() must have been called and the DMAC and
+* UART_HW must be enabled. The USER_DMA descriptors are reprogrammed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_benchmark_run(void)
+{
+    uint32_t i;
+
+    dma_benchmark_calibrate();
+
+    /* SRAM source pattern */
+    for (i = DMA_BENCHMARK_SRAM_MAX_SIZE; i < DMA_BENCHMARK_MAX_SIZE; i++)
+    {
+        g_benchmarkBuffer[i] = (uint8_t) ((i * 7UL) + 1UL);
+    }
+
+    dma_benchmark_csv_comment("dma_benchmark");
+    dma_benchmark_csv_begin("cpu_hz");
+    dma_benchmark_csv_u32(SystemCoreClock);
+    dma_benchmark_csv_end();
+
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("src");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("width");
+    dma_benchmark_csv_str("chain");
+    dma_benchmark_csv_str("trigger");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    dma_benchmark_sweep("flash",
+                        (const uint8_t *) (CY_FLASH_BASE + DMA_BENCHMARK_FLASH_SRC_OFFSET),
+                        DMA_BENCHMARK_MAX_SIZE);
+    dma_benchmark_sweep("sram", &g_benchmarkBuffer[DMA_BENCHMARK_SRAM_MAX_SIZE],
+                        DMA_BENCHMARK_SRAM_MAX_SIZE);
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_calibrate
+*********************************************************************************
+* Summary:
+* Measures the cost of reading the cycle counter so it can be subtracted from
+* every result.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_benchmark_calibrate(void)
+{
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t run;
+
+    g_benchmarkOverhead = UINT32_MAX;
+    for (run = 0UL; run < DMA_BENCHMARK_REPEAT; run++)
+    {
+        start = cycle_count_now();
+        cycles = cycle_count_elapsed(start);
+        if (cycles < g_benchmarkOverhead)
+        {
+            g_benchmarkOverhead = cycles;
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_sweep
+*********************************************************************************
+* Summary:
+* Sweeps size, width, chain length and trigger type for one source and reports
+* a CPU copy and a DMA copy for each combination.
+*
+* Parameters:
+*  srcName: Name of the source memory for the CSV output
+*  src: Source buffer, at least maxSize bytes
+*  maxSize: Largest transfer size for this source
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_benchmark_sweep(const char *srcName, const uint8_t *src, uint32_t maxSize)
+{
+    uint32_t size;
+    uint32_t w;
+    uint32_t t;
+    uint32_t chain;
+    uint32_t elementSize;
+    uint32_t cycles;
+    bool ok;
+
+    for (size = DMA_BENCHMARK_MIN_SIZE; size <= maxSize; size <<= 1U)
+    {
+        for (w = 0UL; w < (sizeof(g_benchmarkWidths) / sizeof(g_benchmarkWidths[0])); w++)
+        {
+            elementSize = dma_chain_element_size(g_benchmarkWidths[w]);
+            if (size < elementSize)
+            {
+                continue;
+            }
+
+            cycles = dma_benchmark_cpu_copy(src, g_benchmarkBuffer, size, elementSize);
+            ok = (0 == memcmp(src, g_benchmarkBuffer, size));
+            dma_benchmark_report(srcName, size, elementSize, 1UL, "-", "cpu", cycles, ok);
+
+            for (chain = 1UL; (chain <= DMA_BENCHMARK_MAX_CHAIN) && (chain <= (size / elementSize)); chain <<= 1U)
+            {
+                for (t = 0UL; t < (sizeof(g_benchmarkTriggers) / sizeof(g_benchmarkTriggers[0])); t++)
+                {
+                    cycles = dma_benchmark_dma_copy(src, g_benchmarkBuffer, size, g_benchmarkWidths[w],
+                                                    chain, g_benchmarkTriggers[t].type);
+                    ok = (0 == memcmp(src, g_benchmarkBuffer, size));
+                    dma_benchmark_report(srcName, size, elementSize, chain,
+                                         g_benchmarkTriggers[t].name, "dma", cycles, ok);
+                }
+            }
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_dma_copy
+*********************************************************************************
+* Summary:
+* Copies a buffer with a chain of equally sized descriptors and returns the
+* fastest of DMA_BENCHMARK_REPEAT runs. The time includes descriptor setup.
+*
+* The channel has two descriptors, so a chain is executed in PING/PONG pairs.
+* Within a pair, a CY_DMAC_DESCR_LIST PING continues into PONG without a new
+* trigger, as in the design's descriptor settings. CY_DMAC_SINGLE_DESCR needs
+* a trigger per descriptor and CY_DMAC_SINGLE_ELEMENT a trigger per element.
+*
+* Parameters:
+*  src: Source buffer
+*  dst: Destination buffer
+*  size: Number of bytes to copy, a multiple of the element size
+*  width: Transfer width
+*  chain: Number of descriptors the copy is split into
+*  trigger: Trigger type of the descriptors
+*
+* Return:
+*  uint32_t: CPU cycles of the fastest run
+*
+********************************************************************************/
+static uint32_t dma_benchmark_dma_copy(const uint8_t *src, uint8_t *dst, uint32_t size,
+                                       cy_en_dmac_data_transfer_width_t width, uint32_t chain,
+                                       cy_en_dmac_trigger_type_t trigger)
+{
+    dma_chain_segment_t segment;
+    uint32_t elementSize = dma_chain_element_size(width);
+    uint32_t count = size / elementSize;
+    uint32_t segmentCount = count / chain;
+    uint32_t best = UINT32_MAX;
+    uint32_t pairLength;
+    uint32_t offset;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t triggers;
+    uint32_t run;
+    uint32_t seg;
+    uint32_t i;
+
+    segment.width        = width;
+    segment.retrigger    = CY_DMAC_RETRIG_IM;
+    segment.srcIncrement = true;
+    segment.dstIncrement = true;
+    segment.interrupt    = false;
+
+    for (run = 0UL; run < DMA_BENCHMARK_REPEAT; run++)
+    {
+        (void) memset(dst, DMA_BENCHMARK_FILL, size);
+
+        start = cycle_count_now();
+
+        for (seg = 0UL; seg < chain; seg += pairLength)
+        {
+            pairLength = ((chain - seg) >= DMA_BENCHMARK_DESCRIPTORS) ? DMA_BENCHMARK_DESCRIPTORS : 1UL;
+
+            for (i = 0UL; i < pairLength; i++)
+            {
+                offset = (seg + i) * segmentCount;
+                segment.src   = &src[offset * elementSize];
+                segment.dst   = &dst[offset * elementSize];
+                segment.count = ((seg + i + 1UL) == chain) ? (count - offset) : segmentCount;
+
+                /* The last descriptor of a pair ends the list */
+                segment.triggerType = ((CY_DMAC_DESCR_LIST == trigger) && ((i + 1UL) == pairLength)) ?
+                                      CY_DMAC_SINGLE_DESCR : trigger;
+
+                (void) dma_chain_config(DMA_BENCHMARK_CHANNEL, g_benchmarkDescriptors[i], &segment);
+            }
+
+            dma_chain_start(DMA_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+
+            for (i = 0UL; i < pairLength; i++)
+            {
+                if (CY_DMAC_SINGLE_ELEMENT == trigger)
+                {
+                    triggers = DMA_BENCHMARK_TRIGGER_LIMIT * segmentCount;
+                    do
+                    {
+                        dma_chain_trigger();
+                        triggers--;
+                    } while ((DMA_CHAIN_RESPONSE_PENDING ==
+                              Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, DMA_BENCHMARK_CHANNEL,
+                                                             g_benchmarkDescriptors[i])) &&
+                             (0UL != triggers));
+                }
+                else if ((0UL == i) || (CY_DMAC_SINGLE_DESCR == trigger))
+                {
+                    dma_chain_trigger();
+                }
+                else
+                {
+                    /* PONG follows PING in the descriptor list */
+                }
+
+                (void) dma_chain_wait(DMA_BENCHMARK_CHANNEL, g_benchmarkDescriptors[i]);
+            }
+        }
+
+        cycles = cycle_count_elapsed(start) - g_benchmarkOverhead;
+        if (cycles < best)
+        {
+            best = cycles;
+        }
+    }
+
+    return best;
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_cpu_copy
+*********************************************************************************
+* Summary:
+* Copies a buffer with a CPU loop of the given element size and returns the
+* fastest of DMA_BENCHMARK_REPEAT runs.
+*
+* Parameters:
+*  src: Source buffer, aligned to the element size
+*  dst: Destination buffer, aligned to the element size
+*  size: Number of bytes to copy, a multiple of the element size
+*  elementSize: 1, 2 or 4
+*
+* Return:
+*  uint32_t: CPU cycles of the fastest run
+*
+********************************************************************************/
+static uint32_t dma_benchmark_cpu_copy(const uint8_t *src, uint8_t *dst, uint32_t size,
+                                       uint32_t elementSize)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t run;
+    uint32_t i;
+
+    for (run = 0UL; run < DMA_BENCHMARK_REPEAT; run++)
+    {
+        (void) memset(dst, DMA_BENCHMARK_FILL, size);
+
+        start = cycle_count_now();
+
+        if (4UL == elementSize)
+        {
+            const uint32_t *s = (const uint32_t *) src;
+            uint32_t *d = (uint32_t *) dst;
+            for (i = 0UL; i < (size / 4UL); i++)
+            {
+                d[i] = s[i];
+            }
+        }
+        else if (2UL == elementSize)
+        {
+            const uint16_t *s = (const uint16_t *) src;
+            uint16_t *d = (uint16_t *) dst;
+            for (i = 0UL; i < (size / 2UL); i++)
+            {
+                d[i] = s[i];
+            }
+        }
+        else
+        {
+            for (i = 0UL; i < size; i++)
+            {
+                dst[i] = src[i];
+            }
+        }
+
+        cycles = cycle_count_elapsed(start) - g_benchmarkOverhead;
+        if (cycles < best)
+        {
+            best = cycles;
+        }
+    }
+
+    return best;
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_report
+*********************************************************************************
+* Summary:
+* Writes one row of the copy sweep.
+*
+* Parameters:
+*  srcName: Source memory
+*  size: Transfer size in bytes
+*  elementSize: Element size in bytes
+*  chain: Number of descriptors
+*  trigger: Trigger type name, "-" for CPU copies
+*  method: "cpu" or "dma"
+*  cycles: Measured CPU cycles
+*  ok: Destination matched the source
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_benchmark_report(const char *srcName, uint32_t size, uint32_t elementSize,
+                                 uint32_t chain, const char *trigger, const char *method,
+                                 uint32_t cycles, bool ok)
+{
+    dma_benchmark_csv_begin("copy");
+    dma_benchmark_csv_str(srcName);
+    dma_benchmark_csv_u32(size);
+    dma_benchmark_csv_u32(elementSize);
+    dma_benchmark_csv_u32(chain);
+    dma_benchmark_csv_str(trigger);
+    dma_benchmark_csv_str(method);
+    dma_benchmark_csv_u32(cycles);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_scratch
+*********************************************************************************
+* Summary:
+* Returns the destination buffer of the sweep, so that the other benchmarks,
+* which run one after another, share it instead of allocating their own. The
+* content is undefined when a benchmark starts.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t *: DMA_BENCHMARK_MAX_SIZE bytes, 4-byte aligned
+*
+********************************************************************************/
+uint8_t *dma_benchmark_scratch(void)
+{
+    return g_benchmarkBuffer;
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_csv_comment
+*********************************************************************************
+* Summary:
+* Writes a CSV comment line ("# text"). Comments delimit benchmark sections.
+*
+* Parameters:
+*  text: Comment text
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_benchmark_csv_comment(const char *text)
+{
+    (void) uart_fmt_str("# ");
+    (void) uart_fmt_str(text);
+    (void) uart_fmt_str("\r\n");
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_csv_begin
+*********************************************************************************
+* Summary:
+* Starts a CSV row with the test name as the first field.
+*
+* Parameters:
+*  test: Test name
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_benchmark_csv_begin(const char *test)
+{
+    (void) uart_fmt_str(test);
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_csv_str
+*********************************************************************************
+* Summary:
+* Appends a string field to the current CSV row.
+*
+* Parameters:
+*  value: Field value
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_benchmark_csv_str(const char *value)
+{
+    (void) uart_fmt_str(",");
+    (void) uart_fmt_str(value);
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_csv_u32
+*********************************************************************************
+* Summary:
+* Appends an unsigned decimal field to the current CSV row.
+*
+* Parameters:
+*  value: Field value
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_benchmark_csv_u32(uint32_t value)
+{
+    char field[UART_FMT_FIELD_SIZE + 1U];
+
+    field[0] = ',';
+    (void) uart_fmt_chars(field, 1UL + uart_fmt_u32_to(&field[1], value));
+}
+
+/********************************************************************************
+* Function Name: dma_benchmark_csv_end
+*********************************************************************************
+* Summary:
+* Terminates the current CSV row.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_benchmark_csv_end(void)
+{
+    (void) uart_fmt_str("\r\n");
+    event_trace_record(EVENT_TRACE_UART_TX, Cy_SCB_UART_GetNumInTxFifo(UART_HW));
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,99 @@
+/******************************************************************************
+* File Name:   dma_benchmark.h
+*
+* Description: Public interface of the DMA benchmark suite. Results are written to
+*              UART_HW as CSV.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_BENCHMARK_H
+#define DMA_BENCHMARK_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Largest transfer of the size sweep, in bytes. The destination buffer is
+ * allocated with this size: 1 KB on devices with 8 KB of SRAM, 2 KB on
+ * larger ones. The other benchmarks share this buffer through
+ * dma_benchmark_scratch() and size their transfers to fit. */
+#ifndef DMA_BENCHMARK_MAX_SIZE
+#if defined(CY_SRAM_SIZE) && (CY_SRAM_SIZE <= 0x2000UL)
+#define DMA_BENCHMARK_MAX_SIZE          1024UL
+#else
+#define DMA_BENCHMARK_MAX_SIZE          2048UL
+#endif
+#endif
+
+/* Number of runs per configuration. The fastest run is reported. */
+#ifndef DMA_BENCHMARK_REPEAT
+#define DMA_BENCHMARK_REPEAT            4UL
+#endif
+
+/* DMAC channel used by the benchmarks */
+#define DMA_BENCHMARK_CHANNEL           USER_DMA_CHANNEL
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void dma_benchmark_run(void);
+uint8_t *dma_benchmark_scratch(void);
+
+/* CSV output shared by all benchmarks. A row is started with the test name,
+ * followed by any number of fields and terminated with dma_benchmark_csv_end(). */
+void dma_benchmark_csv_comment(const char *text);
+void dma_benchmark_csv_begin(const char *test);
+void dma_benchmark_csv_str(const char *value);
+void dma_benchmark_csv_u32(uint32_t value);
+void dma_benchmark_csv_end(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_BENCHMARK_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,567 @@
+/******************************************************************************
+* File Name:   dma_chain.c
+*
+* Description: This file contains the PING/PONG descriptor chain helpers. A
+*              descriptor is configured from the design's USER_DMA descriptor
+*              settings with the per-segment fields overridden, so settings that
+*              are not part of a segment (preemption, flipping) follow the
+*              Device Configurator.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_chain.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Completion callbacks per channel */
+static dma_chain_callback_t g_dmaChainCallbacks[DMA_CHAIN_CHANNELS];
+
+/* Trigger routes made by dma_chain_connect(), per channel */
+static dma_chain_route_t g_dmaChainRoutes[DMA_CHAIN_CHANNELS];
+
+/* DMAC interrupt configuration */
+static const cy_stc_sysint_t g_dmaChainIntrConfig =
+{
+    .intrSrc      = cpuss_interrupt_dma_IRQn,
+    .intrPriority = DMA_CHAIN_INTR_PRIORITY
+};
+
+/* The DMAC interrupt is shared by all channels and installed once */
+static bool g_dmaChainIntrInstalled = false;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static cy_en_dmac_response_t dma_chain_poll(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                            uint32_t timeoutCycles);
+static void dma_chain_isr(void);
+
+/********************************************************************************
+* Function Name: dma_chain_config
+*********************************************************************************
+* Summary:
+* Configures one descriptor of a channel for a segment and marks it valid.
+* The channel must not be executing the descriptor.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: CY_DMAC_DESCRIPTOR_PING or CY_DMAC_DESCRIPTOR_PONG
+*  segment: Segment to transfer
+*
+* Return:
+*  cy_en_dmac_status_t: Status of the descriptor initialization
+*
+********************************************************************************/
+cy_en_dmac_status_t dma_chain_config(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                     const dma_chain_segment_t *segment)
+{
+    cy_stc_dmac_descriptor_config_t config = (CY_DMAC_DESCRIPTOR_PING == descriptor) ?
+                                             USER_DMA_ping_config : USER_DMA_pong_config;
+    cy_en_dmac_status_t status;
+
+    config.dataCount         = segment->count;
+    config.dataTransferWidth = segment->width;
+    config.triggerType       = segment->triggerType;
+    config.retrigger         = segment->retrigger;
+    config.srcAddrIncrement  = segment->srcIncrement;
+    config.dstAddrIncrement  = segment->dstIncrement;
+    config.interrupt         = segment->interrupt;
+
+    status = Cy_DMAC_Descriptor_Init(USER_DMA_HW, channel, descriptor, &config);
+    if (CY_DMAC_SUCCESS == status)
+    {
+        Cy_DMAC_Descriptor_SetSrcAddress(USER_DMA_HW, channel, descriptor, segment->src);
+        Cy_DMAC_Descriptor_SetDstAddress(USER_DMA_HW, channel, descriptor, segment->dst);
+    }
+
+    return status;
+}
+
+/********************************************************************************
+* Function Name: dma_chain_start
+*********************************************************************************
+* Summary:
+* Points the channel at the descriptor that the next trigger executes.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: First descriptor of the chain
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_start(uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    Cy_DMAC_Channel_SetCurrentDescriptor(USER_DMA_HW, channel, descriptor);
+    event_trace_record(EVENT_TRACE_DMA_SELECT, EVENT_TRACE_DMA_ARG(channel, descriptor, 0UL));
+}
+
+/********************************************************************************
+* Function Name: dma_chain_trigger
+*********************************************************************************
+* Summary:
+* Generates a software trigger on the USER_DMA trigger line.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_trigger(void)
+{
+    event_trace_record(EVENT_TRACE_DMA_TRIGGER,
+                       EVENT_TRACE_DMA_ARG(USER_DMA_CHANNEL, EVENT_TRACE_DESCR_UNKNOWN, 0UL));
+    (void) Cy_TrigMux_SwTrigger(DMA_TRIGGER_SELECT, DMA_TRIGGER_ASSERT_CYCLES);
+}
+
+/********************************************************************************
+* Function Name: dma_chain_wait
+*********************************************************************************
+* Summary:
+* Waits until the descriptor reports a response, for at most
+* DMA_CHAIN_WAIT_TIMEOUT_MS.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: Descriptor to wait for
+*
+* Return:
+*  cy_en_dmac_response_t: CY_DMAC_DONE, the error response of the descriptor
+*                         or DMA_CHAIN_RESPONSE_PENDING on timeout
+*
+********************************************************************************/
+cy_en_dmac_response_t dma_chain_wait(uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    return dma_chain_poll(channel, descriptor, CYCLE_COUNT_MS_TO_CYCLES(DMA_CHAIN_WAIT_TIMEOUT_MS));
+}
+
+/********************************************************************************
+* Function Name: dma_chain_wait_timeout
+*********************************************************************************
+* Summary:
+* Waits until the descriptor reports a response or the deadline passes. On
+* any result other than DMA_CHAIN_STATUS_DONE the channel can be reset with
+* dma_chain_recover().
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: Descriptor to wait for
+*  timeoutCycles: Deadline in CPU cycles from the call
+*
+* Return:
+*  dma_chain_status_t: Completion, timeout or the error of the descriptor
+*
+********************************************************************************/
+dma_chain_status_t dma_chain_wait_timeout(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                          uint32_t timeoutCycles)
+{
+    return dma_chain_status(dma_chain_poll(channel, descriptor, timeoutCycles));
+}
+
+/********************************************************************************
+* Function Name: dma_chain_status
+*********************************************************************************
+* Summary:
+* Maps a descriptor response to a wait status. A pending response maps to
+* DMA_CHAIN_STATUS_TIMEOUT.
+*
+* Parameters:
+*  response: Descriptor response
+*
+* Return:
+*  dma_chain_status_t: Corresponding status
+*
+********************************************************************************/
+dma_chain_status_t dma_chain_status(cy_en_dmac_response_t response)
+{
+    dma_chain_status_t status;
+
+    switch (response)
+    {
+        case CY_DMAC_DONE:
+            status = DMA_CHAIN_STATUS_DONE;
+            break;
+
+        case CY_DMAC_SRC_BUS_ERROR:
+            status = DMA_CHAIN_STATUS_SRC_BUS_ERROR;
+            break;
+
+        case CY_DMAC_DST_BUS_ERROR:
+            status = DMA_CHAIN_STATUS_DST_BUS_ERROR;
+            break;
+
+        case CY_DMAC_SRC_MISAL:
+            status = DMA_CHAIN_STATUS_SRC_MISALIGNED;
+            break;
+
+        case CY_DMAC_DST_MISAL:
+            status = DMA_CHAIN_STATUS_DST_MISALIGNED;
+            break;
+
+        case CY_DMAC_INVALID_DESCR:
+            status = DMA_CHAIN_STATUS_INVALID_DESCRIPTOR;
+            break;
+
+        default:
+            status = DMA_CHAIN_STATUS_TIMEOUT;
+            break;
+    }
+
+    return status;
+}
+
+/********************************************************************************
+* Function Name: dma_chain_status_name
+*********************************************************************************
+* Summary:
+* Returns a short name of a wait status for diagnostic output.
+*
+* Parameters:
+*  status: Wait status
+*
+* Return:
+*  const char *: Name of the status
+*
+********************************************************************************/
+const char *dma_chain_status_name(dma_chain_status_t status)
+{
+    static const char * const names[] =
+    {
+        "done",
+        "timeout",
+        "source bus error",
+        "destination bus error",
+        "source misaligned",
+        "destination misaligned",
+        "invalid descriptor"
+    };
+
+    return ((uint32_t) status < (sizeof(names) / sizeof(names[0]))) ? names[status] : "unknown";
+}
+
+/********************************************************************************
+* Function Name: dma_chain_recover
+*********************************************************************************
+* Summary:
+* Resets a channel after a timeout or an error response: disables it, clears
+* both descriptors and its pending interrupt and points it at PING. This is a
+* handful of register writes, so a fault costs microseconds. The channel stays
+* disabled; the owner configures its descriptors again and enables it.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_recover(uint32_t channel)
+{
+    cy_en_dmac_descriptor_t descriptor = Cy_DMAC_Channel_GetCurrentDescriptor(USER_DMA_HW, channel);
+
+    Cy_DMAC_Channel_Disable(USER_DMA_HW, channel);
+    Cy_DMAC_Descriptor_DeInit(USER_DMA_HW, channel, CY_DMAC_DESCRIPTOR_PING);
+    Cy_DMAC_Descriptor_DeInit(USER_DMA_HW, channel, CY_DMAC_DESCRIPTOR_PONG);
+    Cy_DMAC_Channel_SetCurrentDescriptor(USER_DMA_HW, channel, CY_DMAC_DESCRIPTOR_PING);
+    Cy_DMAC_ClearInterrupt(USER_DMA_HW, 1UL << channel);
+
+    event_trace_record(EVENT_TRACE_DMA_RECOVER, EVENT_TRACE_DMA_ARG(channel, descriptor, 0UL));
+}
+
+/********************************************************************************
+* Function Name: dma_chain_element_size
+*********************************************************************************
+* Summary:
+* Returns the size of one data element for a symmetric transfer width.
+*
+* Parameters:
+*  width: Transfer width
+*
+* Return:
+*  uint32_t: Element size in bytes (source side)
+*
+********************************************************************************/
+uint32_t dma_chain_element_size(cy_en_dmac_data_transfer_width_t width)
+{
+    uint32_t size;
+
+    switch (width)
+    {
+        case CY_DMAC_WORD_BYTE:
+        case CY_DMAC_WORD_HALFWORD:
+        case CY_DMAC_WORD_WORD:
+            size = 4UL;
+            break;
+
+        case CY_DMAC_HALFWORD_BYTE:
+        case CY_DMAC_HALFWORD_HALFWORD:
+        case CY_DMAC_HALFWORD_WORD:
+            size = 2UL;
+            break;
+
+        default:
+            size = 1UL;
+            break;
+    }
+
+    return size;
+}
+
+/********************************************************************************
+* Function Name: dma_chain_get_index
+*********************************************************************************
+* Summary:
+* Returns the number of data elements the channel has transferred in its
+* current descriptor.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  uint32_t: Index of the next data element
+*
+********************************************************************************/
+uint32_t dma_chain_get_index(uint32_t channel)
+{
+    return Cy_DMAC_Channel_GetCurrentIndex(USER_DMA_HW, channel);
+}
+
+/********************************************************************************
+* Function Name: dma_chain_register_callback
+*********************************************************************************
+* Summary:
+* Registers the completion callback of a channel and enables the channel
+* interrupt. Descriptors configured with interrupt = true invoke the callback
+* when they complete. Passing NULL masks the channel interrupt. Safe to call
+* while the interrupts of other channels are enabled.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  callback: Function called from the DMAC interrupt, or NULL
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_register_callback(uint32_t channel, dma_chain_callback_t callback)
+{
+    uint32_t interruptState;
+    uint32_t mask;
+
+    /* The mask is shared by all channels: a registration from an interrupt
+     * or another task must not interleave with the read-modify-write */
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    if (!g_dmaChainIntrInstalled)
+    {
+        (void) Cy_SysInt_Init(&g_dmaChainIntrConfig, dma_chain_isr);
+        NVIC_EnableIRQ(g_dmaChainIntrConfig.intrSrc);
+        g_dmaChainIntrInstalled = true;
+    }
+
+    g_dmaChainCallbacks[channel] = callback;
+
+    Cy_DMAC_ClearInterrupt(USER_DMA_HW, 1UL << channel);
+    mask = Cy_DMAC_GetInterruptMask(USER_DMA_HW);
+    if (NULL != callback)
+    {
+        mask |= (1UL << channel);
+    }
+    else
+    {
+        mask &= ~(1UL << channel);
+    }
+    Cy_DMAC_SetInterruptMask(USER_DMA_HW, mask);
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+/********************************************************************************
+* Function Name: dma_chain_get_callback
+*********************************************************************************
+* Summary:
+* Returns the completion callback registered for a channel, so that a driver
+* that borrows the channel can restore it.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  dma_chain_callback_t: Registered callback, or NULL
+*
+********************************************************************************/
+dma_chain_callback_t dma_chain_get_callback(uint32_t channel)
+{
+    return g_dmaChainCallbacks[channel];
+}
+
+/********************************************************************************
+* Function Name: dma_chain_connect
+*********************************************************************************
+* Summary:
+* Routes a trigger multiplexer input to the trigger of a channel and records
+* the route for dma_chain_get_route().
+*
+* Parameters:
+*  channel: DMAC channel number
+*  inTrig: Trigger multiplexer input
+*  outTrig: Trigger multiplexer output of the channel
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_connect(uint32_t channel, uint32_t inTrig, uint32_t outTrig)
+{
+    (void) Cy_TrigMux_Connect(inTrig, outTrig);
+
+    g_dmaChainRoutes[channel].inTrig = inTrig;
+    g_dmaChainRoutes[channel].outTrig = outTrig;
+    g_dmaChainRoutes[channel].connected = true;
+}
+
+/********************************************************************************
+* Function Name: dma_chain_get_route
+*********************************************************************************
+* Summary:
+* Returns the last route made by dma_chain_connect() for a channel.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  route: Route, connected is false if the channel was never routed
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_chain_get_route(uint32_t channel, dma_chain_route_t *route)
+{
+    *route = g_dmaChainRoutes[channel];
+}
+
+/********************************************************************************
+* Function Name: dma_chain_poll
+*********************************************************************************
+* Summary:
+* Polls the response of a descriptor until it is set or the deadline passes.
+* The clock is read only once the first poll finds the descriptor pending.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: Descriptor to wait for
+*  timeoutCycles: Deadline in CPU cycles from the call
+*
+* Return:
+*  cy_en_dmac_response_t: Response of the descriptor, DMA_CHAIN_RESPONSE_PENDING
+*                         on timeout
+*
+********************************************************************************/
+static cy_en_dmac_response_t dma_chain_poll(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                            uint32_t timeoutCycles)
+{
+    cy_en_dmac_response_t response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, descriptor);
+    uint32_t start;
+
+    if (DMA_CHAIN_RESPONSE_PENDING == response)
+    {
+        start = cycle_count_now();
+        do
+        {
+            response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, descriptor);
+        } while ((DMA_CHAIN_RESPONSE_PENDING == response) && !cycle_count_expired(start, timeoutCycles));
+    }
+
+    if (DMA_CHAIN_RESPONSE_PENDING != response)
+    {
+        event_trace_record(EVENT_TRACE_DMA_DONE, EVENT_TRACE_DMA_ARG(channel, descriptor, response));
+    }
+
+    return response;
+}
+
+/********************************************************************************
+* Function Name: dma_chain_isr
+*********************************************************************************
+* Summary:
+* DMAC interrupt handler. Clears the pending channel interrupts and calls the
+* registered callback of each channel.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_chain_isr(void)
+{
+    uint32_t status;
+    uint32_t channel;
+
+    event_trace_record(EVENT_TRACE_ISR_ENTER, (uint32_t) cpuss_interrupt_dma_IRQn);
+
+    status = Cy_DMAC_GetInterruptStatusMasked(USER_DMA_HW);
+    Cy_DMAC_ClearInterrupt(USER_DMA_HW, status);
+
+    for (channel = 0UL; (0UL != status) && (channel < DMA_CHAIN_CHANNELS); channel++)
+    {
+        if (0UL != (status & (1UL << channel)))
+        {
+            event_trace_record(EVENT_TRACE_DMA_DONE,
+                               EVENT_TRACE_DMA_ARG(channel, EVENT_TRACE_DESCR_UNKNOWN, CY_DMAC_DONE));
+
+            if (NULL != g_dmaChainCallbacks[channel])
+            {
+                g_dmaChainCallbacks[channel](channel);
+            }
+        }
+        status &= ~(1UL << channel);
+    }
+
+    event_trace_record(EVENT_TRACE_ISR_EXIT, (uint32_t) cpuss_interrupt_dma_IRQn);
+}
+
+/* [] END OF FILE */
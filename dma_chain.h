@@ -0,0 +1,161 @@
+/******************************************************************************
+* File Name:   dma_chain.h
+*
+* Description: Public interface of the PING/PONG descriptor chain helpers shared
+*              by the demo, the benchmarks and the transfer engines.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_CHAIN_H
+#define DMA_CHAIN_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMA channel trigger select line */
+#define DMA_TRIGGER_SELECT              TRIG0_OUT_CPUSS_DMAC_TR_IN0
+
+/* DMA Channel Trigger Group */
+#define DMA_TRIGGER_ASSERT_CYCLES       CY_DMAC_RETRIG_4CYC
+
+/* Descriptor response value while the descriptor has not finished */
+#define DMA_CHAIN_RESPONSE_PENDING      ((cy_en_dmac_response_t) 0UL)
+
+/* Priority of the DMAC interrupt */
+#define DMA_CHAIN_INTR_PRIORITY         1UL
+
+/* Number of DMAC channels */
+#define DMA_CHAIN_CHANNELS              CPUSS_DMAC_CH_NR
+
+/* Trigger multiplexer inputs of the TX and RX requests of an SCB instance, so
+ * that the defaults follow the design aliases (UART_HW, SPI_HW) instead of a
+ * fixed SCB number. Only SCB0 and SCB1 are mapped; define the trigger macros
+ * of the driver directly for any other instance. */
+#if defined(SCB1)
+#define DMA_CHAIN_SCB_TX_TRIGGER(base)  ((SCB1 == (base)) ? (uint32_t) TRIG0_IN_SCB1_TR_TX_REQ : \
+                                                            (uint32_t) TRIG0_IN_SCB0_TR_TX_REQ)
+#define DMA_CHAIN_SCB_RX_TRIGGER(base)  ((SCB1 == (base)) ? (uint32_t) TRIG0_IN_SCB1_TR_RX_REQ : \
+                                                            (uint32_t) TRIG0_IN_SCB0_TR_RX_REQ)
+#else
+#define DMA_CHAIN_SCB_TX_TRIGGER(base)  ((uint32_t) TRIG0_IN_SCB0_TR_TX_REQ)
+#define DMA_CHAIN_SCB_RX_TRIGGER(base)  ((uint32_t) TRIG0_IN_SCB0_TR_RX_REQ)
+#endif
+
+/* Bound of dma_chain_wait(). Longer than the largest descriptor of the
+ * benchmarks; a descriptor that has not responded by then never will. */
+#ifndef DMA_CHAIN_WAIT_TIMEOUT_MS
+#define DMA_CHAIN_WAIT_TIMEOUT_MS       100UL
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* One segment of a descriptor chain */
+typedef struct
+{
+    const void *src;                            /* Source address */
+    void *dst;                                  /* Destination address */
+    uint32_t count;                             /* Number of data elements, 1..65536 */
+    cy_en_dmac_data_transfer_width_t width;     /* Source and destination width */
+    cy_en_dmac_trigger_type_t triggerType;      /* Work done per trigger */
+    cy_en_dmac_retrigger_t retrigger;           /* Trigger deactivation */
+    bool srcIncrement;                          /* Increment source per element */
+    bool dstIncrement;                          /* Increment destination per element */
+    bool interrupt;                             /* Raise channel interrupt on completion */
+} dma_chain_segment_t;
+
+/* Result of a bounded wait. Each DMAC error response has its own value. */
+typedef enum
+{
+    DMA_CHAIN_STATUS_DONE = 0,              /* Descriptor completed */
+    DMA_CHAIN_STATUS_TIMEOUT,               /* No response before the deadline */
+    DMA_CHAIN_STATUS_SRC_BUS_ERROR,         /* Bus error on a source read */
+    DMA_CHAIN_STATUS_DST_BUS_ERROR,         /* Bus error on a destination write */
+    DMA_CHAIN_STATUS_SRC_MISALIGNED,        /* Source address not aligned to the width */
+    DMA_CHAIN_STATUS_DST_MISALIGNED,        /* Destination address not aligned to the width */
+    DMA_CHAIN_STATUS_INVALID_DESCRIPTOR     /* Descriptor executed while not valid */
+} dma_chain_status_t;
+
+/* Channel completion callback, called from the DMAC interrupt */
+typedef void (*dma_chain_callback_t)(uint32_t channel);
+
+/* Trigger route of a channel */
+typedef struct
+{
+    uint32_t inTrig;                            /* Trigger multiplexer input */
+    uint32_t outTrig;                           /* Trigger multiplexer output */
+    bool connected;                             /* Route has been made */
+} dma_chain_route_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+cy_en_dmac_status_t dma_chain_config(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                     const dma_chain_segment_t *segment);
+void dma_chain_start(uint32_t channel, cy_en_dmac_descriptor_t descriptor);
+void dma_chain_trigger(void);
+cy_en_dmac_response_t dma_chain_wait(uint32_t channel, cy_en_dmac_descriptor_t descriptor);
+dma_chain_status_t dma_chain_wait_timeout(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                          uint32_t timeoutCycles);
+dma_chain_status_t dma_chain_status(cy_en_dmac_response_t response);
+const char *dma_chain_status_name(dma_chain_status_t status);
+void dma_chain_recover(uint32_t channel);
+uint32_t dma_chain_element_size(cy_en_dmac_data_transfer_width_t width);
+void dma_chain_register_callback(uint32_t channel, dma_chain_callback_t callback);
+dma_chain_callback_t dma_chain_get_callback(uint32_t channel);
+void dma_chain_connect(uint32_t channel, uint32_t inTrig, uint32_t outTrig);
+void dma_chain_get_route(uint32_t channel, dma_chain_route_t *route);
+uint32_t dma_chain_get_index(uint32_t channel);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_CHAIN_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,508 @@
+/******************************************************************************
+* File Name:   dma_chain_image.hpp
+*
+* Description: Compile-time descriptor chains. dma::chain() evaluates a chain
+*              described in source to a register image: the SRC, DST and CTL words
+*              of each descriptor. Declared constexpr, the image is placed in flash
+*              and an invalid chain fails to compile; arm() writes it to a channel
+*              with four stores per descriptor instead of a PDL call per descriptor.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_CHAIN_IMAGE_HPP
+#define DMA_CHAIN_IMAGE_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "dma_chain_image.hpp requires C++17"
+#endif
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <cstdint>
+#include <cstddef>
+#include "dma_chain.h"
+
+namespace dma
+{
+
+/*******************************************************************************
+* Compile-time errors
+********************************************************************************/
+
+/* Never defined. A chain that calls one of these cannot be evaluated at
+ * compile time, so the compiler names the rule the chain breaks. */
+namespace chain_error
+{
+void count_out_of_range();
+void width_not_encodable();
+void source_misaligned();
+void destination_misaligned();
+void source_out_of_bounds();
+void destination_out_of_bounds();
+void descriptor_list_at_end();
+}
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* One end of a segment. Memory objects are kept as pointers, so their
+ * addresses stay constant expressions; registers are kept as addresses. */
+struct Endpoint
+{
+    const volatile void *pointer;   /* Memory object, nullptr for a register */
+    std::uint32_t address;          /* Register address, 0 for a memory object */
+    std::uint32_t size;             /* Bytes that may be accessed from the start */
+    std::uint32_t element;          /* Natural access size in bytes */
+    std::uint32_t alignment;        /* Guaranteed alignment in bytes */
+    bool increment;                 /* Increment the address per element */
+};
+
+/* Register words of one descriptor */
+struct DescriptorImage
+{
+    Endpoint src;
+    Endpoint dst;
+    std::uint32_t ctl;
+};
+
+/* Register image of a chain of one or two descriptors, PING first */
+template <std::size_t N>
+struct ChainImage
+{
+    DescriptorImage descriptors[N];
+
+    /* Number of descriptors */
+    static constexpr std::size_t size = N;
+
+    /****************************************************************************
+    * Function Name: arm
+    *****************************************************************************
+    * Summary:
+    * Writes the descriptors to a channel, marks them valid and points the
+    * channel at PING. The channel must not be executing a descriptor.
+    *
+    * Parameters:
+    *  channel: DMAC channel number
+    *
+    * Return:
+    *  void
+    *
+    ****************************************************************************/
+    void arm(std::uint32_t channel) const noexcept
+    {
+        write(channel, CY_DMAC_DESCRIPTOR_PING, descriptors[0]);
+        if constexpr (N > 1U)
+        {
+            write(channel, CY_DMAC_DESCRIPTOR_PONG, descriptors[1]);
+        }
+        Cy_DMAC_Channel_SetCurrentDescriptor(USER_DMA_HW, channel, CY_DMAC_DESCRIPTOR_PING);
+    }
+
+private:
+    static std::uint32_t resolve(const Endpoint &endpoint) noexcept
+    {
+        /* One of the two is zero */
+        return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(endpoint.pointer)) +
+               endpoint.address;
+    }
+
+    static void write(std::uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                      const DescriptorImage &image) noexcept
+    {
+        if (CY_DMAC_DESCRIPTOR_PING == descriptor)
+        {
+            DMAC_DESCR_PING_SRC(USER_DMA_HW, channel)    = resolve(image.src);
+            DMAC_DESCR_PING_DST(USER_DMA_HW, channel)    = resolve(image.dst);
+            DMAC_DESCR_PING_CTL(USER_DMA_HW, channel)    = image.ctl;
+            DMAC_DESCR_PING_STATUS(USER_DMA_HW, channel) = DMAC_DESCR_PING_STATUS_VALID_Msk;
+        }
+        else
+        {
+            DMAC_DESCR_PONG_SRC(USER_DMA_HW, channel)    = resolve(image.src);
+            DMAC_DESCR_PONG_DST(USER_DMA_HW, channel)    = resolve(image.dst);
+            DMAC_DESCR_PONG_CTL(USER_DMA_HW, channel)    = image.ctl;
+            DMAC_DESCR_PONG_STATUS(USER_DMA_HW, channel) = DMAC_DESCR_PONG_STATUS_VALID_Msk;
+        }
+    }
+};
+
+/********************************************************************************
+* Class Name: Segment
+*********************************************************************************
+* Summary:
+* Description of one descriptor. The setters return a modified copy, so a
+* segment is written as one expression:
+*
+*   dma::copy(dma::memory(g_table), dma::reg(UART_TX_FIFO_ADDRESS))
+*       .count(16UL).trigger(CY_DMAC_SINGLE_ELEMENT).interrupt()
+*
+* The count defaults to the elements of the smaller incrementing endpoint
+* and the width to the element sizes of the endpoints (4 for a register).
+*
+********************************************************************************/
+class Segment
+{
+public:
+    constexpr Segment(const Endpoint &src, const Endpoint &dst) noexcept :
+        m_src(src),
+        m_dst(dst),
+        m_count(0UL),
+        m_width(CY_DMAC_BYTE_BYTE),
+        m_widthSet(false),
+        m_trigger(CY_DMAC_SINGLE_DESCR),
+        m_retrigger(CY_DMAC_RETRIG_IM),
+        m_interrupt(false)
+    {
+    }
+
+    constexpr Segment count(std::uint32_t elements) const noexcept
+    {
+        Segment segment = *this;
+        segment.m_count = elements;
+        return segment;
+    }
+
+    constexpr Segment width(cy_en_dmac_data_transfer_width_t width) const noexcept
+    {
+        Segment segment = *this;
+        segment.m_width = width;
+        segment.m_widthSet = true;
+        return segment;
+    }
+
+    constexpr Segment trigger(cy_en_dmac_trigger_type_t trigger) const noexcept
+    {
+        Segment segment = *this;
+        segment.m_trigger = trigger;
+        return segment;
+    }
+
+    constexpr Segment retrigger(cy_en_dmac_retrigger_t retrigger) const noexcept
+    {
+        Segment segment = *this;
+        segment.m_retrigger = retrigger;
+        return segment;
+    }
+
+    constexpr Segment interrupt(bool enable = true) const noexcept
+    {
+        Segment segment = *this;
+        segment.m_interrupt = enable;
+        return segment;
+    }
+
+    /****************************************************************************
+    * Function Name: image
+    *****************************************************************************
+    * Summary:
+    * Validates the segment and encodes its descriptor. The descriptor moves
+    * to the other descriptor and becomes invalid on completion, as the
+    * USER_DMA descriptors of the design do.
+    *
+    * Parameters:
+    *  last: The segment ends the chain
+    *
+    * Return:
+    *  DescriptorImage: Register words of the descriptor
+    *
+    ****************************************************************************/
+    constexpr DescriptorImage image(bool last) const
+    {
+        const std::uint32_t count = elements();
+        const cy_en_dmac_data_transfer_width_t width = m_widthSet ? m_width : deduced_width();
+        const std::uint32_t srcSize = source_size(width);
+        const std::uint32_t dstSize = destination_size(width);
+        const std::uint32_t dataSize = (srcSize < dstSize) ? srcSize : dstSize;
+
+        if ((count < 1UL) || (count > 65536UL))
+        {
+            chain_error::count_out_of_range();
+        }
+        if ((0UL == srcSize) || (0UL == dstSize) || ((2UL == srcSize) && (1UL == dstSize)) ||
+            ((1UL == srcSize) && (2UL == dstSize)))
+        {
+            /* Transfer sizes are the data size or a word */
+            chain_error::width_not_encodable();
+        }
+        if (m_src.alignment < srcSize)
+        {
+            chain_error::source_misaligned();
+        }
+        if (m_dst.alignment < dstSize)
+        {
+            chain_error::destination_misaligned();
+        }
+        if (extent(m_src, count, srcSize) > m_src.size)
+        {
+            chain_error::source_out_of_bounds();
+        }
+        if (extent(m_dst, count, dstSize) > m_dst.size)
+        {
+            chain_error::destination_out_of_bounds();
+        }
+        if (last && (CY_DMAC_DESCR_LIST == m_trigger))
+        {
+            /* The next descriptor would be the invalidated PING */
+            chain_error::descriptor_list_at_end();
+        }
+
+        const std::uint32_t ctl = _VAL2FLD(DMAC_DESCR_PING_CTL_DATA_CNT, count - 1UL) |
+                                  _VAL2FLD(DMAC_DESCR_PING_CTL_DATA_SIZE, size_code(dataSize)) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_SRC_TRANSFER_SIZE, srcSize > dataSize) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_DST_TRANSFER_SIZE, dstSize > dataSize) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_SRC_ADDR_INCR, m_src.increment) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_DST_ADDR_INCR, m_dst.increment) |
+                                  _VAL2FLD(DMAC_DESCR_PING_CTL_WAIT_FOR_DEACT, static_cast<std::uint32_t>(m_retrigger)) |
+                                  _VAL2FLD(DMAC_DESCR_PING_CTL_DATA_TRANSFER_MODE, static_cast<std::uint32_t>(m_trigger)) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_INTR_OUT, m_interrupt) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_FLIPPING, true) |
+                                  _BOOL2FLD(DMAC_DESCR_PING_CTL_INVALIDATE, true);
+
+        return DescriptorImage{ m_src, m_dst, ctl };
+    }
+
+private:
+    constexpr std::uint32_t elements() const noexcept
+    {
+        std::uint32_t count = m_count;
+
+        if ((0UL == count) && m_src.increment && m_dst.increment)
+        {
+            count = ((m_src.size / m_src.element) < (m_dst.size / m_dst.element)) ?
+                    (m_src.size / m_src.element) : (m_dst.size / m_dst.element);
+        }
+        else if ((0UL == count) && (m_src.increment || m_dst.increment))
+        {
+            count = m_src.increment ? (m_src.size / m_src.element) : (m_dst.size / m_dst.element);
+        }
+        else
+        {
+            /* Set explicitly, or both ends fixed and the count must be set */
+        }
+
+        return count;
+    }
+
+    constexpr cy_en_dmac_data_transfer_width_t deduced_width() const noexcept
+    {
+        const std::uint32_t src = m_src.element;
+        const std::uint32_t dst = m_dst.element;
+        cy_en_dmac_data_transfer_width_t width = CY_DMAC_BYTE_BYTE;
+
+        if (4UL == src)
+        {
+            width = (4UL == dst) ? CY_DMAC_WORD_WORD : ((2UL == dst) ? CY_DMAC_WORD_HALFWORD : CY_DMAC_WORD_BYTE);
+        }
+        else if (2UL == src)
+        {
+            width = (4UL == dst) ? CY_DMAC_HALFWORD_WORD : ((2UL == dst) ? CY_DMAC_HALFWORD_HALFWORD : CY_DMAC_HALFWORD_BYTE);
+        }
+        else
+        {
+            width = (4UL == dst) ? CY_DMAC_BYTE_WORD : ((2UL == dst) ? CY_DMAC_BYTE_HALFWORD : CY_DMAC_BYTE_BYTE);
+        }
+
+        return width;
+    }
+
+    static constexpr std::uint32_t source_size(cy_en_dmac_data_transfer_width_t width) noexcept
+    {
+        std::uint32_t size = 0UL;
+
+        switch (width)
+        {
+            case CY_DMAC_BYTE_BYTE:
+            case CY_DMAC_BYTE_HALFWORD:
+            case CY_DMAC_BYTE_WORD:
+                size = 1UL;
+                break;
+
+            case CY_DMAC_HALFWORD_BYTE:
+            case CY_DMAC_HALFWORD_HALFWORD:
+            case CY_DMAC_HALFWORD_WORD:
+                size = 2UL;
+                break;
+
+            case CY_DMAC_WORD_BYTE:
+            case CY_DMAC_WORD_HALFWORD:
+            case CY_DMAC_WORD_WORD:
+                size = 4UL;
+                break;
+
+            default:
+                break;
+        }
+
+        return size;
+    }
+
+    static constexpr std::uint32_t destination_size(cy_en_dmac_data_transfer_width_t width) noexcept
+    {
+        std::uint32_t size = 0UL;
+
+        switch (width)
+        {
+            case CY_DMAC_BYTE_BYTE:
+            case CY_DMAC_HALFWORD_BYTE:
+            case CY_DMAC_WORD_BYTE:
+                size = 1UL;
+                break;
+
+            case CY_DMAC_BYTE_HALFWORD:
+            case CY_DMAC_HALFWORD_HALFWORD:
+            case CY_DMAC_WORD_HALFWORD:
+                size = 2UL;
+                break;
+
+            case CY_DMAC_BYTE_WORD:
+            case CY_DMAC_HALFWORD_WORD:
+            case CY_DMAC_WORD_WORD:
+                size = 4UL;
+                break;
+
+            default:
+                break;
+        }
+
+        return size;
+    }
+
+    /* DATA_SIZE field: 0 byte, 1 halfword, 2 word */
+    static constexpr std::uint32_t size_code(std::uint32_t size) noexcept
+    {
+        return (4UL == size) ? 2UL : ((2UL == size) ? 1UL : 0UL);
+    }
+
+    /* Bytes from the start of an endpoint that the segment touches */
+    static constexpr std::uint32_t extent(const Endpoint &endpoint, std::uint32_t count,
+                                          std::uint32_t size) noexcept
+    {
+        return endpoint.increment ? (count * size) : size;
+    }
+
+    Endpoint m_src;
+    Endpoint m_dst;
+    std::uint32_t m_count;
+    cy_en_dmac_data_transfer_width_t m_width;
+    bool m_widthSet;
+    cy_en_dmac_trigger_type_t m_trigger;
+    cy_en_dmac_retrigger_t m_retrigger;
+    bool m_interrupt;
+};
+
+/*******************************************************************************
+* Builders
+********************************************************************************/
+
+/* Array in memory: size, element size and alignment come from the type */
+template <typename T, std::size_t N>
+constexpr Endpoint memory(T (&array)[N]) noexcept
+{
+    return Endpoint{ array, 0UL, static_cast<std::uint32_t>(N * sizeof(T)),
+                     static_cast<std::uint32_t>(sizeof(T)), static_cast<std::uint32_t>(alignof(T)), true };
+}
+
+/* Single object in memory */
+template <typename T>
+constexpr Endpoint object(T &value) noexcept
+{
+    return Endpoint{ &value, 0UL, static_cast<std::uint32_t>(sizeof(T)),
+                     static_cast<std::uint32_t>(sizeof(T)), static_cast<std::uint32_t>(alignof(T)), true };
+}
+
+/* 32-bit peripheral register, e.g. a FIFO; the address is not incremented */
+constexpr Endpoint reg(std::uint32_t address) noexcept
+{
+    const std::uint32_t alignment = (0UL == (address & 3UL)) ? 4UL : ((0UL == (address & 1UL)) ? 2UL : 1UL);
+
+    return Endpoint{ nullptr, address, 4UL, 4UL, alignment, false };
+}
+
+/* The same address for every element, e.g. a fill value */
+constexpr Endpoint fixed(Endpoint endpoint) noexcept
+{
+    endpoint.increment = false;
+    return endpoint;
+}
+
+constexpr Segment copy(const Endpoint &src, const Endpoint &dst) noexcept
+{
+    return Segment(src, dst);
+}
+
+/********************************************************************************
+* Function Name: chain
+*********************************************************************************
+* Summary:
+* Evaluates one or two segments to a register image. Use it to initialize a
+* constexpr object so that the checks run at compile time:
+*
+*   constexpr auto g_route = dma::chain(
+*       dma::copy(dma::memory(g_src1), dma::memory(g_dst1)).trigger(CY_DMAC_DESCR_LIST),
+*       dma::copy(dma::memory(g_src2), dma::memory(g_dst2)).interrupt());
+*
+*   g_route.arm(USER_DMA_CHANNEL);
+*
+* Parameters:
+*  segments: PING segment, then the optional PONG segment
+*
+* Return:
+*  ChainImage: Register image of the chain
+*
+********************************************************************************/
+template <typename... Segments>
+constexpr ChainImage<sizeof...(Segments)> chain(const Segments &... segments)
+{
+    static_assert((sizeof...(Segments) >= 1U) && (sizeof...(Segments) <= 2U),
+                  "a channel has two descriptors: PING and PONG");
+
+    const Segment list[] = { segments... };
+    ChainImage<sizeof...(Segments)> image{};
+
+    for (std::size_t i = 0U; i < sizeof...(Segments); i++)
+    {
+        image.descriptors[i] = list[i].image((i + 1U) == sizeof...(Segments));
+    }
+
+    return image;
+}
+
+} /* namespace dma */
+
+#endif /* DMA_CHAIN_IMAGE_HPP */
+
+/* [] END OF FILE */
@@ -0,0 +1,441 @@
+/******************************************************************************
+* File Name:   dma_fill.c
+*
+* Description: This file contains the DMA fill engine. The DMAC writes a single
+*              source word without incrementing the source address, one word per
+*              element, over the word-aligned body of the region. The CPU writes
+*              the unaligned head bytes, and a byte-wide descriptor reading the
+*              pattern word writes the tail. Bodies longer than one descriptor
+*              are split into PING/PONG descriptor lists.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "dma_fill.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Largest element count of a descriptor */
+#define DMA_FILL_MAX_COUNT              65536UL
+
+/* Byte lane of an address within a word */
+#define DMA_FILL_LANE_MASK              3UL
+
+/* Pattern with every byte set to a value */
+#define DMA_FILL_REPLICATE(value)       ((uint32_t) (value) * 0x01010101UL)
+
+/* Number of descriptors per channel */
+#define DMA_FILL_DESCRIPTORS            2UL
+
+/* Smallest fill, number of runs per fill and destination offsets of the
+ * benchmark */
+#define DMA_FILL_BENCHMARK_MIN_SIZE     16UL
+#define DMA_FILL_BENCHMARK_REPEAT       4UL
+#define DMA_FILL_BENCHMARK_OFFSETS      { 0UL, 1UL, 3UL }
+
+/* Benchmark fill value and the value of the bytes around the fill */
+#define DMA_FILL_BENCHMARK_VALUE        0x5AU
+#define DMA_FILL_BENCHMARK_GUARD        0xC3U
+
+/* Benchmark buffer: the largest fill, the largest offset and a guard word */
+#define DMA_FILL_BENCHMARK_BUFFER_SIZE  (DMA_FILL_BENCHMARK_MAX_SIZE + 8UL)
+
+#if (DMA_FILL_BENCHMARK_BUFFER_SIZE > DMA_BENCHMARK_MAX_SIZE)
+#error "DMA_FILL_BENCHMARK_MAX_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Source word of the DMA fill */
+static CY_ALIGN(4) uint32_t g_fillPattern = 0UL;
+
+/* Descriptors in chain order */
+static const cy_en_dmac_descriptor_t g_fillDescriptors[DMA_FILL_DESCRIPTORS] =
+{
+    CY_DMAC_DESCRIPTOR_PING,
+    CY_DMAC_DESCRIPTOR_PONG
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void dma_fill_cpu(uint8_t *dst, uint32_t pattern, uint32_t size);
+static bool dma_fill_dma(uint8_t *dst, uint32_t pattern, uint32_t size);
+static void dma_fill_segment(uint32_t piece, uint32_t words, uint32_t tail, uint8_t *body,
+                             dma_chain_segment_t *segment);
+static bool dma_fill_benchmark_check(const uint8_t *buffer, uint32_t offset, uint32_t size);
+
+/********************************************************************************
+* Function Name: dma_fill
+*********************************************************************************
+* Summary:
+* Sets every byte of a region to a value, like memset(). Regions shorter
+* than DMA_FILL_THRESHOLD are filled by the CPU. The DMAC must be enabled.
+* The DMA_FILL_CHANNEL descriptors are reprogrammed.
+*
+* Parameters:
+*  dst: Start of the region, any alignment
+*  value: Byte value
+*  size: Size in bytes
+*
+* Return:
+*  bool: true if the region was filled, false if a descriptor failed; the
+*        channel is then reset
+*
+********************************************************************************/
+bool dma_fill(void *dst, uint8_t value, uint32_t size)
+{
+    return dma_fill_pattern(dst, DMA_FILL_REPLICATE(value), size);
+}
+
+/********************************************************************************
+* Function Name: dma_fill_pattern
+*********************************************************************************
+* Summary:
+* Fills a region with a word pattern. Every aligned word of the region is
+* set to the pattern, and a head or tail byte gets the pattern byte of its
+* lane (address modulo 4, little-endian), so a region reads as the repeated
+* pattern from its first aligned word on.
+*
+* Parameters:
+*  dst: Start of the region, any alignment
+*  pattern: Word pattern
+*  size: Size in bytes
+*
+* Return:
+*  bool: true if the region was filled, false if a descriptor failed; the
+*        channel is then reset
+*
+********************************************************************************/
+bool dma_fill_pattern(void *dst, uint32_t pattern, uint32_t size)
+{
+    bool ok = true;
+
+    if (size < DMA_FILL_THRESHOLD)
+    {
+        dma_fill_cpu((uint8_t *) dst, pattern, size);
+    }
+    else
+    {
+        ok = dma_fill_dma((uint8_t *) dst, pattern, size);
+    }
+
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: dma_fill_cpu
+*********************************************************************************
+* Summary:
+* Fills a region with the CPU: memset() for a replicated byte, otherwise a
+* byte loop with the lane of each address.
+*
+* Parameters:
+*  dst: Start of the region
+*  pattern: Word pattern
+*  size: Size in bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_fill_cpu(uint8_t *dst, uint32_t pattern, uint32_t size)
+{
+    uint32_t lane = (uint32_t) (uintptr_t) dst;
+    uint32_t i;
+
+    if (DMA_FILL_REPLICATE(pattern & 0xFFUL) == pattern)
+    {
+        (void) memset(dst, (int) (pattern & 0xFFUL), size);
+    }
+    else
+    {
+        for (i = 0UL; i < size; i++)
+        {
+            dst[i] = (uint8_t) (pattern >> (((lane + i) & DMA_FILL_LANE_MASK) * 8UL));
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: dma_fill_dma
+*********************************************************************************
+* Summary:
+* Fills a region with the DMAC. The CPU writes the up to three bytes before
+* the first aligned word. The body is split into pieces of at most
+* DMA_FILL_MAX_COUNT words, followed by a piece for the up to three tail
+* bytes, and the pieces run in PING/PONG pairs: PING continues into PONG
+* without a new trigger, as in the design's descriptor settings.
+*
+* Parameters:
+*  dst: Start of the region
+*  pattern: Word pattern
+*  size: Size in bytes
+*
+* Return:
+*  bool: true if the region was filled
+*
+********************************************************************************/
+static bool dma_fill_dma(uint8_t *dst, uint32_t pattern, uint32_t size)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(DMA_FILL_TIMEOUT_MS);
+    uint32_t head = (0UL - (uint32_t) (uintptr_t) dst) & DMA_FILL_LANE_MASK;
+    dma_chain_segment_t segment;
+    dma_chain_status_t status = DMA_CHAIN_STATUS_DONE;
+    uint32_t words;
+    uint32_t tail;
+    uint32_t pieces;
+    uint32_t pairLength = 0UL;
+    uint32_t piece;
+    uint32_t i;
+    bool ok = true;
+
+    if (head > size)
+    {
+        head = size;
+    }
+    dma_fill_cpu(dst, pattern, head);
+
+    words = (size - head) / 4UL;
+    tail = (size - head) & DMA_FILL_LANE_MASK;
+    pieces = (((words + DMA_FILL_MAX_COUNT) - 1UL) / DMA_FILL_MAX_COUNT) + ((0UL != tail) ? 1UL : 0UL);
+
+    g_fillPattern = pattern;
+
+    for (piece = 0UL; (piece < pieces) && (DMA_CHAIN_STATUS_DONE == status); piece += pairLength)
+    {
+        pairLength = ((pieces - piece) >= DMA_FILL_DESCRIPTORS) ? DMA_FILL_DESCRIPTORS : 1UL;
+
+        for (i = 0UL; i < pairLength; i++)
+        {
+            dma_fill_segment(piece + i, words, tail, &dst[head], &segment);
+
+            /* The last descriptor of a pair ends the list */
+            segment.triggerType = ((i + 1UL) == pairLength) ? CY_DMAC_SINGLE_DESCR : CY_DMAC_DESCR_LIST;
+            (void) dma_chain_config(DMA_FILL_CHANNEL, g_fillDescriptors[i], &segment);
+        }
+
+        dma_chain_start(DMA_FILL_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        dma_chain_trigger();
+        status = dma_chain_wait_timeout(DMA_FILL_CHANNEL, g_fillDescriptors[pairLength - 1UL], timeout);
+    }
+
+    if (DMA_CHAIN_STATUS_DONE != status)
+    {
+        dma_chain_recover(DMA_FILL_CHANNEL);
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, DMA_FILL_CHANNEL);
+        ok = false;
+    }
+
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: dma_fill_segment
+*********************************************************************************
+* Summary:
+* Describes one piece of the fill. Body pieces write the pattern word
+* without incrementing the source. The tail piece starts at an aligned
+* address, so it reads the pattern bytes of lanes 0 to 2 in order.
+*
+* Parameters:
+*  piece: Index of the piece
+*  words: Number of body words
+*  tail: Number of tail bytes
+*  body: First aligned address of the region
+*  segment: Segment to set up; the trigger type is set by the caller
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_fill_segment(uint32_t piece, uint32_t words, uint32_t tail, uint8_t *body,
+                             dma_chain_segment_t *segment)
+{
+    uint32_t offset = piece * DMA_FILL_MAX_COUNT;
+
+    segment->src          = &g_fillPattern;
+    segment->dst          = &body[offset * 4UL];
+    segment->retrigger    = CY_DMAC_RETRIG_IM;
+    segment->dstIncrement = true;
+    segment->interrupt    = false;
+
+    if (offset < words)
+    {
+        segment->count        = ((words - offset) < DMA_FILL_MAX_COUNT) ? (words - offset) : DMA_FILL_MAX_COUNT;
+        segment->width        = CY_DMAC_WORD_WORD;
+        segment->srcIncrement = false;
+    }
+    else
+    {
+        /* Tail: the body ends at an aligned address */
+        segment->dst          = &body[words * 4UL];
+        segment->count        = tail;
+        segment->width        = CY_DMAC_BYTE_BYTE;
+        segment->srcIncrement = true;
+    }
+}
+
+/********************************************************************************
+* Function Name: dma_fill_benchmark_run
+*********************************************************************************
+* Summary:
+* Fills regions of DMA_FILL_BENCHMARK_MIN_SIZE to DMA_FILL_BENCHMARK_MAX_SIZE
+* bytes at several alignments with the library memset() and with the DMAC,
+* and writes the fastest of DMA_FILL_BENCHMARK_REPEAT runs as CSV. The DMA
+* rows bypass DMA_FILL_THRESHOLD, so the crossover can be read from them.
+* ok checks the region and the bytes around it. The cycle counter, the DMAC
+* and UART_HW must be enabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_fill_benchmark_run(void)
+{
+    static const uint32_t offsets[] = DMA_FILL_BENCHMARK_OFFSETS;
+    uint8_t *buffer = dma_benchmark_scratch();
+    uint32_t size;
+    uint32_t o;
+    uint32_t m;
+    uint32_t run;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t best;
+    uint8_t *dst;
+    bool ok;
+
+    dma_benchmark_csv_comment("dma_fill");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("offset");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (size = DMA_FILL_BENCHMARK_MIN_SIZE; size <= DMA_FILL_BENCHMARK_MAX_SIZE; size <<= 1U)
+    {
+        for (o = 0UL; o < (sizeof(offsets) / sizeof(offsets[0])); o++)
+        {
+            dst = &buffer[4UL + offsets[o]];
+
+            /* Method 0: memset(), method 1: DMAC */
+            for (m = 0UL; m < 2UL; m++)
+            {
+                best = UINT32_MAX;
+                ok = true;
+
+                for (run = 0UL; run < DMA_FILL_BENCHMARK_REPEAT; run++)
+                {
+                    (void) memset(buffer, DMA_FILL_BENCHMARK_GUARD, DMA_FILL_BENCHMARK_BUFFER_SIZE);
+
+                    start = cycle_count_now();
+                    if (0UL == m)
+                    {
+                        (void) memset(dst, DMA_FILL_BENCHMARK_VALUE, size);
+                    }
+                    else
+                    {
+                        ok = dma_fill_dma(dst, DMA_FILL_REPLICATE(DMA_FILL_BENCHMARK_VALUE), size) && ok;
+                    }
+                    cycles = cycle_count_elapsed(start);
+
+                    ok = dma_fill_benchmark_check(buffer, 4UL + offsets[o], size) && ok;
+                    if (cycles < best)
+                    {
+                        best = cycles;
+                    }
+                }
+
+                dma_benchmark_csv_begin("fill");
+                dma_benchmark_csv_str((0UL == m) ? "memset" : "dma");
+                dma_benchmark_csv_u32(size);
+                dma_benchmark_csv_u32(offsets[o]);
+                dma_benchmark_csv_u32(best);
+                dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+                dma_benchmark_csv_end();
+            }
+        }
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dma_fill_benchmark_check
+*********************************************************************************
+* Summary:
+* Checks that a benchmark fill wrote the fill value to its region and left
+* the rest of the buffer at the guard value.
+*
+* Parameters:
+*  buffer: Benchmark buffer
+*  offset: Start of the region in the buffer
+*  size: Size of the region in bytes
+*
+* Return:
+*  bool: true if the buffer is as expected
+*
+********************************************************************************/
+static bool dma_fill_benchmark_check(const uint8_t *buffer, uint32_t offset, uint32_t size)
+{
+    uint32_t i;
+    bool ok = true;
+
+    for (i = 0UL; i < DMA_FILL_BENCHMARK_BUFFER_SIZE; i++)
+    {
+        ok = ok && (buffer[i] == (((i >= offset) && (i < (offset + size))) ?
+                                  DMA_FILL_BENCHMARK_VALUE : DMA_FILL_BENCHMARK_GUARD));
+    }
+
+    return ok;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   dma_fill.h
+*
+* Description: This file contains the declarations of the DMA fill engine.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_FILL_H
+#define DMA_FILL_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_benchmark.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Fills shorter than this, in bytes, are done by the CPU. Set it from the
+ * crossover of the fill benchmark. */
+#ifndef DMA_FILL_THRESHOLD
+#define DMA_FILL_THRESHOLD              64UL
+#endif
+
+/* Bound of each descriptor pair */
+#ifndef DMA_FILL_TIMEOUT_MS
+#define DMA_FILL_TIMEOUT_MS             10UL
+#endif
+
+/* Largest fill of the benchmark, in bytes. The fills run in the shared
+ * benchmark buffer, which also holds the offset and a guard word. */
+#ifndef DMA_FILL_BENCHMARK_MAX_SIZE
+#define DMA_FILL_BENCHMARK_MAX_SIZE     (DMA_BENCHMARK_MAX_SIZE / 2UL)
+#endif
+
+/* DMAC channel of the engine, software-triggered */
+#define DMA_FILL_CHANNEL                USER_DMA_CHANNEL
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+bool dma_fill(void *dst, uint8_t value, uint32_t size);
+bool dma_fill_pattern(void *dst, uint32_t pattern, uint32_t size);
+void dma_fill_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_FILL_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,508 @@
+/******************************************************************************
+* File Name:   dma_latency.c
+*
+* Description: This file contains the trigger-to-first-write latency benchmark.
+*              A single-word descriptor is triggered by software (for every
+*              retrigger setting) or by a hardware-routed counter trigger, and
+*              the delay until the destination is written is recorded as a
+*              min/mean/max distribution.
+*
+*              The write is detected by the CPU polling the destination word, or,
+*              when a counter and pin are configured, by the DMA toggling a pin
+*              whose edge the counter captures.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "dma_latency.h"
+#include "dma_benchmark.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Value written by the DMA in polling mode */
+#define DMA_LATENCY_MARKER              0xA5A5A5A5UL
+
+/* Sample value of a write or capture that did not happen in time */
+#define DMA_LATENCY_TIMEOUT             UINT32_MAX
+
+/* Width of the TCPWM counter */
+#define DMA_LATENCY_CNT_MASK_16BIT      0xFFFFUL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Takes one latency sample in CPU cycles */
+typedef uint32_t (*dma_latency_sampler_t)(cy_en_dmac_retrigger_t retrigger);
+
+/* Retrigger setting of the sweep */
+typedef struct
+{
+    cy_en_dmac_retrigger_t retrigger;
+    const char *name;
+} dma_latency_retrigger_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Source and destination of the polled transfer */
+static const uint32_t g_latencySrc = DMA_LATENCY_MARKER;
+static volatile uint32_t g_latencyDst;
+
+/* Timeout of one sample in CPU cycles */
+static uint32_t g_latencyTimeout = 0UL;
+
+/* Cost of the timestamps and one poll of an already written destination */
+static uint32_t g_latencyPollOverhead = 0UL;
+
+/* Retrigger settings of the sweep */
+static const dma_latency_retrigger_t g_latencyRetriggers[] =
+{
+    { CY_DMAC_RETRIG_IM,      "im"    },
+    { CY_DMAC_RETRIG_4CYC,    "4cyc"  },
+    { CY_DMAC_RETRIG_16CYC,   "16cyc" },
+    { CY_DMAC_WAIT_FOR_REACT, "react" }
+};
+
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+/* Pin mask written to the port's inversion register */
+static const uint32_t g_latencyPinMask = (1UL << DMA_LATENCY_PIN_NUM);
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void dma_latency_arm(cy_en_dmac_retrigger_t retrigger, const void *src, volatile void *dst);
+static void dma_latency_calibrate(void);
+static uint32_t dma_latency_abandon(void);
+static void dma_latency_distribution(const char *trigger, const char *retrigger, const char *detect,
+                                     dma_latency_sampler_t sampler, cy_en_dmac_retrigger_t setting);
+static uint32_t dma_latency_sw_poll(cy_en_dmac_retrigger_t retrigger);
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+static uint32_t dma_latency_sw_capture(cy_en_dmac_retrigger_t retrigger);
+static uint32_t dma_latency_wait_capture(void);
+#endif
+#if (DMA_LATENCY_HW_TRIGGER_AVAILABLE)
+static uint32_t dma_latency_hw_poll(cy_en_dmac_retrigger_t retrigger);
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+static uint32_t dma_latency_hw_capture(cy_en_dmac_retrigger_t retrigger);
+#endif
+#endif
+
+/********************************************************************************
+* Function Name: dma_latency_run
+*********************************************************************************
+* Summary:
+* Measures the latency distributions and writes them as CSV. Software-trigger
+* latencies include the Cy_TrigMux_SwTrigger() call. Polling latencies have the
+* timestamp and poll overhead subtracted and are accurate to one poll loop
+* iteration. Capture latencies are counter ticks of the CPU clock. Samples
+* that take longer than DMA_LATENCY_TIMEOUT_MS are counted as timeouts.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_latency_run(void)
+{
+    uint32_t r;
+
+    g_latencyTimeout = CYCLE_COUNT_MS_TO_CYCLES(DMA_LATENCY_TIMEOUT_MS);
+    dma_latency_calibrate();
+
+    dma_benchmark_csv_comment("dma_latency");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("trigger");
+    dma_benchmark_csv_str("retrigger");
+    dma_benchmark_csv_str("detect");
+    dma_benchmark_csv_str("samples");
+    dma_benchmark_csv_str("min");
+    dma_benchmark_csv_str("mean");
+    dma_benchmark_csv_str("max");
+    dma_benchmark_csv_str("timeouts");
+    dma_benchmark_csv_end();
+
+    for (r = 0UL; r < (sizeof(g_latencyRetriggers) / sizeof(g_latencyRetriggers[0])); r++)
+    {
+        dma_latency_distribution("sw", g_latencyRetriggers[r].name, "poll",
+                                 dma_latency_sw_poll, g_latencyRetriggers[r].retrigger);
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+        dma_latency_distribution("sw", g_latencyRetriggers[r].name, "capture",
+                                 dma_latency_sw_capture, g_latencyRetriggers[r].retrigger);
+#endif
+    }
+
+#if (DMA_LATENCY_HW_TRIGGER_AVAILABLE)
+    (void) Cy_TCPWM_Counter_Init(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM, &DMA_LATENCY_CNT_config);
+    Cy_TCPWM_Counter_Enable(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM);
+    (void) Cy_TrigMux_Connect(DMA_LATENCY_CNT_TRIGGER_IN, DMA_TRIGGER_SELECT);
+    Cy_TCPWM_TriggerStart(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_MASK);
+
+    dma_latency_distribution("hw", "react", "poll", dma_latency_hw_poll, CY_DMAC_WAIT_FOR_REACT);
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+    dma_latency_distribution("hw", "react", "capture", dma_latency_hw_capture, CY_DMAC_WAIT_FOR_REACT);
+#endif
+
+    Cy_TCPWM_TriggerStopOrKill(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_MASK);
+#endif
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dma_latency_arm
+*********************************************************************************
+* Summary:
+* Configures PING for a single-word transfer and selects it.
+*
+* Parameters:
+*  retrigger: Retrigger setting of the descriptor
+*  src: Source word
+*  dst: Destination word
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_latency_arm(cy_en_dmac_retrigger_t retrigger, const void *src, volatile void *dst)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = src,
+        .dst          = (void *) dst,
+        .count        = 1UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = retrigger,
+        .srcIncrement = false,
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+
+    (void) dma_chain_config(DMA_LATENCY_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+    dma_chain_start(DMA_LATENCY_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+}
+
+/********************************************************************************
+* Function Name: dma_latency_calibrate
+*********************************************************************************
+* Summary:
+* Measures the polling sequence on a destination that is already written.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_latency_calibrate(void)
+{
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t i;
+
+    g_latencyDst = DMA_LATENCY_MARKER;
+    g_latencyPollOverhead = UINT32_MAX;
+
+    for (i = 0UL; i < DMA_LATENCY_SAMPLES; i++)
+    {
+        start = cycle_count_now();
+        while ((0UL == g_latencyDst) && !cycle_count_expired(start, g_latencyTimeout))
+        {
+        }
+        cycles = cycle_count_elapsed(start);
+
+        if (cycles < g_latencyPollOverhead)
+        {
+            g_latencyPollOverhead = cycles;
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: dma_latency_abandon
+*********************************************************************************
+* Summary:
+* Resets the channel after a sample timed out, so the pending descriptor can
+* not write into the next sample.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: DMA_LATENCY_TIMEOUT
+*
+********************************************************************************/
+static uint32_t dma_latency_abandon(void)
+{
+    dma_chain_recover(DMA_LATENCY_CHANNEL);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, DMA_LATENCY_CHANNEL);
+
+    return DMA_LATENCY_TIMEOUT;
+}
+
+/********************************************************************************
+* Function Name: dma_latency_distribution
+*********************************************************************************
+* Summary:
+* Takes DMA_LATENCY_SAMPLES samples and writes the min/mean/max of those that
+* did not time out, and the number that did, as a CSV row.
+*
+* Parameters:
+*  trigger: Trigger source name
+*  retrigger: Retrigger setting name
+*  detect: Detection method name
+*  sampler: Function taking one sample
+*  setting: Retrigger setting passed to the sampler
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_latency_distribution(const char *trigger, const char *retrigger, const char *detect,
+                                     dma_latency_sampler_t sampler, cy_en_dmac_retrigger_t setting)
+{
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0UL;
+    uint32_t sum = 0UL;
+    uint32_t timeouts = 0UL;
+    uint32_t sample;
+    uint32_t i;
+
+    for (i = 0UL; i < DMA_LATENCY_SAMPLES; i++)
+    {
+        sample = sampler(setting);
+        if (DMA_LATENCY_TIMEOUT == sample)
+        {
+            timeouts++;
+        }
+        else
+        {
+            sum += sample;
+            min = (sample < min) ? sample : min;
+            max = (sample > max) ? sample : max;
+        }
+    }
+
+    if (DMA_LATENCY_SAMPLES == timeouts)
+    {
+        min = 0UL;
+    }
+
+    dma_benchmark_csv_begin("latency");
+    dma_benchmark_csv_str(trigger);
+    dma_benchmark_csv_str(retrigger);
+    dma_benchmark_csv_str(detect);
+    dma_benchmark_csv_u32(DMA_LATENCY_SAMPLES);
+    dma_benchmark_csv_u32(min);
+    dma_benchmark_csv_u32((DMA_LATENCY_SAMPLES == timeouts) ? 0UL : (sum / (DMA_LATENCY_SAMPLES - timeouts)));
+    dma_benchmark_csv_u32(max);
+    dma_benchmark_csv_u32(timeouts);
+    dma_benchmark_csv_end();
+}
+
+/********************************************************************************
+* Function Name: dma_latency_sw_poll
+*********************************************************************************
+* Summary:
+* Software trigger, write detected by polling the destination word.
+*
+* Parameters:
+*  retrigger: Retrigger setting of the descriptor
+*
+* Return:
+*  uint32_t: Latency in CPU cycles or DMA_LATENCY_TIMEOUT
+*
+********************************************************************************/
+static uint32_t dma_latency_sw_poll(cy_en_dmac_retrigger_t retrigger)
+{
+    uint32_t start;
+    uint32_t cycles;
+
+    g_latencyDst = 0UL;
+    dma_latency_arm(retrigger, &g_latencySrc, &g_latencyDst);
+
+    start = cycle_count_now();
+    dma_chain_trigger();
+    while ((0UL == g_latencyDst) && !cycle_count_expired(start, g_latencyTimeout))
+    {
+    }
+    cycles = cycle_count_elapsed(start);
+
+    if (0UL == g_latencyDst)
+    {
+        return dma_latency_abandon();
+    }
+
+    return (cycles > g_latencyPollOverhead) ? (cycles - g_latencyPollOverhead) : 0UL;
+}
+
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+/********************************************************************************
+* Function Name: dma_latency_wait_capture
+*********************************************************************************
+* Summary:
+* Waits for the counter to capture the pin edge and returns the capture value.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Captured counter value or DMA_LATENCY_TIMEOUT
+*
+********************************************************************************/
+static uint32_t dma_latency_wait_capture(void)
+{
+    uint32_t start = cycle_count_now();
+
+    while (0UL == (Cy_TCPWM_GetInterruptStatus(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM) & CY_TCPWM_INT_ON_CC))
+    {
+        if (cycle_count_expired(start, g_latencyTimeout))
+        {
+            return dma_latency_abandon();
+        }
+    }
+    Cy_TCPWM_ClearInterrupt(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM, CY_TCPWM_INT_ON_CC);
+
+    return Cy_TCPWM_Counter_GetCapture(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM);
+}
+
+/********************************************************************************
+* Function Name: dma_latency_sw_capture
+*********************************************************************************
+* Summary:
+* Software trigger, write detected by the counter capturing the pin toggle.
+*
+* Parameters:
+*  retrigger: Retrigger setting of the descriptor
+*
+* Return:
+*  uint32_t: Latency in counter ticks or DMA_LATENCY_TIMEOUT
+*
+********************************************************************************/
+static uint32_t dma_latency_sw_capture(cy_en_dmac_retrigger_t retrigger)
+{
+    uint32_t start;
+    uint32_t capture;
+
+    dma_latency_arm(retrigger, &g_latencyPinMask, &DMA_LATENCY_PIN_PORT->DR_INV);
+    Cy_TCPWM_ClearInterrupt(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM, CY_TCPWM_INT_ON_CC);
+
+    start = Cy_TCPWM_Counter_GetCounter(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM);
+    dma_chain_trigger();
+
+    capture = dma_latency_wait_capture();
+    if (DMA_LATENCY_TIMEOUT == capture)
+    {
+        return DMA_LATENCY_TIMEOUT;
+    }
+
+    return ((capture - start) & DMA_LATENCY_CNT_MASK_16BIT);
+}
+#endif /* DMA_LATENCY_CAPTURE_AVAILABLE */
+
+#if (DMA_LATENCY_HW_TRIGGER_AVAILABLE)
+/********************************************************************************
+* Function Name: dma_latency_hw_poll
+*********************************************************************************
+* Summary:
+* Counter overflow trigger, write detected by polling. The counter restarts
+* from zero at the overflow, so its value at detection is the latency.
+*
+* Parameters:
+*  retrigger: Retrigger setting of the descriptor
+*
+* Return:
+*  uint32_t: Latency in counter ticks or DMA_LATENCY_TIMEOUT
+*
+********************************************************************************/
+static uint32_t dma_latency_hw_poll(cy_en_dmac_retrigger_t retrigger)
+{
+    uint32_t start;
+
+    g_latencyDst = 0UL;
+    dma_latency_arm(retrigger, &g_latencySrc, &g_latencyDst);
+
+    start = cycle_count_now();
+    while ((0UL == g_latencyDst) && !cycle_count_expired(start, g_latencyTimeout))
+    {
+    }
+
+    if (0UL == g_latencyDst)
+    {
+        return dma_latency_abandon();
+    }
+
+    return Cy_TCPWM_Counter_GetCounter(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM);
+}
+
+#if (DMA_LATENCY_CAPTURE_AVAILABLE)
+/********************************************************************************
+* Function Name: dma_latency_hw_capture
+*********************************************************************************
+* Summary:
+* Counter overflow trigger, write detected by the counter capturing the pin
+* toggle. No CPU activity is part of the measurement.
+*
+* Parameters:
+*  retrigger: Retrigger setting of the descriptor
+*
+* Return:
+*  uint32_t: Latency in counter ticks or DMA_LATENCY_TIMEOUT
+*
+********************************************************************************/
+static uint32_t dma_latency_hw_capture(cy_en_dmac_retrigger_t retrigger)
+{
+    dma_latency_arm(retrigger, &g_latencyPinMask, &DMA_LATENCY_PIN_PORT->DR_INV);
+    Cy_TCPWM_ClearInterrupt(DMA_LATENCY_CNT_HW, DMA_LATENCY_CNT_NUM, CY_TCPWM_INT_ON_CC);
+
+    return dma_latency_wait_capture();
+}
+#endif /* DMA_LATENCY_CAPTURE_AVAILABLE */
+#endif /* DMA_LATENCY_HW_TRIGGER_AVAILABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name:   dma_latency.h
+*
+* Description: Public interface of the trigger-to-first-write latency benchmark.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_LATENCY_H
+#define DMA_LATENCY_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Number of samples per latency distribution */
+#ifndef DMA_LATENCY_SAMPLES
+#define DMA_LATENCY_SAMPLES             64UL
+#endif
+
+/* Time allowed for the write or the capture of one sample. A sample that
+ * times out is counted in the timeouts column instead of the distribution. */
+#ifndef DMA_LATENCY_TIMEOUT_MS
+#define DMA_LATENCY_TIMEOUT_MS          10UL
+#endif
+
+/* DMAC channel under test */
+#define DMA_LATENCY_CHANNEL             USER_DMA_CHANNEL
+
+/* Counter capture detection and hardware-routed triggers are available when
+ * the Device Configurator provides a TCPWM counter with the alias
+ * DMA_LATENCY_CNT, clocked from the CPU clock:
+ *  - DMA_LATENCY_CNT_TRIGGER_IN: trigger multiplexer input of the counter's
+ *    overflow output, routed to the USER_DMA trigger for hardware triggers.
+ *  - A pin with the alias DMA_LATENCY_PIN, connected to the capture input of
+ *    the counter (both edges). The DMA toggles the pin instead of writing to
+ *    SRAM, so the counter captures the write without CPU polling. */
+#if defined(DMA_LATENCY_CNT_HW) && defined(DMA_LATENCY_PIN_PORT)
+#define DMA_LATENCY_CAPTURE_AVAILABLE   (1u)
+#else
+#define DMA_LATENCY_CAPTURE_AVAILABLE   (0u)
+#endif
+
+#if defined(DMA_LATENCY_CNT_HW) && defined(DMA_LATENCY_CNT_TRIGGER_IN)
+#define DMA_LATENCY_HW_TRIGGER_AVAILABLE (1u)
+#else
+#define DMA_LATENCY_HW_TRIGGER_AVAILABLE (0u)
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void dma_latency_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_LATENCY_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,403 @@
+/******************************************************************************
+* File Name:   dma_power.c
+*
+* Description: This file contains the power-managed DMA wait. While a descriptor
+*              is pending, the CPU enters Sleep, the deepest power mode in which
+*              the DMAC keeps running (Deep Sleep stops its clock), and wakes on
+*              the channel completion interrupt. The cycles spent running and
+*              sleeping are accounted for, so an energy per KB moved can be
+*              estimated from the Active and Sleep mode currents.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "dma_power.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Number of transfers per wait method. Their totals are reported. */
+#define DMA_POWER_BENCHMARK_REPEAT      4UL
+
+/* Flash source past the vector table of the application image */
+#define DMA_POWER_BENCHMARK_SRC         (CY_FLASH_BASE + 0x100UL)
+
+/* Bound of a benchmark transfer */
+#define DMA_POWER_BENCHMARK_TIMEOUT_MS  10UL
+
+#if (DMA_POWER_BENCHMARK_SIZE > DMA_BENCHMARK_MAX_SIZE)
+#error "DMA_POWER_BENCHMARK_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/* Units of the energy estimate */
+#define DMA_POWER_BYTES_PER_KB          1024UL
+#define DMA_POWER_PJ_PER_NJ             1000UL
+
+/* cycles * nA per MHz * mV / DMA_POWER_PJ_SCALE = pJ */
+#define DMA_POWER_PJ_SCALE              1000000UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Wait method of the benchmark */
+typedef enum
+{
+    DMA_POWER_WAIT_SPIN = 0,            /* dma_chain_wait_timeout() */
+    DMA_POWER_WAIT_SLEEP                /* dma_power_wait() */
+} dma_power_method_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static uint64_t dma_power_energy_pj(const dma_power_stats_t *stats);
+static void dma_power_measure(dma_power_method_t method, const char *name);
+static void dma_power_callback(uint32_t channel);
+
+/********************************************************************************
+* Function Name: dma_power_wait
+*********************************************************************************
+* Summary:
+* Waits for a descriptor to complete with the CPU in Sleep. The descriptor
+* must be configured with interrupt = true and the channel must have a
+* callback registered with dma_chain_register_callback(), so its completion
+* raises the interrupt that ends the sleep.
+*
+* The response is checked with interrupts masked. A completion between the
+* check and the sleep leaves its interrupt pending, which ends the sleep at
+* once, so a wake-up cannot be lost. Any other interrupt also ends the sleep;
+* the SysTick wrap of the cycle counter bounds each sleep to 2^24 cycles, so
+* the deadline is checked at least that often. SysTick keeps counting in
+* Sleep, so the sleep cycles come from the same clock as the deadline.
+*
+* Parameters:
+*  channel: DMAC channel number
+*  descriptor: Descriptor to wait for
+*  timeoutCycles: Deadline in CPU cycles from the call
+*  stats: Accounting updated with the cycles of the wait, or NULL
+*
+* Return:
+*  dma_chain_status_t: DMA_CHAIN_STATUS_DONE, the error of the descriptor or
+*                      DMA_CHAIN_STATUS_TIMEOUT
+*
+********************************************************************************/
+dma_chain_status_t dma_power_wait(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                  uint32_t timeoutCycles, dma_power_stats_t *stats)
+{
+    cy_en_dmac_response_t response = DMA_CHAIN_RESPONSE_PENDING;
+    uint32_t start = cycle_count_now();
+    uint32_t sleepCycles = 0UL;
+    uint32_t wakes = 0UL;
+    uint32_t sleepStart;
+    uint32_t interruptState;
+    uint32_t cycles;
+    bool expired = false;
+
+    while ((DMA_CHAIN_RESPONSE_PENDING == response) && !expired)
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+
+        response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, descriptor);
+        expired = cycle_count_expired(start, timeoutCycles);
+        if ((DMA_CHAIN_RESPONSE_PENDING == response) && !expired)
+        {
+            event_trace_record(EVENT_TRACE_POWER_SLEEP, channel);
+            sleepStart = cycle_count_now();
+
+            (void) Cy_SysPm_CpuEnterSleep();
+
+            sleepCycles += cycle_count_elapsed(sleepStart);
+            wakes++;
+            event_trace_record(EVENT_TRACE_POWER_WAKE, channel);
+        }
+
+        /* The interrupt that ended the sleep is serviced here */
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    if (NULL != stats)
+    {
+        cycles = cycle_count_elapsed(start);
+
+        stats->transfers++;
+        stats->sleepCycles += sleepCycles;
+        stats->activeCycles += (cycles > sleepCycles) ? (cycles - sleepCycles) : 0UL;
+        stats->wakes += wakes;
+    }
+
+    return (DMA_CHAIN_RESPONSE_PENDING == response) ? DMA_CHAIN_STATUS_TIMEOUT : dma_chain_status(response);
+}
+
+/********************************************************************************
+* Function Name: dma_power_stats_reset
+*********************************************************************************
+* Summary:
+* Clears an accounting structure.
+*
+* Parameters:
+*  stats: Accounting to clear
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_power_stats_reset(dma_power_stats_t *stats)
+{
+    (void) memset(stats, 0, sizeof(*stats));
+}
+
+/********************************************************************************
+* Function Name: dma_power_energy_nj
+*********************************************************************************
+* Summary:
+* Estimates the CPU energy of the accounted waits.
+*
+* Parameters:
+*  stats: Accounting of the waits
+*
+* Return:
+*  uint32_t: Estimated energy in nJ
+*
+********************************************************************************/
+uint32_t dma_power_energy_nj(const dma_power_stats_t *stats)
+{
+    return (uint32_t) (dma_power_energy_pj(stats) / DMA_POWER_PJ_PER_NJ);
+}
+
+/********************************************************************************
+* Function Name: dma_power_nj_per_kb
+*********************************************************************************
+* Summary:
+* Estimates the CPU energy per KB moved by the accounted transfers.
+*
+* Parameters:
+*  stats: Accounting of the waits, with the bytes moved
+*
+* Return:
+*  uint32_t: Estimated energy in nJ per KB, 0 if no bytes were moved
+*
+********************************************************************************/
+uint32_t dma_power_nj_per_kb(const dma_power_stats_t *stats)
+{
+    uint64_t energyPj = dma_power_energy_pj(stats);
+    uint32_t result = 0UL;
+
+    if (0UL != stats->bytes)
+    {
+        result = (uint32_t) ((energyPj * DMA_POWER_BYTES_PER_KB) /
+                             ((uint64_t) stats->bytes * DMA_POWER_PJ_PER_NJ));
+    }
+
+    return result;
+}
+
+/********************************************************************************
+* Function Name: dma_power_energy_pj
+*********************************************************************************
+* Summary:
+* Estimates the CPU energy of the accounted waits in pJ. A cycle at f MHz
+* lasts 1/f us and draws (nA per MHz * f) nA, so its charge does not depend
+* on the clock: energy [pJ] = cycles * nA per MHz * mV / 10^6.
+*
+* Parameters:
+*  stats: Accounting of the waits
+*
+* Return:
+*  uint64_t: Estimated energy in pJ
+*
+********************************************************************************/
+static uint64_t dma_power_energy_pj(const dma_power_stats_t *stats)
+{
+    uint64_t charge = ((uint64_t) stats->activeCycles * DMA_POWER_ACTIVE_NA_PER_MHZ) +
+                      ((uint64_t) stats->sleepCycles * DMA_POWER_SLEEP_NA_PER_MHZ);
+
+    return (charge * DMA_POWER_SUPPLY_MV) / DMA_POWER_PJ_SCALE;
+}
+
+/********************************************************************************
+* Function Name: dma_power_benchmark_run
+*********************************************************************************
+* Summary:
+* Copies DMA_POWER_BENCHMARK_SIZE bytes from flash to SRAM, waiting for the
+* completion by polling and with the CPU in Sleep, and writes the cycle
+* accounting and the estimated energy per KB as CSV. The cycle counter, the
+* DMAC and UART_HW must be enabled. The USER_DMA descriptors are reprogrammed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_power_benchmark_run(void)
+{
+    dma_chain_register_callback(DMA_POWER_BENCHMARK_CHANNEL, dma_power_callback);
+
+    dma_benchmark_csv_comment("dma_power");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("wait");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("active_cycles");
+    dma_benchmark_csv_str("sleep_cycles");
+    dma_benchmark_csv_str("wakes");
+    dma_benchmark_csv_str("nj_per_kb");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    dma_power_measure(DMA_POWER_WAIT_SPIN, "spin");
+    dma_power_measure(DMA_POWER_WAIT_SLEEP, "sleep");
+
+    dma_chain_register_callback(DMA_POWER_BENCHMARK_CHANNEL, NULL);
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dma_power_measure
+*********************************************************************************
+* Summary:
+* Runs DMA_POWER_BENCHMARK_REPEAT transfers with one wait method and reports
+* their totals. A polled wait keeps the CPU running, so all its cycles are
+* active. Only the wait is accounted: the descriptor setup is the same for
+* both methods.
+*
+* Parameters:
+*  method: Wait method
+*  name: Name of the method for the CSV output
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_power_measure(dma_power_method_t method, const char *name)
+{
+    uint8_t *buffer = dma_benchmark_scratch();
+    const dma_chain_segment_t segment =
+    {
+        .src          = (const void *) DMA_POWER_BENCHMARK_SRC,
+        .dst          = buffer,
+        .count        = DMA_POWER_BENCHMARK_SIZE / 4UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(DMA_POWER_BENCHMARK_TIMEOUT_MS);
+    dma_power_stats_t stats;
+    dma_chain_status_t status;
+    uint32_t start;
+    uint32_t run;
+    bool ok = true;
+
+    dma_power_stats_reset(&stats);
+
+    for (run = 0UL; run < DMA_POWER_BENCHMARK_REPEAT; run++)
+    {
+        (void) memset(buffer, 0, DMA_POWER_BENCHMARK_SIZE);
+
+        (void) dma_chain_config(DMA_POWER_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+        dma_chain_start(DMA_POWER_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        dma_chain_trigger();
+
+        if (DMA_POWER_WAIT_SLEEP == method)
+        {
+            status = dma_power_wait(DMA_POWER_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING, timeout, &stats);
+        }
+        else
+        {
+            start = cycle_count_now();
+            status = dma_chain_wait_timeout(DMA_POWER_BENCHMARK_CHANNEL, CY_DMAC_DESCRIPTOR_PING, timeout);
+            stats.activeCycles += cycle_count_elapsed(start);
+            stats.transfers++;
+        }
+
+        if (DMA_CHAIN_STATUS_DONE == status)
+        {
+            stats.bytes += DMA_POWER_BENCHMARK_SIZE;
+            ok = ok && (0 == memcmp((const void *) DMA_POWER_BENCHMARK_SRC, buffer,
+                                    DMA_POWER_BENCHMARK_SIZE));
+        }
+        else
+        {
+            dma_chain_recover(DMA_POWER_BENCHMARK_CHANNEL);
+            Cy_DMAC_Channel_Enable(USER_DMA_HW, DMA_POWER_BENCHMARK_CHANNEL);
+            ok = false;
+        }
+    }
+
+    dma_benchmark_csv_begin("power");
+    dma_benchmark_csv_str(name);
+    dma_benchmark_csv_u32(DMA_POWER_BENCHMARK_SIZE);
+    dma_benchmark_csv_u32(stats.activeCycles + stats.sleepCycles);
+    dma_benchmark_csv_u32(stats.activeCycles);
+    dma_benchmark_csv_u32(stats.sleepCycles);
+    dma_benchmark_csv_u32(stats.wakes);
+    dma_benchmark_csv_u32(dma_power_nj_per_kb(&stats));
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/********************************************************************************
+* Function Name: dma_power_callback
+*********************************************************************************
+* Summary:
+* Benchmark channel completion callback. Registering it unmasks the channel
+* interrupt, which ends the sleep of dma_power_wait(); nothing else to do.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_power_callback(uint32_t channel)
+{
+    CY_UNUSED_PARAMETER(channel);
+}
+
+/* [] END OF FILE */
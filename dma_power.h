@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name:   dma_power.h
+*
+* Description: This file contains the declarations of the power-managed DMA
+*              wait and its energy accounting.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_POWER_H
+#define DMA_POWER_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Current model of the energy estimate, in nA per MHz of CPU clock, and the
+ * supply voltage in mV. The defaults are placeholders: take the Active and
+ * Sleep mode currents of the device and clock configuration from its
+ * datasheet. The DMAC and memory currents during the transfer are the same
+ * for both wait methods and are not part of the model. */
+#ifndef DMA_POWER_ACTIVE_NA_PER_MHZ
+#define DMA_POWER_ACTIVE_NA_PER_MHZ     50000UL
+#endif
+
+#ifndef DMA_POWER_SLEEP_NA_PER_MHZ
+#define DMA_POWER_SLEEP_NA_PER_MHZ      15000UL
+#endif
+
+#ifndef DMA_POWER_SUPPLY_MV
+#define DMA_POWER_SUPPLY_MV             3300UL
+#endif
+
+/* Size of the benchmark transfer, in bytes, a multiple of 4. The destination
+ * is the shared benchmark buffer, so at most DMA_BENCHMARK_MAX_SIZE. */
+#ifndef DMA_POWER_BENCHMARK_SIZE
+#define DMA_POWER_BENCHMARK_SIZE        DMA_BENCHMARK_MAX_SIZE
+#endif
+
+/* DMAC channel used by the benchmark */
+#define DMA_POWER_BENCHMARK_CHANNEL     USER_DMA_CHANNEL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Cycle accounting of a series of waits. Cleared by dma_power_stats_reset();
+ * the caller adds the bytes each transfer moves. */
+typedef struct
+{
+    uint32_t transfers;                 /* Waits that ended */
+    uint32_t bytes;                     /* Bytes moved by the transfers */
+    uint32_t activeCycles;              /* Cycles with the CPU running */
+    uint32_t sleepCycles;               /* Cycles with the CPU in Sleep */
+    uint32_t wakes;                     /* Wake-ups, including other interrupts */
+} dma_power_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+dma_chain_status_t dma_power_wait(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                  uint32_t timeoutCycles, dma_power_stats_t *stats);
+void dma_power_stats_reset(dma_power_stats_t *stats);
+uint32_t dma_power_energy_nj(const dma_power_stats_t *stats);
+uint32_t dma_power_nj_per_kb(const dma_power_stats_t *stats);
+void dma_power_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_POWER_H */
+
+/* [] END OF FILE */
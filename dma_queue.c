@@ -0,0 +1,631 @@
+/******************************************************************************
+* File Name:   dma_queue.c
+*
+* Description: This file contains the DMA copy request queue. Requests are
+*              submitted from the main loop or any interrupt; each submission
+*              links the request under a short interrupt mask, since the
+*              Cortex-M0+ has no exclusive-access instructions. The DMAC
+*              completion interrupt of a request starts the next one on the
+*              other descriptor of the PING/PONG pair, so the channel does not
+*              wait for the submitter while requests are queued.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "dma_queue.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+#if (DMA_QUEUE_CHANNEL >= CPUSS_DMAC_CH_NR)
+#error "DMA_QUEUE_CHANNEL is not a DMAC channel of this device"
+#endif
+
+/* Requests per benchmark run and request sizes of the benchmark. The
+ * destination is the shared benchmark buffer. */
+#define DMA_QUEUE_BENCHMARK_REQUESTS    8UL
+#define DMA_QUEUE_BENCHMARK_SIZES       { 16UL, 64UL, 128UL }
+#define DMA_QUEUE_BENCHMARK_MAX_SIZE    128UL
+
+#if ((DMA_QUEUE_BENCHMARK_REQUESTS * DMA_QUEUE_BENCHMARK_MAX_SIZE) > DMA_BENCHMARK_MAX_SIZE)
+#error "The queue benchmark exceeds the shared benchmark buffer"
+#endif
+
+/* Small-packet traffic of the coalescing benchmark: contiguous packets of
+ * each size, submitted back to back */
+#define DMA_QUEUE_BENCHMARK_PACKETS     DMA_QUEUE_BENCHMARK_REQUESTS
+#define DMA_QUEUE_BENCHMARK_PACKET_SIZES    { 4UL, 8UL, 16UL }
+
+/* Flash source of the benchmark, past the vector table */
+#define DMA_QUEUE_BENCHMARK_SRC         (CY_FLASH_BASE + 0x100UL)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Request in progress (queue head) and last queued request */
+static dma_queue_request_t *volatile g_queueHead = NULL;
+static dma_queue_request_t *g_queueTail = NULL;
+
+/* Descriptor of the request in progress */
+static cy_en_dmac_descriptor_t g_queueDescriptor = CY_DMAC_DESCRIPTOR_PING;
+
+/* Last queued request that has not started, which contiguous requests can
+ * merge into, or NULL */
+static dma_queue_request_t *g_queueOpen = NULL;
+
+/* Merge contiguous requests, and the queue counters */
+static bool g_queueCoalesce = true;
+static dma_queue_stats_t g_queueStats;
+
+/* Benchmark requests */
+static dma_queue_request_t g_queueRequests[DMA_QUEUE_BENCHMARK_REQUESTS];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static bool dma_queue_can_merge(const dma_queue_request_t *request);
+static void dma_queue_start(dma_queue_request_t *request);
+static void dma_queue_callback(uint32_t channel);
+static uint32_t dma_queue_benchmark_measure(uint32_t count, uint32_t size, bool queued, bool *ok);
+
+/********************************************************************************
+* Function Name: dma_queue_init
+*********************************************************************************
+* Summary:
+* Initializes the queue channel and enables it. The DMAC must be enabled.
+* Requests still queued are dropped without completion.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_queue_init(void)
+{
+    const cy_stc_dmac_channel_config_t channelConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = DMA_QUEUE_PRIORITY,
+        .enable     = false
+    };
+
+    g_queueHead = NULL;
+    g_queueTail = NULL;
+    g_queueOpen = NULL;
+    g_queueDescriptor = CY_DMAC_DESCRIPTOR_PING;
+    dma_queue_reset_stats();
+
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, DMA_QUEUE_CHANNEL, &channelConfig);
+    dma_chain_register_callback(DMA_QUEUE_CHANNEL, dma_queue_callback);
+
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, DMA_QUEUE_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_submit
+*********************************************************************************
+* Summary:
+* Appends a request to the queue and starts it if the channel is idle. Safe
+* to call from the main loop and from interrupts of any priority; it never
+* waits. Interrupts are masked only while the request is linked, and while
+* it is started when the queue was empty. A request that continues both the
+* source and the destination of the last request not yet started is merged
+* into its transfer, up to DMA_QUEUE_COALESCE_MAX_SIZE bytes; it still gets
+* its own response and callback.
+*
+* Parameters:
+*  request: Request to submit
+*
+* Return:
+*  bool: true if the request was queued, false if its size is out of range
+*
+********************************************************************************/
+bool dma_queue_submit(dma_queue_request_t *request)
+{
+    uint32_t interruptState;
+
+    if ((0UL == request->size) || (request->size > DMA_QUEUE_MAX_SIZE))
+    {
+        return false;
+    }
+
+    request->response = DMA_CHAIN_RESPONSE_PENDING;
+    request->length = request->size;
+    request->next = NULL;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    g_queueStats.requests++;
+    if (NULL == g_queueHead)
+    {
+        g_queueHead = request;
+        g_queueTail = request;
+        dma_queue_start(request);
+    }
+    else
+    {
+        if (dma_queue_can_merge(request))
+        {
+            /* Copied by the transfer of the open request */
+            g_queueOpen->length += request->size;
+            request->length = 0UL;
+            g_queueStats.merged++;
+        }
+        else
+        {
+            g_queueOpen = request;
+        }
+        g_queueTail->next = request;
+        g_queueTail = request;
+    }
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: dma_queue_is_busy
+*********************************************************************************
+* Summary:
+* Reports whether requests are in progress or queued.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true while the queue is not empty
+*
+********************************************************************************/
+bool dma_queue_is_busy(void)
+{
+    return (NULL != g_queueHead);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_wait
+*********************************************************************************
+* Summary:
+* Waits until a submitted request is complete, for at most
+* DMA_QUEUE_WAIT_TIMEOUT_MS. After a timeout the queue is stuck and
+* dma_queue_init() resets it.
+*
+* Parameters:
+*  request: Submitted request
+*
+* Return:
+*  cy_en_dmac_response_t: CY_DMAC_DONE, the error response of the request or
+*                         DMA_CHAIN_RESPONSE_PENDING on timeout
+*
+********************************************************************************/
+cy_en_dmac_response_t dma_queue_wait(const dma_queue_request_t *request)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(DMA_QUEUE_WAIT_TIMEOUT_MS);
+    uint32_t start = cycle_count_now();
+
+    while ((DMA_CHAIN_RESPONSE_PENDING == request->response) && !cycle_count_expired(start, timeout))
+    {
+    }
+
+    return request->response;
+}
+
+/********************************************************************************
+* Function Name: dma_queue_set_coalescing
+*********************************************************************************
+* Summary:
+* Enables or disables the merging of contiguous requests. Enabled after reset.
+* Requests already merged are not split.
+*
+* Parameters:
+*  enable: Merge requests submitted from now on
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_queue_set_coalescing(bool enable)
+{
+    g_queueCoalesce = enable;
+}
+
+/********************************************************************************
+* Function Name: dma_queue_get_stats
+*********************************************************************************
+* Summary:
+* Copies the queue counters. requests - merged is the number of transfers the
+* requests need.
+*
+* Parameters:
+*  stats: Receives the counters
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_queue_get_stats(dma_queue_stats_t *stats)
+{
+    uint32_t interruptState;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    *stats = g_queueStats;
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_reset_stats
+*********************************************************************************
+* Summary:
+* Clears the queue counters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_queue_reset_stats(void)
+{
+    uint32_t interruptState;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    g_queueStats.requests  = 0UL;
+    g_queueStats.transfers = 0UL;
+    g_queueStats.merged    = 0UL;
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_can_merge
+*********************************************************************************
+* Summary:
+* Reports whether a request continues the open request in both source and
+* destination, and fits in its transfer. The open request has not started,
+* so its transfer can still grow. Called with interrupts masked.
+*
+* Parameters:
+*  request: Request being submitted
+*
+* Return:
+*  bool: true if the request can be merged into the open request
+*
+********************************************************************************/
+static bool dma_queue_can_merge(const dma_queue_request_t *request)
+{
+    const dma_queue_request_t *open = g_queueOpen;
+
+    return (g_queueCoalesce && (NULL != open) && (open->length < DMA_QUEUE_COALESCE_MAX_SIZE) &&
+            (request->size <= (DMA_QUEUE_COALESCE_MAX_SIZE - open->length)) &&
+            (((uintptr_t) open->src + open->length) == (uintptr_t) request->src) &&
+            (((uintptr_t) open->dst + open->length) == (uintptr_t) request->dst));
+}
+
+/********************************************************************************
+* Function Name: dma_queue_start
+*********************************************************************************
+* Summary:
+* Starts the transfer of a request, including the requests merged into it, on
+* the descriptor not used by the previous one. The copy uses the widest
+* element that source, destination and length are aligned to, and interrupts
+* on completion. Called with interrupts masked or from the
+* DMAC interrupt.
+*
+* Parameters:
+*  request: Request to start
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_queue_start(dma_queue_request_t *request)
+{
+    uint32_t alignment = (uint32_t) (uintptr_t) request->src | (uint32_t) (uintptr_t) request->dst |
+                         request->length;
+    dma_chain_segment_t segment =
+    {
+        .src          = request->src,
+        .dst          = request->dst,
+        .count        = request->length,
+        .width        = CY_DMAC_BYTE_BYTE,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+
+    if (0UL == (alignment & 3UL))
+    {
+        segment.width = CY_DMAC_WORD_WORD;
+        segment.count = request->length / 4UL;
+    }
+    else if (0UL == (alignment & 1UL))
+    {
+        segment.width = CY_DMAC_HALFWORD_HALFWORD;
+        segment.count = request->length / 2UL;
+    }
+    else
+    {
+        /* Byte elements */
+    }
+
+    /* Nothing can be merged into a started transfer */
+    if (request == g_queueOpen)
+    {
+        g_queueOpen = NULL;
+    }
+    g_queueStats.transfers++;
+
+    g_queueDescriptor = (CY_DMAC_DESCRIPTOR_PING == g_queueDescriptor) ?
+                        CY_DMAC_DESCRIPTOR_PONG : CY_DMAC_DESCRIPTOR_PING;
+
+    (void) dma_chain_config(DMA_QUEUE_CHANNEL, g_queueDescriptor, &segment);
+    dma_chain_start(DMA_QUEUE_CHANNEL, g_queueDescriptor);
+
+    event_trace_record(EVENT_TRACE_DMA_TRIGGER,
+                       EVENT_TRACE_DMA_ARG(DMA_QUEUE_CHANNEL, g_queueDescriptor, 0UL));
+    (void) Cy_TrigMux_SwTrigger(DMA_QUEUE_TRIGGER, DMA_TRIGGER_ASSERT_CYCLES);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_callback
+*********************************************************************************
+* Summary:
+* Completion callback of the queue channel. Starts the next transfer before
+* completing the current request and the requests merged into it, in order,
+* so the channel resumes before their callbacks run.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dma_queue_callback(uint32_t channel)
+{
+    dma_queue_request_t *request = g_queueHead;
+    dma_queue_request_t *last = request;
+    dma_queue_request_t *next;
+    cy_en_dmac_response_t response;
+    uint32_t interruptState;
+    bool done;
+
+    if (NULL == request)
+    {
+        return;
+    }
+
+    response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, g_queueDescriptor);
+
+    /* A higher-priority interrupt may submit while the head is unlinked */
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    while ((NULL != last->next) && (0UL == last->next->length))
+    {
+        last = last->next;
+    }
+    g_queueHead = last->next;
+    if (NULL == g_queueHead)
+    {
+        g_queueTail = NULL;
+    }
+    else
+    {
+        dma_queue_start(g_queueHead);
+    }
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    /* The link is read first: a completed request may be submitted again */
+    do
+    {
+        next = request->next;
+        done = (request == last);
+
+        request->response = response;
+        if (NULL != request->callback)
+        {
+            request->callback(request);
+        }
+
+        request = next;
+    } while (!done);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_benchmark_run
+*********************************************************************************
+* Summary:
+* Copies DMA_QUEUE_BENCHMARK_REQUESTS blocks of several sizes from flash to
+* SRAM, waiting for each copy before submitting the next (blocking) and
+* submitting all before waiting for the last (queued), without coalescing.
+* Then submits DMA_QUEUE_BENCHMARK_PACKETS contiguous small packets back to
+* back, without and with coalescing. Writes the cycles and the queue counters
+* as CSV. dma_queue_init(), the cycle counter and UART_HW must be
+* initialized.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dma_queue_benchmark_run(void)
+{
+    static const uint32_t sizes[] = DMA_QUEUE_BENCHMARK_SIZES;
+    static const uint32_t packetSizes[] = DMA_QUEUE_BENCHMARK_PACKET_SIZES;
+    bool coalesce = g_queueCoalesce;
+    dma_queue_stats_t stats;
+    uint32_t cycles;
+    uint32_t s;
+    uint32_t m;
+    bool ok;
+
+    dma_queue_set_coalescing(false);
+
+    dma_benchmark_csv_comment("dma_queue");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("requests");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (s = 0UL; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        for (m = 0UL; m < 2UL; m++)
+        {
+            cycles = dma_queue_benchmark_measure(DMA_QUEUE_BENCHMARK_REQUESTS, sizes[s], (1UL == m), &ok);
+
+            dma_benchmark_csv_begin("queue");
+            dma_benchmark_csv_str((1UL == m) ? "queued" : "blocking");
+            dma_benchmark_csv_u32(DMA_QUEUE_BENCHMARK_REQUESTS);
+            dma_benchmark_csv_u32(sizes[s]);
+            dma_benchmark_csv_u32(cycles);
+            dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+            dma_benchmark_csv_end();
+        }
+    }
+
+    dma_benchmark_csv_comment("end");
+
+    dma_benchmark_csv_comment("dma_queue_coalesce");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("requests");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("transfers");
+    dma_benchmark_csv_str("merged");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (s = 0UL; s < (sizeof(packetSizes) / sizeof(packetSizes[0])); s++)
+    {
+        for (m = 0UL; m < 2UL; m++)
+        {
+            dma_queue_set_coalescing(1UL == m);
+            dma_queue_reset_stats();
+            cycles = dma_queue_benchmark_measure(DMA_QUEUE_BENCHMARK_PACKETS, packetSizes[s], true, &ok);
+            dma_queue_get_stats(&stats);
+
+            dma_benchmark_csv_begin("coalesce");
+            dma_benchmark_csv_str((1UL == m) ? "on" : "off");
+            dma_benchmark_csv_u32(DMA_QUEUE_BENCHMARK_PACKETS);
+            dma_benchmark_csv_u32(packetSizes[s]);
+            dma_benchmark_csv_u32(cycles);
+            dma_benchmark_csv_u32(stats.transfers);
+            dma_benchmark_csv_u32(stats.merged);
+            dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+            dma_benchmark_csv_end();
+        }
+    }
+
+    dma_benchmark_csv_comment("end");
+
+    dma_queue_set_coalescing(coalesce);
+}
+
+/********************************************************************************
+* Function Name: dma_queue_benchmark_measure
+*********************************************************************************
+* Summary:
+* Runs one benchmark case: the requests copy consecutive flash blocks into
+* consecutive SRAM blocks.
+*
+* Parameters:
+*  count: Number of requests, at most DMA_QUEUE_BENCHMARK_REQUESTS
+*  size: Bytes per request, at most DMA_QUEUE_BENCHMARK_MAX_SIZE
+*  queued: Submit all requests before waiting
+*  ok: Set to true if every request completed and the data matches
+*
+* Return:
+*  uint32_t: Cycles from the first submission to the last completion
+*
+********************************************************************************/
+static uint32_t dma_queue_benchmark_measure(uint32_t count, uint32_t size, bool queued, bool *ok)
+{
+    const uint8_t *src = (const uint8_t *) DMA_QUEUE_BENCHMARK_SRC;
+    uint8_t *buffer = dma_benchmark_scratch();
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t i;
+    bool done = true;
+
+    (void) memset(buffer, 0, count * size);
+
+    for (i = 0UL; i < count; i++)
+    {
+        g_queueRequests[i].src      = &src[i * size];
+        g_queueRequests[i].dst      = &buffer[i * size];
+        g_queueRequests[i].size     = size;
+        g_queueRequests[i].callback = NULL;
+        g_queueRequests[i].context  = NULL;
+    }
+
+    start = cycle_count_now();
+    for (i = 0UL; i < count; i++)
+    {
+        (void) dma_queue_submit(&g_queueRequests[i]);
+        if (!queued)
+        {
+            (void) dma_queue_wait(&g_queueRequests[i]);
+        }
+    }
+    (void) dma_queue_wait(&g_queueRequests[count - 1UL]);
+    cycles = cycle_count_elapsed(start);
+
+    for (i = 0UL; i < count; i++)
+    {
+        done = done && (CY_DMAC_DONE == g_queueRequests[i].response);
+    }
+    *ok = done && (0 == memcmp(src, buffer, count * size));
+
+    return cycles;
+}
+
+/* [] END OF FILE */
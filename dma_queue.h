@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name:   dma_queue.h
+*
+* Description: This file contains the declarations of the DMA copy request queue.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_QUEUE_H
+#define DMA_QUEUE_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channel of the queue. A DMA block named DMA_QUEUE in the design
+ * defines it; otherwise the queue takes the last channel of the device. */
+#ifndef DMA_QUEUE_CHANNEL
+#define DMA_QUEUE_CHANNEL               (CPUSS_DMAC_CH_NR - 1UL)
+#endif
+
+/* Channel priority */
+#ifndef DMA_QUEUE_PRIORITY
+#define DMA_QUEUE_PRIORITY              2UL
+#endif
+
+/* Trigger multiplexer output of the queue channel, software-triggered. The
+ * outputs to the DMAC channels are numbered in channel order. */
+#ifndef DMA_QUEUE_TRIGGER
+#define DMA_QUEUE_TRIGGER               (TRIG0_OUT_CPUSS_DMAC_TR_IN0 + DMA_QUEUE_CHANNEL)
+#endif
+
+/* Bound of dma_queue_wait(), long enough for a full queue */
+#ifndef DMA_QUEUE_WAIT_TIMEOUT_MS
+#define DMA_QUEUE_WAIT_TIMEOUT_MS       100UL
+#endif
+
+/* Largest request, in bytes. Unaligned requests move one byte per element. */
+#define DMA_QUEUE_MAX_SIZE              65536UL
+
+/* Largest transfer built by merging requests. The first request of a merged
+ * transfer completes only after the bytes of the later ones, so this bounds
+ * the delay that coalescing adds. */
+#ifndef DMA_QUEUE_COALESCE_MAX_SIZE
+#define DMA_QUEUE_COALESCE_MAX_SIZE     256UL
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+typedef struct dma_queue_request dma_queue_request_t;
+
+/* Request completion callback, called from the DMAC interrupt */
+typedef void (*dma_queue_callback_t)(dma_queue_request_t *request);
+
+/* One memory-to-memory copy. The structure is owned by the caller and must
+ * stay valid until the copy is complete. */
+struct dma_queue_request
+{
+    const void *src;                    /* Source */
+    void *dst;                          /* Destination */
+    uint32_t size;                      /* Number of bytes, 1 to DMA_QUEUE_MAX_SIZE */
+    dma_queue_callback_t callback;      /* Called on completion, or NULL */
+    void *context;                      /* Application data for the callback */
+    volatile cy_en_dmac_response_t response;    /* DMA_CHAIN_RESPONSE_PENDING until complete */
+    uint32_t length;                    /* Bytes of its transfer, 0 if merged; used by the queue */
+    dma_queue_request_t *next;          /* Queue link, used by the queue */
+};
+
+/* Queue counters since dma_queue_init() or dma_queue_reset_stats() */
+typedef struct
+{
+    uint32_t requests;                  /* Requests submitted */
+    uint32_t transfers;                 /* Descriptor transfers started */
+    uint32_t merged;                    /* Requests merged into the transfer of an earlier one */
+} dma_queue_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void dma_queue_init(void);
+bool dma_queue_submit(dma_queue_request_t *request);
+bool dma_queue_is_busy(void);
+cy_en_dmac_response_t dma_queue_wait(const dma_queue_request_t *request);
+void dma_queue_set_coalescing(bool enable);
+void dma_queue_get_stats(dma_queue_stats_t *stats);
+void dma_queue_reset_stats(void);
+void dma_queue_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DMA_QUEUE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,223 @@
+/******************************************************************************
+* File Name:   dma_transfer.hpp
+*
+* Description: Header-only C++17 layer over the descriptor helpers.
+*              Transfer<T, N> deduces the transfer width from the element type
+*              and checks the element size, alignment and count at compile
+*              time. Its member functions are inline and compile to the same PDL
+*              calls and register stores as the C path.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DMA_TRANSFER_HPP
+#define DMA_TRANSFER_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "dma_transfer.hpp requires C++17"
+#endif
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "dma_chain.h"
+
+namespace dma
+{
+
+/*******************************************************************************
+* Constants
+********************************************************************************/
+
+/* Largest number of data elements of one descriptor */
+constexpr std::uint32_t max_count = 65536UL;
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Transfer width of a symmetric transfer of elements of a given size */
+template <std::size_t Size>
+struct width_of;
+
+template <>
+struct width_of<1U>
+{
+    static constexpr cy_en_dmac_data_transfer_width_t value = CY_DMAC_BYTE_BYTE;
+};
+
+template <>
+struct width_of<2U>
+{
+    static constexpr cy_en_dmac_data_transfer_width_t value = CY_DMAC_HALFWORD_HALFWORD;
+};
+
+template <>
+struct width_of<4U>
+{
+    static constexpr cy_en_dmac_data_transfer_width_t value = CY_DMAC_WORD_WORD;
+};
+
+/********************************************************************************
+* Class Name: Transfer
+*********************************************************************************
+* Summary:
+* Memory-to-memory copy of N elements of type T between two arrays. The
+* arrays are taken by reference, so their length is checked against N and
+* their addresses are aligned to T. The width is sizeof(T) on both sides:
+* an array of uint32_t moves a word per element, never a byte.
+*
+* Template Parameters:
+*  T: Element type; trivially copyable, 1, 2 or 4 bytes, naturally aligned
+*  N: Number of elements, 1 to max_count
+*
+********************************************************************************/
+template <typename T, std::uint32_t N>
+class Transfer
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "DMA elements must be trivially copyable");
+    static_assert((sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U),
+                  "DMA elements must be 1, 2 or 4 bytes");
+    static_assert((alignof(T) % sizeof(T)) == 0U,
+                  "DMA elements must be naturally aligned; packed types are misaligned");
+    static_assert((N >= 1UL) && (N <= max_count),
+                  "a descriptor moves 1 to 65536 elements");
+
+public:
+    /* Transfer width deduced from the element size */
+    static constexpr cy_en_dmac_data_transfer_width_t width = width_of<sizeof(T)>::value;
+
+    /* Number of elements */
+    static constexpr std::uint32_t count = N;
+
+    /* Number of bytes */
+    static constexpr std::uint32_t size = N * static_cast<std::uint32_t>(sizeof(T));
+
+    constexpr Transfer(const T (&src)[N], T (&dst)[N]) noexcept :
+        m_src(src),
+        m_dst(dst)
+    {
+    }
+
+    /****************************************************************************
+    * Function Name: configure
+    *****************************************************************************
+    * Summary:
+    * Configures a descriptor from a Device Configurator descriptor
+    * configuration, replacing its count, width and address increments, and
+    * sets the addresses. The channel must not be executing the descriptor.
+    *
+    * Parameters:
+    *  channel: DMAC channel number
+    *  descriptor: CY_DMAC_DESCRIPTOR_PING or CY_DMAC_DESCRIPTOR_PONG
+    *  base: Configuration providing the trigger, chaining and interrupt fields
+    *
+    * Return:
+    *  cy_en_dmac_status_t: Status of the descriptor initialization
+    *
+    ****************************************************************************/
+    cy_en_dmac_status_t configure(std::uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                  const cy_stc_dmac_descriptor_config_t &base) const noexcept
+    {
+        cy_stc_dmac_descriptor_config_t config = base;
+        cy_en_dmac_status_t status;
+
+        config.dataCount         = N;
+        config.dataTransferWidth = width;
+        config.srcAddrIncrement  = true;
+        config.dstAddrIncrement  = true;
+
+        status = Cy_DMAC_Descriptor_Init(USER_DMA_HW, channel, descriptor, &config);
+        if (CY_DMAC_SUCCESS == status)
+        {
+            Cy_DMAC_Descriptor_SetSrcAddress(USER_DMA_HW, channel, descriptor, m_src);
+            Cy_DMAC_Descriptor_SetDstAddress(USER_DMA_HW, channel, descriptor, m_dst);
+        }
+
+        return status;
+    }
+
+    /****************************************************************************
+    * Function Name: segment
+    *****************************************************************************
+    * Summary:
+    * Returns the transfer as a segment for dma_chain_config().
+    *
+    * Parameters:
+    *  triggerType: Work done per trigger
+    *  interrupt: Raise the channel interrupt on completion
+    *  retrigger: Trigger deactivation
+    *
+    * Return:
+    *  dma_chain_segment_t: Segment with the deduced width and count
+    *
+    ****************************************************************************/
+    constexpr dma_chain_segment_t segment(cy_en_dmac_trigger_type_t triggerType, bool interrupt,
+                                          cy_en_dmac_retrigger_t retrigger = CY_DMAC_RETRIG_IM) const noexcept
+    {
+        return dma_chain_segment_t
+        {
+            m_src,
+            m_dst,
+            N,
+            width,
+            triggerType,
+            retrigger,
+            true,
+            true,
+            interrupt
+        };
+    }
+
+private:
+    const T *m_src;
+    T *m_dst;
+};
+
+/* Deduces T and N from the arrays: dma::make_transfer(src, dst) */
+template <typename T, std::uint32_t N>
+constexpr Transfer<T, N> make_transfer(const T (&src)[N], T (&dst)[N]) noexcept
+{
+    return Transfer<T, N>(src, dst);
+}
+
+} /* namespace dma */
+
+#endif /* DMA_TRANSFER_HPP */
+
+/* [] END OF FILE */
@@ -0,0 +1,529 @@
+/******************************************************************************
+* File Name:   dump_compress.c
+*
+* Description: This file contains a streaming compressor for memory dumps. Bytes
+*              are optionally replaced by their difference to the previous byte
+*              (delta), which turns counters and ramps into runs, and are then
+*              run-length encoded:
+*               - control 0x00 to 0x7F: 1 to 128 literal bytes follow
+*               - control 0x80 to 0xFF: the next byte repeats 3 to 130 times
+*              The compressor keeps no more than one literal block and one output
+*              buffer, so its RAM use is fixed. See tools/dump_decompress.py.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "dump_compress.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "uart_fmt.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Control byte of a run */
+#define DUMP_COMPRESS_RUN_FLAG          0x80U
+
+/* Dump header: "DZ", version, mode, u32 address, u32 size */
+#define DUMP_COMPRESS_VERSION           1U
+#define DUMP_COMPRESS_MODE_RLE          0U
+#define DUMP_COMPRESS_MODE_DELTA        1U
+#define DUMP_COMPRESS_HEADER_SIZE       12UL
+
+/* Number of runs per data set of the benchmark. The fastest run is reported. */
+#define DUMP_COMPRESS_BENCHMARK_REPEAT  2UL
+
+#if (DUMP_COMPRESS_BENCHMARK_SIZE > DMA_BENCHMARK_MAX_SIZE)
+#error "DUMP_COMPRESS_BENCHMARK_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Data set of the benchmark */
+typedef enum
+{
+    DUMP_COMPRESS_DATA_SPARSE,          /* Zeros with a few strings, like the demo buffers */
+    DUMP_COMPRESS_DATA_RAMP,            /* Incrementing counter */
+    DUMP_COMPRESS_DATA_FLASH            /* Start of the application image */
+} dump_compress_data_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Benchmark compressor */
+static dump_compress_t g_dumpCompressBenchmark;
+
+/* Every byte of the current UART dump so far is in the TX FIFO */
+static bool g_dumpCompressUartComplete = true;
+
+/* Names of the benchmark data sets */
+static const char *const g_dumpCompressDataNames[] =
+{
+    "sparse",
+    "ramp",
+    "flash"
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void dump_compress_put(dump_compress_t *context, uint8_t value);
+static void dump_compress_flush_literal(dump_compress_t *context);
+static void dump_compress_end_run(dump_compress_t *context);
+static void dump_compress_flush_output(dump_compress_t *context);
+static void dump_compress_uart_output(const uint8_t *data, uint32_t size);
+static void dump_compress_null_output(const uint8_t *data, uint32_t size);
+static const uint8_t *dump_compress_benchmark_data(dump_compress_data_t data);
+
+/********************************************************************************
+* Function Name: dump_compress_init
+*********************************************************************************
+* Summary:
+* Starts a compressed stream.
+*
+* Parameters:
+*  context: Compressor state
+*  delta: true to encode byte differences
+*  output: Receives the compressed output
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dump_compress_init(dump_compress_t *context, bool delta, dump_compress_output_t output)
+{
+    context->output = output;
+    context->delta = delta;
+    context->previous = 0U;
+    context->runValue = 0U;
+    context->runCount = 0UL;
+    context->literalCount = 0UL;
+    context->outputCount = 0UL;
+    context->totalIn = 0UL;
+    context->totalOut = 0UL;
+}
+
+/********************************************************************************
+* Function Name: dump_compress_write
+*********************************************************************************
+* Summary:
+* Compresses data. A byte equal to the pending run extends it; any other byte
+* ends the run, which is encoded as a run if it is long enough or appended to
+* the literal block otherwise.
+*
+* Parameters:
+*  context: Compressor state
+*  data: Data to compress
+*  size: Number of bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dump_compress_write(dump_compress_t *context, const void *data, uint32_t size)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint8_t value;
+    uint32_t i;
+
+    context->totalIn += size;
+
+    for (i = 0UL; i < size; i++)
+    {
+        value = bytes[i];
+        if (context->delta)
+        {
+            value = (uint8_t) (bytes[i] - context->previous);
+            context->previous = bytes[i];
+        }
+
+        if ((0UL != context->runCount) && (value == context->runValue))
+        {
+            context->runCount++;
+            if (DUMP_COMPRESS_MAX_RUN == context->runCount)
+            {
+                dump_compress_end_run(context);
+            }
+        }
+        else
+        {
+            dump_compress_end_run(context);
+            context->runValue = value;
+            context->runCount = 1UL;
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: dump_compress_finish
+*********************************************************************************
+* Summary:
+* Encodes the pending run and literal block and passes all remaining output
+* to the output function.
+*
+* Parameters:
+*  context: Compressor state
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dump_compress_finish(dump_compress_t *context)
+{
+    dump_compress_end_run(context);
+    dump_compress_flush_literal(context);
+    dump_compress_flush_output(context);
+}
+
+/********************************************************************************
+* Function Name: dump_compress_uart
+*********************************************************************************
+* Summary:
+* Writes a compressed dump of a memory range to UART_HW: a 12-byte header
+* ("DZ", version, mode, u32 address, u32 size, little endian) followed by the
+* compressed stream. Output goes through uart_fmt_chars(), so a stalled UART
+* truncates the dump instead of blocking.
+*
+* Parameters:
+*  data: Memory to dump
+*  size: Number of bytes
+*  delta: true to encode byte differences
+*
+* Return:
+*  bool: true if the whole dump is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool dump_compress_uart(const void *data, uint32_t size, bool delta)
+{
+    dump_compress_t context;
+    uint8_t header[DUMP_COMPRESS_HEADER_SIZE];
+    uint32_t address = (uint32_t) (uintptr_t) data;
+
+    header[0] = (uint8_t) 'D';
+    header[1] = (uint8_t) 'Z';
+    header[2] = DUMP_COMPRESS_VERSION;
+    header[3] = delta ? DUMP_COMPRESS_MODE_DELTA : DUMP_COMPRESS_MODE_RLE;
+    (void) memcpy(&header[4], &address, sizeof(address));
+    (void) memcpy(&header[8], &size, sizeof(size));
+    g_dumpCompressUartComplete = true;
+    dump_compress_uart_output(header, DUMP_COMPRESS_HEADER_SIZE);
+
+    dump_compress_init(&context, delta, dump_compress_uart_output);
+    dump_compress_write(&context, data, size);
+    dump_compress_finish(&context);
+
+    return g_dumpCompressUartComplete;
+}
+
+/********************************************************************************
+* Function Name: dump_compress_benchmark_run
+*********************************************************************************
+* Summary:
+* Compresses each benchmark data set with and without delta encoding and
+* writes the compressed size and the cycles as CSV. The output is discarded,
+* so the cycles exclude the UART.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void dump_compress_benchmark_run(void)
+{
+    const uint8_t *data;
+    uint32_t set;
+    uint32_t mode;
+    uint32_t run;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t best;
+
+    dma_benchmark_csv_comment("dump_compress");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("data");
+    dma_benchmark_csv_str("mode");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("compressed");
+    dma_benchmark_csv_str("ratio_permille");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("cycles_per_byte");
+    dma_benchmark_csv_end();
+
+    for (set = 0UL; set < (sizeof(g_dumpCompressDataNames) / sizeof(g_dumpCompressDataNames[0])); set++)
+    {
+        data = dump_compress_benchmark_data((dump_compress_data_t) set);
+
+        for (mode = DUMP_COMPRESS_MODE_RLE; mode <= DUMP_COMPRESS_MODE_DELTA; mode++)
+        {
+            best = UINT32_MAX;
+            for (run = 0UL; run < DUMP_COMPRESS_BENCHMARK_REPEAT; run++)
+            {
+                start = cycle_count_now();
+                dump_compress_init(&g_dumpCompressBenchmark, (DUMP_COMPRESS_MODE_DELTA == mode),
+                                   dump_compress_null_output);
+                dump_compress_write(&g_dumpCompressBenchmark, data, DUMP_COMPRESS_BENCHMARK_SIZE);
+                dump_compress_finish(&g_dumpCompressBenchmark);
+                cycles = cycle_count_elapsed(start);
+                best = (cycles < best) ? cycles : best;
+            }
+
+            dma_benchmark_csv_begin("compress");
+            dma_benchmark_csv_str(g_dumpCompressDataNames[set]);
+            dma_benchmark_csv_str((DUMP_COMPRESS_MODE_DELTA == mode) ? "delta" : "rle");
+            dma_benchmark_csv_u32(DUMP_COMPRESS_BENCHMARK_SIZE);
+            dma_benchmark_csv_u32(g_dumpCompressBenchmark.totalOut);
+            dma_benchmark_csv_u32((g_dumpCompressBenchmark.totalOut * 1000UL) / DUMP_COMPRESS_BENCHMARK_SIZE);
+            dma_benchmark_csv_u32(best);
+            dma_benchmark_csv_u32(best / DUMP_COMPRESS_BENCHMARK_SIZE);
+            dma_benchmark_csv_end();
+        }
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: dump_compress_put
+*********************************************************************************
+* Summary:
+* Appends a byte to the output buffer.
+*
+* Parameters:
+*  context: Compressor state
+*  value: Output byte
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dump_compress_put(dump_compress_t *context, uint8_t value)
+{
+    context->buffer[context->outputCount++] = value;
+    if (DUMP_COMPRESS_OUTPUT_SIZE == context->outputCount)
+    {
+        dump_compress_flush_output(context);
+    }
+}
+
+/********************************************************************************
+* Function Name: dump_compress_flush_literal
+*********************************************************************************
+* Summary:
+* Encodes the literal block, if any.
+*
+* Parameters:
+*  context: Compressor state
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dump_compress_flush_literal(dump_compress_t *context)
+{
+    uint32_t i;
+
+    if (0UL != context->literalCount)
+    {
+        dump_compress_put(context, (uint8_t) (context->literalCount - 1UL));
+        for (i = 0UL; i < context->literalCount; i++)
+        {
+            dump_compress_put(context, context->literal[i]);
+        }
+        context->literalCount = 0UL;
+    }
+}
+
+/********************************************************************************
+* Function Name: dump_compress_end_run
+*********************************************************************************
+* Summary:
+* Ends the pending run: a run of at least DUMP_COMPRESS_MIN_RUN bytes is
+* encoded after the literal block, a shorter one is appended to the literal
+* block.
+*
+* Parameters:
+*  context: Compressor state
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dump_compress_end_run(dump_compress_t *context)
+{
+    if (context->runCount >= DUMP_COMPRESS_MIN_RUN)
+    {
+        dump_compress_flush_literal(context);
+        dump_compress_put(context, (uint8_t) (DUMP_COMPRESS_RUN_FLAG |
+                                              (context->runCount - DUMP_COMPRESS_MIN_RUN)));
+        dump_compress_put(context, context->runValue);
+    }
+    else
+    {
+        while (0UL != context->runCount)
+        {
+            context->literal[context->literalCount++] = context->runValue;
+            if (DUMP_COMPRESS_MAX_LITERAL == context->literalCount)
+            {
+                dump_compress_flush_literal(context);
+            }
+            context->runCount--;
+        }
+    }
+    context->runCount = 0UL;
+}
+
+/********************************************************************************
+* Function Name: dump_compress_flush_output
+*********************************************************************************
+* Summary:
+* Passes the output buffer to the output function.
+*
+* Parameters:
+*  context: Compressor state
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dump_compress_flush_output(dump_compress_t *context)
+{
+    if (0UL != context->outputCount)
+    {
+        context->output(context->buffer, context->outputCount);
+        context->totalOut += context->outputCount;
+        context->outputCount = 0UL;
+    }
+}
+
+/********************************************************************************
+* Function Name: dump_compress_uart_output
+*********************************************************************************
+* Summary:
+* Output function writing to UART_HW. Drops the data once a write of the dump
+* has stalled.
+*
+* Parameters:
+*  data: Compressed data
+*  size: Number of bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dump_compress_uart_output(const uint8_t *data, uint32_t size)
+{
+    if (g_dumpCompressUartComplete)
+    {
+        g_dumpCompressUartComplete = (size == uart_fmt_chars((const char *) data, size));
+    }
+}
+
+/********************************************************************************
+* Function Name: dump_compress_null_output
+*********************************************************************************
+* Summary:
+* Output function discarding the data, for the benchmark.
+*
+* Parameters:
+*  data: Compressed data
+*  size: Number of bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void dump_compress_null_output(const uint8_t *data, uint32_t size)
+{
+    CY_UNUSED_PARAMETER(data);
+    CY_UNUSED_PARAMETER(size);
+}
+
+/********************************************************************************
+* Function Name: dump_compress_benchmark_data
+*********************************************************************************
+* Summary:
+* Returns a benchmark data set of DUMP_COMPRESS_BENCHMARK_SIZE bytes. The
+* generated sets are written to the shared benchmark buffer.
+*
+* Parameters:
+*  data: Data set
+*
+* Return:
+*  const uint8_t*: Data
+*
+********************************************************************************/
+static const uint8_t *dump_compress_benchmark_data(dump_compress_data_t data)
+{
+    static const char text[] = "PSoC4_HVMS-DMADC";
+    uint8_t *buffer = dma_benchmark_scratch();
+    const uint8_t *result = buffer;
+    uint32_t i;
+
+    switch (data)
+    {
+        case DUMP_COMPRESS_DATA_SPARSE:
+            (void) memset(buffer, 0, DUMP_COMPRESS_BENCHMARK_SIZE);
+            for (i = 0UL; (i + sizeof(text)) <= DUMP_COMPRESS_BENCHMARK_SIZE; i += 128UL)
+            {
+                (void) memcpy(&buffer[i], text, sizeof(text) - 1U);
+            }
+            break;
+
+        case DUMP_COMPRESS_DATA_RAMP:
+            for (i = 0UL; i < DUMP_COMPRESS_BENCHMARK_SIZE; i++)
+            {
+                buffer[i] = (uint8_t) i;
+            }
+            break;
+
+        default:
+            result = (const uint8_t *) CY_FLASH_BASE;
+            break;
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
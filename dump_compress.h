@@ -0,0 +1,111 @@
+/******************************************************************************
+* File Name:   dump_compress.h
+*
+* Description: Public interface of the streaming dump compressor.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DUMP_COMPRESS_H
+#define DUMP_COMPRESS_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Longest literal block and run of the encoding */
+#define DUMP_COMPRESS_MAX_LITERAL       128UL
+#define DUMP_COMPRESS_MIN_RUN           3UL
+#define DUMP_COMPRESS_MAX_RUN           (DUMP_COMPRESS_MIN_RUN + 127UL)
+
+/* Output buffered before it is passed to the output function */
+#ifndef DUMP_COMPRESS_OUTPUT_SIZE
+#define DUMP_COMPRESS_OUTPUT_SIZE       64UL
+#endif
+
+/* Bytes of the benchmark data sets */
+#ifndef DUMP_COMPRESS_BENCHMARK_SIZE
+#define DUMP_COMPRESS_BENCHMARK_SIZE    512UL
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Receives compressed output */
+typedef void (*dump_compress_output_t)(const uint8_t *data, uint32_t size);
+
+/* Compressor state. All memory is in this structure. */
+typedef struct
+{
+    dump_compress_output_t output;
+    bool delta;                         /* Encode byte differences */
+    uint8_t previous;                   /* Previous input byte (delta) */
+    uint8_t runValue;                   /* Value of the pending run */
+    uint32_t runCount;                  /* Length of the pending run */
+    uint32_t literalCount;
+    uint32_t outputCount;
+    uint32_t totalIn;
+    uint32_t totalOut;
+    uint8_t literal[DUMP_COMPRESS_MAX_LITERAL];
+    uint8_t buffer[DUMP_COMPRESS_OUTPUT_SIZE];
+} dump_compress_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void dump_compress_init(dump_compress_t *context, bool delta, dump_compress_output_t output);
+void dump_compress_write(dump_compress_t *context, const void *data, uint32_t size);
+void dump_compress_finish(dump_compress_t *context);
+bool dump_compress_uart(const void *data, uint32_t size, bool delta);
+void dump_compress_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DUMP_COMPRESS_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,244 @@
+/******************************************************************************
+* File Name:   event_trace.c
+*
+* Description: This file contains the binary event trace ring and its UART dump.
+*
+*              Dump format, little-endian:
+*                offset 0: magic "DTRC"
+*                offset 4: uint8  version (EVENT_TRACE_VERSION)
+*                offset 5: uint8  record size in bytes (8)
+*                offset 6: uint16 number of records that follow
+*                offset 8: uint32 CPU clock in Hz
+*                offset 12: uint32 number of records lost to ring overwrites
+*                offset 16: records, oldest first
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "event_trace.h"
+#include "uart_fmt.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* SysTick callback slot of the wrap marker (slot 0 is the cycle counter) */
+#define EVENT_TRACE_CALLBACK_SLOT       1UL
+
+/* Size of the dump header */
+#define EVENT_TRACE_HEADER_SIZE         16U
+
+#if ((EVENT_TRACE_DEPTH & (EVENT_TRACE_DEPTH - 1UL)) != 0UL)
+#error "EVENT_TRACE_DEPTH must be a power of two"
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Trace ring */
+event_trace_t g_eventTrace;
+
+/* Number of timestamp wraps since event_trace_init() */
+static uint32_t g_eventTraceWraps = 0UL;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void event_trace_wrap_callback(void);
+static void event_trace_put_u32(uint8_t *buffer, uint32_t value);
+
+/********************************************************************************
+* Function Name: event_trace_init
+*********************************************************************************
+* Summary:
+* Clears the trace and registers the SysTick wrap marker. The wrap marker
+* guarantees at least one record per 2^24 cycles, so the host can extend the
+* 24-bit timestamps. cycle_count_init() must have been called.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void event_trace_init(void)
+{
+    g_eventTrace.head = 0UL;
+    g_eventTrace.paused = false;
+    g_eventTraceWraps = 0UL;
+
+    (void) Cy_SysTick_SetCallback(EVENT_TRACE_CALLBACK_SLOT, event_trace_wrap_callback);
+}
+
+/********************************************************************************
+* Function Name: event_trace_dump
+*********************************************************************************
+* Summary:
+* Writes the trace to UART_HW in the binary dump format and clears it.
+* Recording is paused while the dump is written, so the UART activity of the
+* dump itself is not traced. A stalled UART truncates the dump instead of
+* blocking.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void event_trace_dump(void)
+{
+    uint8_t header[EVENT_TRACE_HEADER_SIZE];
+    uint32_t head;
+    uint32_t count;
+    uint32_t first;
+    uint32_t interruptState;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    g_eventTrace.paused = true;
+    head = g_eventTrace.head;
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    count = (head < EVENT_TRACE_DEPTH) ? head : EVENT_TRACE_DEPTH;
+    first = (head - count) & (EVENT_TRACE_DEPTH - 1UL);
+
+    (void) memcpy(header, EVENT_TRACE_MAGIC, 4U);
+    header[4] = EVENT_TRACE_VERSION;
+    header[5] = (uint8_t) sizeof(event_trace_record_t);
+    header[6] = (uint8_t) count;
+    header[7] = (uint8_t) (count >> 8U);
+    event_trace_put_u32(&header[8], SystemCoreClock);
+    event_trace_put_u32(&header[12], head - count);
+
+    (void) uart_fmt_chars((const char *) header, EVENT_TRACE_HEADER_SIZE);
+
+    /* Oldest records up to the end of the ring, then the wrapped part */
+    if ((first + count) > EVENT_TRACE_DEPTH)
+    {
+        (void) uart_fmt_chars((const char *) &g_eventTrace.ring[first],
+                              (EVENT_TRACE_DEPTH - first) * sizeof(event_trace_record_t));
+        (void) uart_fmt_chars((const char *) &g_eventTrace.ring[0],
+                              ((first + count) - EVENT_TRACE_DEPTH) * sizeof(event_trace_record_t));
+    }
+    else
+    {
+        (void) uart_fmt_chars((const char *) &g_eventTrace.ring[first],
+                              count * sizeof(event_trace_record_t));
+    }
+
+    (void) uart_fmt_flush();
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    g_eventTrace.head = 0UL;
+    g_eventTrace.paused = false;
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+/********************************************************************************
+* Function Name: event_trace_wrap_callback
+*********************************************************************************
+* Summary:
+* SysTick callback. Records the timestamp wrap marker, whose argument is the
+* wrap count. While nothing else is recorded, the second of two consecutive
+* markers is moved to the current wrap instead of adding one marker per wrap,
+* so an idle period does not flush the ring. The first marker and the count
+* in the second let the host restore the wraps in between.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void event_trace_wrap_callback(void)
+{
+#if (EVENT_TRACE_ENABLE)
+    uint32_t interruptState;
+    event_trace_record_t *newest;
+    const event_trace_record_t *previous;
+
+    g_eventTraceWraps++;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    newest = &g_eventTrace.ring[(g_eventTrace.head - 1UL) & (EVENT_TRACE_DEPTH - 1UL)];
+    previous = &g_eventTrace.ring[(g_eventTrace.head - 2UL) & (EVENT_TRACE_DEPTH - 1UL)];
+    if ((g_eventTrace.head >= 2UL) && !g_eventTrace.paused &&
+        (EVENT_TRACE_WRAP == (newest->stamp >> EVENT_TRACE_ID_POS)) &&
+        (EVENT_TRACE_WRAP == (previous->stamp >> EVENT_TRACE_ID_POS)))
+    {
+        newest->stamp = ((uint32_t) EVENT_TRACE_WRAP << EVENT_TRACE_ID_POS) |
+                        (CYCLE_COUNT_RELOAD - SysTick->VAL);
+        newest->arg = g_eventTraceWraps;
+    }
+    else
+    {
+        event_trace_record(EVENT_TRACE_WRAP, g_eventTraceWraps);
+    }
+    Cy_SysLib_ExitCriticalSection(interruptState);
+#else
+    g_eventTraceWraps++;
+#endif
+}
+
+/********************************************************************************
+* Function Name: event_trace_put_u32
+*********************************************************************************
+* Summary:
+* Stores a 32-bit value little-endian.
+*
+* Parameters:
+*  buffer: Destination, 4 bytes
+*  value: Value to store
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void event_trace_put_u32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t) value;
+    buffer[1] = (uint8_t) (value >> 8U);
+    buffer[2] = (uint8_t) (value >> 16U);
+    buffer[3] = (uint8_t) (value >> 24U);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,181 @@
+/******************************************************************************
+* File Name:   event_trace.h
+*
+* Description: Public interface of the binary event trace. Events are stored in a
+*              fixed SRAM ring with a 24-bit CPU cycle timestamp and dumped over
+*              UART_HW on demand.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef EVENT_TRACE_H
+#define EVENT_TRACE_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "cycle_count.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Set to 0 to compile all trace points out */
+#ifndef EVENT_TRACE_ENABLE
+#define EVENT_TRACE_ENABLE              (1u)
+#endif
+
+/* Number of records in the ring, a power of two. 8 bytes per record. */
+#ifndef EVENT_TRACE_DEPTH
+#define EVENT_TRACE_DEPTH               128UL
+#endif
+
+/* Dump format identification */
+#define EVENT_TRACE_MAGIC               "DTRC"
+#define EVENT_TRACE_VERSION             1U
+
+/* Record layout: stamp = (id << 24) | 24-bit up-counting cycle timestamp */
+#define EVENT_TRACE_ID_POS              24U
+#define EVENT_TRACE_STAMP_MASK          0x00FFFFFFUL
+
+/* Argument layout of DMA events */
+#define EVENT_TRACE_DMA_ARG(channel, descriptor, response) \
+    (((uint32_t) (response) << 16U) | ((uint32_t) (channel) << 8U) | (uint32_t) (descriptor))
+
+/* Descriptor field of DMA events when the descriptor is not known */
+#define EVENT_TRACE_DESCR_UNKNOWN       0xFFUL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Event identifiers. Values are part of the dump format. */
+typedef enum
+{
+    EVENT_TRACE_WRAP        = 0x01U,    /* Timestamp wrapped, arg: wrap count */
+    EVENT_TRACE_DMA_SELECT  = 0x10U,    /* Descriptor selected, arg: EVENT_TRACE_DMA_ARG */
+    EVENT_TRACE_DMA_TRIGGER = 0x11U,    /* Trigger issued, arg: EVENT_TRACE_DMA_ARG */
+    EVENT_TRACE_DMA_DONE    = 0x12U,    /* Descriptor completed, arg: EVENT_TRACE_DMA_ARG */
+    EVENT_TRACE_DMA_RECOVER = 0x13U,    /* Channel reset, arg: EVENT_TRACE_DMA_ARG */
+    EVENT_TRACE_ISR_ENTER   = 0x20U,    /* Interrupt handler entry, arg: IRQ number */
+    EVENT_TRACE_ISR_EXIT    = 0x21U,    /* Interrupt handler exit, arg: IRQ number */
+    EVENT_TRACE_UART_TX     = 0x30U,    /* Data placed in TX FIFO, arg: TX FIFO level */
+    EVENT_TRACE_UART_RX     = 0x31U,    /* Data read from RX FIFO, arg: RX FIFO level */
+    EVENT_TRACE_SPI_START   = 0x40U,    /* SPI transaction started, arg: size in bytes */
+    EVENT_TRACE_SPI_DONE    = 0x41U,    /* SPI transaction completed, arg: EVENT_TRACE_DMA_ARG */
+    EVENT_TRACE_I2C_START   = 0x50U,    /* I2C read started, arg: size in bytes */
+    EVENT_TRACE_I2C_DONE    = 0x51U,    /* I2C read completed, arg: i2c_dma_status_t */
+    EVENT_TRACE_POWER_SLEEP = 0x60U,    /* CPU entering Sleep, arg: awaited channel */
+    EVENT_TRACE_POWER_WAKE  = 0x61U,    /* CPU woken from Sleep, arg: awaited channel */
+    EVENT_TRACE_USER        = 0x80U     /* First application-defined identifier */
+} event_trace_id_t;
+
+/* One trace record */
+typedef struct
+{
+    uint32_t stamp;                     /* Event identifier and timestamp */
+    uint32_t arg;                       /* Event argument */
+} event_trace_record_t;
+
+/* Trace ring */
+typedef struct
+{
+    uint32_t head;                      /* Number of records written */
+    bool paused;                        /* Recording paused during a dump */
+    event_trace_record_t ring[EVENT_TRACE_DEPTH];
+} event_trace_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+extern event_trace_t g_eventTrace;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void event_trace_init(void);
+void event_trace_dump(void);
+
+/********************************************************************************
+* Function Name: event_trace_record
+*********************************************************************************
+* Summary:
+* Appends a record to the trace ring, overwriting the oldest record when the
+* ring is full. Safe to call from any context. Compiles to a short sequence of
+* register operations with interrupts masked for about a dozen cycles.
+*
+* Parameters:
+*  id: Event identifier, event_trace_id_t or application-defined
+*  arg: Event argument
+*
+* Return:
+*  void
+*
+********************************************************************************/
+__STATIC_FORCEINLINE void event_trace_record(uint32_t id, uint32_t arg)
+{
+#if (EVENT_TRACE_ENABLE)
+    uint32_t interruptState = __get_PRIMASK();
+    event_trace_record_t *record;
+
+    __disable_irq();
+    if (!g_eventTrace.paused)
+    {
+        record = &g_eventTrace.ring[g_eventTrace.head & (EVENT_TRACE_DEPTH - 1UL)];
+        g_eventTrace.head++;
+        record->stamp = (id << EVENT_TRACE_ID_POS) | (CYCLE_COUNT_RELOAD - SysTick->VAL);
+        record->arg = arg;
+    }
+    __set_PRIMASK(interruptState);
+#else
+    CY_UNUSED_PARAMETER(id);
+    CY_UNUSED_PARAMETER(arg);
+#endif
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* EVENT_TRACE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,375 @@
+/******************************************************************************
+* File Name:   flash_verify.c
+*
+* Description: This file contains the flash integrity check. The DMAC copies the
+*              region in chunks into two SRAM staging buffers while the CPU
+*              computes the CRC-32 of the buffer filled before, so the copy time
+*              is hidden behind the checksum. A sequential check with CPU reads
+*              of flash is the reference.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "flash_verify.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* CRC-32 (IEEE 802.3, reflected), as computed by zlib */
+#define FLASH_VERIFY_CRC_INIT           0xFFFFFFFFUL
+#define FLASH_VERIFY_CRC_XOR            0xFFFFFFFFUL
+
+/* Number of staging buffers */
+#define FLASH_VERIFY_BUFFERS            2UL
+
+/* Bound of each chunk copy */
+#define FLASH_VERIFY_TIMEOUT_MS         10UL
+
+/* CPU cycles per microsecond */
+#define FLASH_VERIFY_CYCLES_PER_US      (SystemCoreClock / 1000000UL)
+
+#if (FLASH_VERIFY_STAGING_SIZE > DMA_BENCHMARK_MAX_SIZE)
+#error "FLASH_VERIFY_CHUNK_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* CRC-32 (reflected polynomial 0xEDB88320) for one nibble */
+static const uint32_t g_verifyCrcTable[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/* Descriptor filling the staging buffer of the same index */
+static const cy_en_dmac_descriptor_t g_verifyDescriptors[FLASH_VERIFY_BUFFERS] =
+{
+    CY_DMAC_DESCRIPTOR_PING,
+    CY_DMAC_DESCRIPTOR_PONG
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static bool flash_verify_dma(const void *start, uint32_t size, uint8_t *staging, bool overlap, uint32_t *crc);
+static uint32_t flash_verify_fetch(const uint8_t *src, uint32_t size, uint8_t *staging, uint32_t chunk);
+static void flash_verify_row(const char *method, uint32_t cycles, bool ok);
+
+/********************************************************************************
+* Function Name: flash_verify_crc32_update
+*********************************************************************************
+* Summary:
+* Adds data to a running CRC-32. Start with 0xFFFFFFFF and invert the result
+* after the last call; flash_verify_sequential() and flash_verify_pipelined()
+* return the final value. A nibble table keeps the flash cost at 64 bytes.
+*
+* Parameters:
+*  crc: Running CRC
+*  data: Data to add
+*  size: Number of bytes
+*
+* Return:
+*  uint32_t: Updated running CRC
+*
+********************************************************************************/
+uint32_t flash_verify_crc32_update(uint32_t crc, const uint8_t *data, uint32_t size)
+{
+    uint32_t value = crc;
+    uint32_t i;
+
+    for (i = 0UL; i < size; i++)
+    {
+        value = (value >> 4U) ^ g_verifyCrcTable[(value ^ data[i]) & 0xFU];
+        value = (value >> 4U) ^ g_verifyCrcTable[(value ^ ((uint32_t) data[i] >> 4U)) & 0xFU];
+    }
+
+    return value;
+}
+
+/********************************************************************************
+* Function Name: flash_verify_sequential
+*********************************************************************************
+* Summary:
+* Computes the CRC-32 of a region with CPU reads, as a boot check without
+* the DMAC does.
+*
+* Parameters:
+*  start: Start of the region
+*  size: Size in bytes
+*
+* Return:
+*  uint32_t: CRC-32 of the region
+*
+********************************************************************************/
+uint32_t flash_verify_sequential(const void *start, uint32_t size)
+{
+    return flash_verify_crc32_update(FLASH_VERIFY_CRC_INIT, (const uint8_t *) start, size) ^
+           FLASH_VERIFY_CRC_XOR;
+}
+
+/********************************************************************************
+* Function Name: flash_verify_pipelined
+*********************************************************************************
+* Summary:
+* Computes the CRC-32 of a region with the DMAC copying the next chunk into
+* one staging buffer while the CPU checksums the other. The DMAC must be
+* enabled. The FLASH_VERIFY_CHANNEL descriptors are reprogrammed.
+*
+* Parameters:
+*  start: Start of the region, word-aligned
+*  size: Size in bytes, a multiple of 4
+*  staging: FLASH_VERIFY_STAGING_SIZE bytes of SRAM, word-aligned, for the
+*           two staging buffers
+*  crc: CRC-32 of the region, valid if the function returns true
+*
+* Return:
+*  bool: true if the region was read, false if the arguments are invalid or
+*        a copy failed; the channel is then reset
+*
+********************************************************************************/
+bool flash_verify_pipelined(const void *start, uint32_t size, uint8_t *staging, uint32_t *crc)
+{
+    return flash_verify_dma(start, size, staging, true, crc);
+}
+
+/********************************************************************************
+* Function Name: flash_verify_dma
+*********************************************************************************
+* Summary:
+* Copies a region chunk by chunk into the staging buffers and checksums them.
+* With overlap, the copy of the next chunk is started before the current
+* one is checksummed; without, each copy completes before its checksum and
+* the next copy starts after it.
+*
+* Parameters:
+*  start: Start of the region, word-aligned
+*  size: Size in bytes, a multiple of 4
+*  staging: Staging buffers, FLASH_VERIFY_STAGING_SIZE bytes
+*  overlap: Copy the next chunk while checksumming the current one
+*  crc: CRC-32 of the region, valid if the function returns true
+*
+* Return:
+*  bool: true if the region was read
+*
+********************************************************************************/
+static bool flash_verify_dma(const void *start, uint32_t size, uint8_t *staging, bool overlap, uint32_t *crc)
+{
+    const uint8_t *src = (const uint8_t *) start;
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(FLASH_VERIFY_TIMEOUT_MS);
+    uint32_t chunks = (size + FLASH_VERIFY_CHUNK_SIZE - 1UL) / FLASH_VERIFY_CHUNK_SIZE;
+    uint32_t value = FLASH_VERIFY_CRC_INIT;
+    uint32_t length = 0UL;
+    uint32_t next = 0UL;
+    uint32_t chunk;
+    uint32_t buffer;
+    dma_chain_status_t status = DMA_CHAIN_STATUS_DONE;
+    bool ok = (0UL != size) && (0UL == (size & 3UL)) && (0UL == ((uintptr_t) start & 3UL)) &&
+              (0UL == ((uintptr_t) staging & 3UL));
+
+    if (ok)
+    {
+        next = flash_verify_fetch(src, size, staging, 0UL);
+
+        for (chunk = 0UL; (chunk < chunks) && (DMA_CHAIN_STATUS_DONE == status); chunk++)
+        {
+            buffer = chunk % FLASH_VERIFY_BUFFERS;
+            status = dma_chain_wait_timeout(FLASH_VERIFY_CHANNEL, g_verifyDescriptors[buffer], timeout);
+
+            if (DMA_CHAIN_STATUS_DONE == status)
+            {
+                length = next;
+                if (overlap && ((chunk + 1UL) < chunks))
+                {
+                    next = flash_verify_fetch(src, size, staging, chunk + 1UL);
+                }
+
+                value = flash_verify_crc32_update(value, &staging[buffer * FLASH_VERIFY_CHUNK_SIZE], length);
+
+                if (!overlap && ((chunk + 1UL) < chunks))
+                {
+                    next = flash_verify_fetch(src, size, staging, chunk + 1UL);
+                }
+            }
+        }
+
+        if (DMA_CHAIN_STATUS_DONE != status)
+        {
+            dma_chain_recover(FLASH_VERIFY_CHANNEL);
+            Cy_DMAC_Channel_Enable(USER_DMA_HW, FLASH_VERIFY_CHANNEL);
+            ok = false;
+        }
+    }
+
+    *crc = value ^ FLASH_VERIFY_CRC_XOR;
+
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: flash_verify_fetch
+*********************************************************************************
+* Summary:
+* Starts the copy of a chunk into the staging buffer of its descriptor. The
+* last chunk may be shorter than FLASH_VERIFY_CHUNK_SIZE.
+*
+* Parameters:
+*  src: Start of the region
+*  size: Size of the region in bytes
+*  staging: Staging buffers, FLASH_VERIFY_STAGING_SIZE bytes
+*  chunk: Index of the chunk
+*
+* Return:
+*  uint32_t: Number of bytes copied
+*
+********************************************************************************/
+static uint32_t flash_verify_fetch(const uint8_t *src, uint32_t size, uint8_t *staging, uint32_t chunk)
+{
+    uint32_t offset = chunk * FLASH_VERIFY_CHUNK_SIZE;
+    uint32_t length = ((size - offset) < FLASH_VERIFY_CHUNK_SIZE) ? (size - offset) : FLASH_VERIFY_CHUNK_SIZE;
+    uint32_t buffer = chunk % FLASH_VERIFY_BUFFERS;
+    const dma_chain_segment_t segment =
+    {
+        .src          = &src[offset],
+        .dst          = &staging[buffer * FLASH_VERIFY_CHUNK_SIZE],
+        .count        = length / 4UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = false
+    };
+
+    (void) dma_chain_config(FLASH_VERIFY_CHANNEL, g_verifyDescriptors[buffer], &segment);
+    dma_chain_start(FLASH_VERIFY_CHANNEL, g_verifyDescriptors[buffer]);
+    dma_chain_trigger();
+
+    return length;
+}
+
+/********************************************************************************
+* Function Name: flash_verify_benchmark_run
+*********************************************************************************
+* Summary:
+* Checks FLASH_VERIFY_SIZE bytes at FLASH_VERIFY_START with CPU reads, with
+* DMA copies that do not overlap the checksum, and with the pipeline, and
+* writes the verification time as CSV. ok compares the CRC with the one of
+* the CPU reads. The staging buffers are in the shared benchmark buffer. The
+* cycle counter, the DMAC and UART_HW must be enabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void flash_verify_benchmark_run(void)
+{
+    const void *start = (const void *) FLASH_VERIFY_START;
+    uint8_t *staging = dma_benchmark_scratch();
+    uint32_t reference;
+    uint32_t crc;
+    uint32_t begin;
+    uint32_t cycles;
+    bool ok;
+
+    dma_benchmark_csv_comment("flash_verify");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("chunk");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("us");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    begin = cycle_count_now();
+    reference = flash_verify_sequential(start, FLASH_VERIFY_SIZE);
+    cycles = cycle_count_elapsed(begin);
+    flash_verify_row("cpu", cycles, true);
+
+    begin = cycle_count_now();
+    ok = flash_verify_dma(start, FLASH_VERIFY_SIZE, staging, false, &crc);
+    cycles = cycle_count_elapsed(begin);
+    flash_verify_row("dma_serial", cycles, ok && (crc == reference));
+
+    begin = cycle_count_now();
+    ok = flash_verify_pipelined(start, FLASH_VERIFY_SIZE, staging, &crc);
+    cycles = cycle_count_elapsed(begin);
+    flash_verify_row("dma_pipelined", cycles, ok && (crc == reference));
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: flash_verify_row
+*********************************************************************************
+* Summary:
+* Writes one benchmark result as CSV.
+*
+* Parameters:
+*  method: Name of the method
+*  cycles: CPU cycles of the check
+*  ok: The check read the region and its CRC matches
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void flash_verify_row(const char *method, uint32_t cycles, bool ok)
+{
+    dma_benchmark_csv_begin("flash_verify");
+    dma_benchmark_csv_str(method);
+    dma_benchmark_csv_u32(FLASH_VERIFY_SIZE);
+    dma_benchmark_csv_u32(FLASH_VERIFY_CHUNK_SIZE);
+    dma_benchmark_csv_u32(cycles);
+    dma_benchmark_csv_u32(cycles / FLASH_VERIFY_CYCLES_PER_US);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/******************************************************************************
+* File Name:   flash_verify.h
+*
+* Description: This file contains the declarations of the flash integrity check.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef FLASH_VERIFY_H
+#define FLASH_VERIFY_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Region checked by the benchmark. The default is the whole flash; set it
+ * to the application image to skip the erased rows after it. */
+#ifndef FLASH_VERIFY_START
+#define FLASH_VERIFY_START              CY_FLASH_BASE
+#endif
+
+#ifndef FLASH_VERIFY_SIZE
+#define FLASH_VERIFY_SIZE               CY_FLASH_SIZE
+#endif
+
+/* Bytes per staging buffer, a multiple of 4 */
+#ifndef FLASH_VERIFY_CHUNK_SIZE
+#define FLASH_VERIFY_CHUNK_SIZE         512UL
+#endif
+
+/* Size of the caller's staging area, which holds two staging buffers */
+#define FLASH_VERIFY_STAGING_SIZE       (2UL * FLASH_VERIFY_CHUNK_SIZE)
+
+/* DMAC channel of the pipeline, software-triggered */
+#define FLASH_VERIFY_CHANNEL            USER_DMA_CHANNEL
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+uint32_t flash_verify_crc32_update(uint32_t crc, const uint8_t *data, uint32_t size);
+uint32_t flash_verify_sequential(const void *start, uint32_t size);
+bool flash_verify_pipelined(const void *start, uint32_t size, uint8_t *staging, uint32_t *crc);
+void flash_verify_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLASH_VERIFY_H */
+
+/* [] END OF FILE */
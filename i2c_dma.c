@@ -0,0 +1,642 @@
+/******************************************************************************
+* File Name:   i2c_dma.c
+*
+* Description: This file contains I2C master register-block reads through the DMAC.
+*              The CPU sends the address phase with the low-level PDL functions; the
+*              data bytes are acknowledged by the SCB and moved from the RX FIFO into
+*              the caller's buffer by a DMAC channel. The channel interrupts before the
+*              last byte, which is not acknowledged, and after it to send the STOP.
+*              Reads are queued, so several devices can be read in one sequence.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "i2c_dma.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Progress of the read in progress */
+typedef enum
+{
+    I2C_DMA_PHASE_IDLE,                 /* No data expected */
+    I2C_DMA_PHASE_BULK,                 /* PING receives all but the last byte */
+    I2C_DMA_PHASE_LAST,                 /* The last byte is received without ACK */
+    I2C_DMA_PHASE_COMPLETE              /* STOP sent, result in g_i2cDmaResult */
+} i2c_dma_phase_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* I2C master SCB and its PDL context */
+static CySCB_Type *g_i2cDmaBase = NULL;
+static cy_stc_scb_i2c_context_t *g_i2cDmaContext = NULL;
+
+/* Read in progress (queue head) and last queued read */
+static i2c_dma_read_t *g_i2cDmaHead = NULL;
+static i2c_dma_read_t *g_i2cDmaTail = NULL;
+
+/* State of the read in progress, shared with the DMAC interrupt */
+static volatile i2c_dma_phase_t g_i2cDmaPhase = I2C_DMA_PHASE_IDLE;
+static volatile i2c_dma_status_t g_i2cDmaResult = I2C_DMA_DONE;
+static cy_en_dmac_descriptor_t g_i2cDmaLastDescriptor = CY_DMAC_DESCRIPTOR_PING;
+
+/* Benchmark buffers: one per queued read, and the reference read */
+static uint8_t g_i2cDmaBenchmarkData[I2C_DMA_BENCHMARK_BATCH][I2C_DMA_BENCHMARK_MAX_SIZE];
+static uint8_t g_i2cDmaBenchmarkReference[I2C_DMA_BENCHMARK_MAX_SIZE];
+static i2c_dma_read_t g_i2cDmaBenchmarkReads[I2C_DMA_BENCHMARK_BATCH];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void i2c_dma_start(i2c_dma_read_t *read);
+static void i2c_dma_arm(const i2c_dma_read_t *read);
+static void i2c_dma_callback(uint32_t channel);
+static i2c_dma_status_t i2c_dma_pdl_read(uint32_t address, uint8_t reg, uint8_t *data, uint32_t size);
+static void i2c_dma_benchmark_pdl(uint32_t reads, uint32_t size);
+static void i2c_dma_benchmark_dma(uint32_t reads, uint32_t size);
+static void i2c_dma_benchmark_row(const char *method, uint32_t reads, uint32_t size,
+                                  uint32_t cycles, uint32_t cpuCycles, bool ok);
+
+/********************************************************************************
+* Function Name: i2c_dma_init
+*********************************************************************************
+* Summary:
+* Routes the I2C SCB RX request to the receiver channel and enables the
+* channel. The SCB must be initialized as I2C master and enabled, and the
+* DMAC enabled.
+*
+* Parameters:
+*  base: SCB of the I2C master, other than UART_HW
+*  context: PDL context passed to Cy_SCB_I2C_Init()
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void i2c_dma_init(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    const cy_stc_dmac_channel_config_t channelConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = I2C_DMA_PRIORITY,
+        .enable     = false
+    };
+
+    /* The SCB of UART_HW cannot serve as the I2C master */
+    CY_ASSERT(UART_HW != base);
+
+    g_i2cDmaBase = base;
+    g_i2cDmaContext = context;
+    g_i2cDmaHead = NULL;
+    g_i2cDmaTail = NULL;
+    g_i2cDmaPhase = I2C_DMA_PHASE_IDLE;
+
+    /* Data bytes are acknowledged by command until a read arms the receiver;
+     * an RX request per byte */
+    SCB_I2C_CTRL(base) &= ~SCB_I2C_CTRL_M_READY_DATA_ACK_Msk;
+    Cy_SCB_SetRxFifoLevel(base, 0UL);
+
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, I2C_DMA_CHANNEL, &channelConfig);
+    dma_chain_register_callback(I2C_DMA_CHANNEL, i2c_dma_callback);
+#if defined(I2C_DMA_TRIGGER_IN)
+    dma_chain_connect(I2C_DMA_CHANNEL, I2C_DMA_TRIGGER_IN, I2C_DMA_TRIGGER_OUT);
+#else
+    dma_chain_connect(I2C_DMA_CHANNEL, DMA_CHAIN_SCB_RX_TRIGGER(base), I2C_DMA_TRIGGER_OUT);
+#endif
+
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, I2C_DMA_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_submit
+*********************************************************************************
+* Summary:
+* Appends a read to the queue and starts it if the bus is idle. Starting a
+* read sends its address phase, which blocks for about three byte times.
+* Call from thread context only, including read callbacks.
+*
+* Parameters:
+*  read: Read, not already queued
+*
+* Return:
+*  bool: true if the read was queued, false if the size is out of range
+*
+********************************************************************************/
+bool i2c_dma_submit(i2c_dma_read_t *read)
+{
+    if ((NULL == read->data) || (0UL == read->size) || (read->size > I2C_DMA_MAX_SIZE))
+    {
+        return false;
+    }
+
+    read->status = I2C_DMA_PENDING;
+    read->next = NULL;
+
+    if (NULL == g_i2cDmaHead)
+    {
+        g_i2cDmaHead = read;
+        g_i2cDmaTail = read;
+        i2c_dma_start(read);
+    }
+    else
+    {
+        g_i2cDmaTail->next = read;
+        g_i2cDmaTail = read;
+    }
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_poll
+*********************************************************************************
+* Summary:
+* Completes the read in progress once its STOP has been sent: sets its
+* status, starts the next queued read and calls the callback. Call from the
+* main loop.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if a read was completed
+*
+********************************************************************************/
+bool i2c_dma_poll(void)
+{
+    i2c_dma_read_t *read = g_i2cDmaHead;
+
+    if ((NULL == read) || (I2C_DMA_PHASE_COMPLETE != g_i2cDmaPhase))
+    {
+        return false;
+    }
+
+    g_i2cDmaPhase = I2C_DMA_PHASE_IDLE;
+    read->status = g_i2cDmaResult;
+    event_trace_record(EVENT_TRACE_I2C_DONE, (uint32_t) read->status);
+
+    g_i2cDmaHead = read->next;
+    if (NULL == g_i2cDmaHead)
+    {
+        g_i2cDmaTail = NULL;
+    }
+    else
+    {
+        i2c_dma_start(g_i2cDmaHead);
+    }
+
+    if (NULL != read->callback)
+    {
+        read->callback(read);
+    }
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_is_busy
+*********************************************************************************
+* Summary:
+* Reports whether reads are in progress or queued.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true while the queue is not empty
+*
+********************************************************************************/
+bool i2c_dma_is_busy(void)
+{
+    return (NULL != g_i2cDmaHead);
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_wait
+*********************************************************************************
+* Summary:
+* Polls the engine until a submitted read is complete, for at most
+* I2C_DMA_WAIT_TIMEOUT_MS. After a timeout, for example while a device holds
+* the clock low, i2c_dma_init() resets the engine.
+*
+* Parameters:
+*  read: Submitted read
+*
+* Return:
+*  i2c_dma_status_t: Result of the read, I2C_DMA_PENDING on timeout
+*
+********************************************************************************/
+i2c_dma_status_t i2c_dma_wait(const i2c_dma_read_t *read)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(I2C_DMA_WAIT_TIMEOUT_MS);
+    uint32_t start = cycle_count_now();
+
+    while ((I2C_DMA_PENDING == read->status) && !cycle_count_expired(start, timeout))
+    {
+        (void) i2c_dma_poll();
+    }
+
+    return read->status;
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_benchmark_run
+*********************************************************************************
+* Summary:
+* Reads register blocks of the benchmark device with the CPU-driven PDL
+* functions and through the DMAC, one read at a time and as a batch of
+* I2C_DMA_BENCHMARK_BATCH reads, and writes the cycles as CSV. cpu_cycles
+* counts the time spent in the engine functions and excludes the two short
+* DMAC interrupts per read. i2c_dma_init() must have been called.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void i2c_dma_benchmark_run(void)
+{
+    static const uint32_t sizes[] = { 1UL, 6UL, I2C_DMA_BENCHMARK_MAX_SIZE };
+    uint32_t i;
+
+    dma_benchmark_csv_comment("i2c_dma");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("reads");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("cycles_per_read");
+    dma_benchmark_csv_str("cpu_cycles");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (i = 0UL; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        /* The PDL read also provides the reference data */
+        i2c_dma_benchmark_pdl(1UL, sizes[i]);
+        i2c_dma_benchmark_dma(1UL, sizes[i]);
+        i2c_dma_benchmark_pdl(I2C_DMA_BENCHMARK_BATCH, sizes[i]);
+        i2c_dma_benchmark_dma(I2C_DMA_BENCHMARK_BATCH, sizes[i]);
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_start
+*********************************************************************************
+* Summary:
+* Sends the address phase of a read and arms the receiver before the repeated
+* START, so the first data byte finds the channel ready. On failure the bus
+* is released and the read completes with I2C_DMA_ADDRESS_ERROR.
+*
+* Parameters:
+*  read: Read to start
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void i2c_dma_start(i2c_dma_read_t *read)
+{
+    cy_en_scb_i2c_status_t status;
+
+    event_trace_record(EVENT_TRACE_I2C_START, read->size);
+    g_i2cDmaResult = I2C_DMA_DONE;
+
+    status = Cy_SCB_I2C_MasterSendStart(g_i2cDmaBase, read->address, CY_SCB_I2C_WRITE_XFER,
+                                        I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    if (CY_SCB_I2C_SUCCESS == status)
+    {
+        status = Cy_SCB_I2C_MasterWriteByte(g_i2cDmaBase, read->reg, I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    }
+    if (CY_SCB_I2C_SUCCESS == status)
+    {
+        i2c_dma_arm(read);
+        status = Cy_SCB_I2C_MasterSendReStart(g_i2cDmaBase, read->address, CY_SCB_I2C_READ_XFER,
+                                              I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    }
+
+    if (CY_SCB_I2C_SUCCESS != status)
+    {
+        SCB_I2C_CTRL(g_i2cDmaBase) &= ~SCB_I2C_CTRL_M_READY_DATA_ACK_Msk;
+        (void) Cy_SCB_I2C_MasterSendStop(g_i2cDmaBase, I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+        g_i2cDmaResult = I2C_DMA_ADDRESS_ERROR;
+        g_i2cDmaPhase = I2C_DMA_PHASE_COMPLETE;
+    }
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_arm
+*********************************************************************************
+* Summary:
+* Configures the receiver for a read. For more than one byte, PING receives
+* all but the last byte with the SCB acknowledging them, and PONG receives
+* the last byte. Both interrupt on completion.
+*
+* Parameters:
+*  read: Read to receive
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void i2c_dma_arm(const i2c_dma_read_t *read)
+{
+    dma_chain_segment_t segment =
+    {
+        .src          = (const void *) &SCB_RX_FIFO_RD(g_i2cDmaBase),
+        .dst          = read->data,
+        .count        = read->size - 1UL,
+        .width        = CY_DMAC_WORD_BYTE,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+
+    if (read->size > 1UL)
+    {
+        (void) dma_chain_config(I2C_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+        segment.dst = &read->data[read->size - 1UL];
+        segment.count = 1UL;
+        (void) dma_chain_config(I2C_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &segment);
+        g_i2cDmaLastDescriptor = CY_DMAC_DESCRIPTOR_PONG;
+        g_i2cDmaPhase = I2C_DMA_PHASE_BULK;
+        SCB_I2C_CTRL(g_i2cDmaBase) |= SCB_I2C_CTRL_M_READY_DATA_ACK_Msk;
+    }
+    else
+    {
+        segment.count = 1UL;
+        (void) dma_chain_config(I2C_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+        g_i2cDmaLastDescriptor = CY_DMAC_DESCRIPTOR_PING;
+        g_i2cDmaPhase = I2C_DMA_PHASE_LAST;
+    }
+
+    dma_chain_start(I2C_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_callback
+*********************************************************************************
+* Summary:
+* Receiver completion callback. After PING, the SCB stops acknowledging, so
+* the last byte is held with the clock stretched. This must happen within one
+* byte time of the second to last byte. After the last byte, NACK and STOP
+* are sent.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void i2c_dma_callback(uint32_t channel)
+{
+    cy_en_dmac_response_t response;
+
+    if (I2C_DMA_PHASE_BULK == g_i2cDmaPhase)
+    {
+        SCB_I2C_CTRL(g_i2cDmaBase) &= ~SCB_I2C_CTRL_M_READY_DATA_ACK_Msk;
+        g_i2cDmaPhase = I2C_DMA_PHASE_LAST;
+
+        response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, CY_DMAC_DESCRIPTOR_PING);
+        if (CY_DMAC_DONE != response)
+        {
+            g_i2cDmaResult = I2C_DMA_TRANSFER_ERROR;
+            SCB_I2C_M_CMD(g_i2cDmaBase) = SCB_I2C_M_CMD_M_NACK_Msk | SCB_I2C_M_CMD_M_STOP_Msk;
+            g_i2cDmaPhase = I2C_DMA_PHASE_COMPLETE;
+            return;
+        }
+    }
+
+    if (I2C_DMA_PHASE_LAST == g_i2cDmaPhase)
+    {
+        response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, g_i2cDmaLastDescriptor);
+        if (DMA_CHAIN_RESPONSE_PENDING != response)
+        {
+            if (CY_DMAC_DONE != response)
+            {
+                g_i2cDmaResult = I2C_DMA_TRANSFER_ERROR;
+            }
+            SCB_I2C_M_CMD(g_i2cDmaBase) = SCB_I2C_M_CMD_M_NACK_Msk | SCB_I2C_M_CMD_M_STOP_Msk;
+            g_i2cDmaPhase = I2C_DMA_PHASE_COMPLETE;
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_pdl_read
+*********************************************************************************
+* Summary:
+* Reference read with the CPU-driven low-level PDL functions, one byte at a
+* time.
+*
+* Parameters:
+*  address: 7-bit device address
+*  reg: First register
+*  data: Receive buffer
+*  size: Number of bytes
+*
+* Return:
+*  i2c_dma_status_t: I2C_DMA_DONE or I2C_DMA_ADDRESS_ERROR
+*
+********************************************************************************/
+static i2c_dma_status_t i2c_dma_pdl_read(uint32_t address, uint8_t reg, uint8_t *data, uint32_t size)
+{
+    cy_en_scb_i2c_status_t status;
+    uint32_t i;
+
+    status = Cy_SCB_I2C_MasterSendStart(g_i2cDmaBase, address, CY_SCB_I2C_WRITE_XFER,
+                                        I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    if (CY_SCB_I2C_SUCCESS == status)
+    {
+        status = Cy_SCB_I2C_MasterWriteByte(g_i2cDmaBase, reg, I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    }
+    if (CY_SCB_I2C_SUCCESS == status)
+    {
+        status = Cy_SCB_I2C_MasterSendReStart(g_i2cDmaBase, address, CY_SCB_I2C_READ_XFER,
+                                              I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    }
+    for (i = 0UL; (i < size) && (CY_SCB_I2C_SUCCESS == status); i++)
+    {
+        status = Cy_SCB_I2C_MasterReadByte(g_i2cDmaBase, ((i + 1UL) < size) ? CY_SCB_I2C_ACK : CY_SCB_I2C_NAK,
+                                           &data[i], I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+    }
+    (void) Cy_SCB_I2C_MasterSendStop(g_i2cDmaBase, I2C_DMA_TIMEOUT_MS, g_i2cDmaContext);
+
+    return (CY_SCB_I2C_SUCCESS == status) ? I2C_DMA_DONE : I2C_DMA_ADDRESS_ERROR;
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_benchmark_pdl
+*********************************************************************************
+* Summary:
+* Measures reads with the CPU-driven PDL functions and keeps the data of the
+* last read as the reference.
+*
+* Parameters:
+*  reads: Number of consecutive reads
+*  size: Bytes per read
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void i2c_dma_benchmark_pdl(uint32_t reads, uint32_t size)
+{
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t i;
+    bool ok = true;
+
+    start = cycle_count_now();
+    for (i = 0UL; i < reads; i++)
+    {
+        ok = (I2C_DMA_DONE == i2c_dma_pdl_read(I2C_DMA_BENCHMARK_ADDRESS, I2C_DMA_BENCHMARK_REGISTER,
+                                               g_i2cDmaBenchmarkReference, size)) && ok;
+    }
+    cycles = cycle_count_elapsed(start);
+
+    i2c_dma_benchmark_row("pdl", reads, size, cycles, cycles, ok);
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_benchmark_dma
+*********************************************************************************
+* Summary:
+* Measures queued reads through the DMAC and compares their data with the
+* reference.
+*
+* Parameters:
+*  reads: Number of queued reads
+*  size: Bytes per read
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void i2c_dma_benchmark_dma(uint32_t reads, uint32_t size)
+{
+    uint32_t start;
+    uint32_t mark;
+    uint32_t cycles;
+    uint32_t cpuCycles = 0UL;
+    uint32_t i;
+    bool ok = true;
+
+    (void) memset(g_i2cDmaBenchmarkData, 0, sizeof(g_i2cDmaBenchmarkData));
+
+    start = cycle_count_now();
+    for (i = 0UL; i < reads; i++)
+    {
+        g_i2cDmaBenchmarkReads[i] = (i2c_dma_read_t)
+        {
+            .address = I2C_DMA_BENCHMARK_ADDRESS,
+            .reg     = I2C_DMA_BENCHMARK_REGISTER,
+            .data    = g_i2cDmaBenchmarkData[i],
+            .size    = size
+        };
+        mark = cycle_count_now();
+        (void) i2c_dma_submit(&g_i2cDmaBenchmarkReads[i]);
+        cpuCycles += cycle_count_elapsed(mark);
+    }
+    while (i2c_dma_is_busy())
+    {
+        mark = cycle_count_now();
+        if (i2c_dma_poll())
+        {
+            cpuCycles += cycle_count_elapsed(mark);
+        }
+    }
+    cycles = cycle_count_elapsed(start);
+
+    for (i = 0UL; i < reads; i++)
+    {
+        ok = ok && (I2C_DMA_DONE == g_i2cDmaBenchmarkReads[i].status) &&
+             (0 == memcmp(g_i2cDmaBenchmarkData[i], g_i2cDmaBenchmarkReference, size));
+    }
+
+    i2c_dma_benchmark_row("dma", reads, size, cycles, cpuCycles, ok);
+}
+
+/********************************************************************************
+* Function Name: i2c_dma_benchmark_row
+*********************************************************************************
+* Summary:
+* Writes one benchmark result as CSV.
+*
+* Parameters:
+*  method: "pdl" or "dma"
+*  reads: Number of reads
+*  size: Bytes per read
+*  cycles: Cycles from the first START to the last STOP
+*  cpuCycles: Cycles the CPU spent in the read functions
+*  ok: All reads succeeded and returned the reference data
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void i2c_dma_benchmark_row(const char *method, uint32_t reads, uint32_t size,
+                                  uint32_t cycles, uint32_t cpuCycles, bool ok)
+{
+    dma_benchmark_csv_begin("i2c");
+    dma_benchmark_csv_str(method);
+    dma_benchmark_csv_u32(reads);
+    dma_benchmark_csv_u32(size);
+    dma_benchmark_csv_u32(cycles);
+    dma_benchmark_csv_u32(cycles / reads);
+    dma_benchmark_csv_u32(cpuCycles);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,152 @@
+/******************************************************************************
+* File Name:   i2c_dma.h
+*
+* Description: Public interface of the I2C master burst reads through the DMAC.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef I2C_DMA_H
+#define I2C_DMA_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channel of the receiver */
+#ifndef I2C_DMA_CHANNEL
+#define I2C_DMA_CHANNEL                 5UL
+#endif
+
+/* Channel priority */
+#ifndef I2C_DMA_PRIORITY
+#define I2C_DMA_PRIORITY                0UL
+#endif
+
+/* Trigger multiplexer input of the I2C SCB RX request and the output to the
+ * receiver channel. Unless I2C_DMA_TRIGGER_IN is defined, i2c_dma_init()
+ * derives the input from the SCB it is given, which is the design alias of
+ * the I2C block, such as I2C_HW. */
+#ifndef I2C_DMA_TRIGGER_OUT
+#define I2C_DMA_TRIGGER_OUT             TRIG0_OUT_CPUSS_DMAC_TR_IN5
+#endif
+
+/* Timeout of each bus operation of the address phase */
+#ifndef I2C_DMA_TIMEOUT_MS
+#define I2C_DMA_TIMEOUT_MS              10UL
+#endif
+
+/* Bound of i2c_dma_wait() */
+#ifndef I2C_DMA_WAIT_TIMEOUT_MS
+#define I2C_DMA_WAIT_TIMEOUT_MS         100UL
+#endif
+
+/* Largest read, in bytes */
+#define I2C_DMA_MAX_SIZE                65536UL
+
+/* Benchmark device: 7-bit address and first register of a block that does
+ * not change between reads (identification or calibration data) */
+#ifndef I2C_DMA_BENCHMARK_ADDRESS
+#define I2C_DMA_BENCHMARK_ADDRESS       0x76UL
+#endif
+
+#ifndef I2C_DMA_BENCHMARK_REGISTER
+#define I2C_DMA_BENCHMARK_REGISTER      0x88U
+#endif
+
+/* Largest read and number of reads per batch of the benchmark */
+#define I2C_DMA_BENCHMARK_MAX_SIZE      24UL
+#define I2C_DMA_BENCHMARK_BATCH         4UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Result of a read */
+typedef enum
+{
+    I2C_DMA_PENDING,                    /* Queued or in progress */
+    I2C_DMA_DONE,                       /* All bytes received */
+    I2C_DMA_ADDRESS_ERROR,              /* Address or register not acknowledged, or bus error */
+    I2C_DMA_TRANSFER_ERROR              /* DMAC error response */
+} i2c_dma_status_t;
+
+typedef struct i2c_dma_read i2c_dma_read_t;
+
+/* Read completion callback, called from i2c_dma_poll() */
+typedef void (*i2c_dma_callback_t)(i2c_dma_read_t *read);
+
+/* One register block read: START, address + W, register, repeated START,
+ * address + R, size bytes, STOP. The structure is owned by the caller and
+ * must stay valid until the read is complete. */
+struct i2c_dma_read
+{
+    uint32_t address;                   /* 7-bit device address */
+    uint8_t reg;                        /* First register */
+    uint8_t *data;                      /* Receive buffer */
+    uint32_t size;                      /* Number of bytes, 1 to I2C_DMA_MAX_SIZE */
+    i2c_dma_callback_t callback;        /* Called on completion, or NULL */
+    void *context;                      /* Application data for the callback */
+    volatile i2c_dma_status_t status;
+    i2c_dma_read_t *next;               /* Queue link, used by the engine */
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void i2c_dma_init(CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+bool i2c_dma_submit(i2c_dma_read_t *read);
+bool i2c_dma_poll(void);
+bool i2c_dma_is_busy(void);
+i2c_dma_status_t i2c_dma_wait(const i2c_dma_read_t *read);
+void i2c_dma_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* I2C_DMA_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,900 @@
+/******************************************************************************
+* File Name:   lin.c
+*
+* Description: This file contains a LIN frame engine on UART_HW. The break, sync
+*              and protected identifier are handled by the CPU; in DMA mode, the
+*              response data and checksum are moved by the DMAC, and the CPU returns
+*              only to verify the checksum. In byte mode, every byte is handled in the
+*              UART interrupt, as in a conventional LIN driver; the benchmark compares
+*              the interrupt count and CPU load per frame of both modes.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "lin.h"
+#include "baud_tune.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "uart_fmt.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Frame identifier bits of the protected identifier */
+#define LIN_ID_MASK                     0x3FU
+
+/* Benchmark response sizes */
+#define LIN_BENCHMARK_SIZES             3UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Position in the frame */
+typedef enum
+{
+    LIN_STATE_IDLE,                     /* Waiting for a break */
+    LIN_STATE_SYNC,                     /* Byte mode: waiting for the sync field */
+    LIN_STATE_PID,                      /* Byte mode: waiting for the protected identifier */
+    LIN_STATE_HEADER,                   /* DMA mode: waiting for sync and identifier */
+    LIN_STATE_RESPONSE                  /* Response in progress */
+} lin_state_t;
+
+/* State of UART_HW and of the DMAC channels that the engine borrows */
+typedef struct
+{
+    baud_tune_setting_t setting;
+    dma_chain_callback_t rxCallback;
+    dma_chain_callback_t txCallback;
+    dma_chain_route_t rxRoute;
+    dma_chain_route_t txRoute;
+} lin_saved_t;
+
+/* Result of one benchmark configuration */
+typedef struct
+{
+    bool dma;
+    uint32_t size;
+    uint32_t frames;
+    uint32_t cycles;
+    lin_stats_t stats;
+} lin_benchmark_result_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Frame table */
+static lin_frame_t *g_linFrames = NULL;
+static uint32_t g_linFrameCount = 0UL;
+
+/* Response data by DMAC instead of by interrupt */
+static bool g_linDma = false;
+
+/* Frame in progress */
+static volatile lin_state_t g_linState = LIN_STATE_IDLE;
+static lin_frame_t *g_linFrame = NULL;
+static uint32_t g_linIndex = 0UL;
+
+/* Readback of a published response */
+static uint8_t g_linReadback[LIN_MAX_DATA + 1UL];
+
+/* Value written to the TX FIFO control register to stop the requests */
+static const uint32_t g_linTxFifoStop = 0UL;
+
+static volatile lin_stats_t g_linStats;
+
+/* State restored by lin_stop() */
+static lin_saved_t g_linSaved;
+
+/* UART_HW interrupt configuration */
+static const cy_stc_sysint_t g_linIntrConfig =
+{
+    .intrSrc      = LIN_INTR_SRC,
+    .intrPriority = LIN_INTR_PRIORITY
+};
+
+/* Benchmark frame and results */
+static lin_frame_t g_linBenchmarkFrame;
+static lin_benchmark_result_t g_linBenchmarkResults[2UL * LIN_BENCHMARK_SIZES];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void lin_isr(void);
+static void lin_dma_callback(uint32_t channel);
+static void lin_on_break(void);
+static void lin_on_header(void);
+static void lin_on_byte(uint8_t value);
+static bool lin_start_response(uint8_t pid);
+static void lin_arm_dma(void);
+static void lin_finish(void);
+static void lin_abort(void);
+static uint8_t lin_checksum(const lin_frame_t *frame, uint8_t pid);
+static void lin_benchmark_measure(lin_benchmark_result_t *result, bool dma, uint32_t size);
+
+/********************************************************************************
+* Function Name: lin_init
+*********************************************************************************
+* Summary:
+* Switches UART_HW to LIN_BAUD_RATE and starts the engine with a frame table.
+* The engine answers every header whose identifier is in the table, including
+* the headers sent by lin_send_header(). The UART_HW clock setting and, with
+* dma, the callbacks and trigger routes of the channels are saved for
+* lin_stop(). The DMAC must be enabled.
+*
+* Parameters:
+*  frames: Frame table, valid while the engine runs
+*  count: Number of entries
+*  dma: true to move the response data by DMAC, false to handle every byte
+*       in the interrupt
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void lin_init(lin_frame_t *frames, uint32_t count, bool dma)
+{
+    const cy_stc_dmac_channel_config_t rxConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = UART_RX_DMA_PRIORITY,
+        .enable     = false
+    };
+    const cy_stc_dmac_channel_config_t txConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = UART_TX_DMA_PRIORITY,
+        .enable     = false
+    };
+    baud_tune_setting_t setting;
+
+    g_linFrames = frames;
+    g_linFrameCount = count;
+    g_linDma = dma;
+    g_linState = LIN_STATE_IDLE;
+    (void) memset((void *) &g_linStats, 0, sizeof(g_linStats));
+
+    baud_tune_get_setting(&g_linSaved.setting);
+    if (baud_tune_find(LIN_BAUD_RATE, &setting))
+    {
+        baud_tune_apply(&setting);
+    }
+
+    if (dma)
+    {
+        g_linSaved.rxCallback = dma_chain_get_callback(LIN_RX_DMA_CHANNEL);
+        g_linSaved.txCallback = dma_chain_get_callback(LIN_TX_DMA_CHANNEL);
+        dma_chain_get_route(LIN_RX_DMA_CHANNEL, &g_linSaved.rxRoute);
+        dma_chain_get_route(LIN_TX_DMA_CHANNEL, &g_linSaved.txRoute);
+
+        (void) Cy_DMAC_Channel_Init(USER_DMA_HW, LIN_RX_DMA_CHANNEL, &rxConfig);
+        (void) Cy_DMAC_Channel_Init(USER_DMA_HW, LIN_TX_DMA_CHANNEL, &txConfig);
+        dma_chain_register_callback(LIN_RX_DMA_CHANNEL, lin_dma_callback);
+        dma_chain_register_callback(LIN_TX_DMA_CHANNEL, NULL);
+        dma_chain_connect(LIN_RX_DMA_CHANNEL, UART_RX_DMA_TRIGGER_IN, UART_RX_DMA_TRIGGER_OUT);
+        dma_chain_connect(LIN_TX_DMA_CHANNEL, UART_TX_DMA_TRIGGER_IN, UART_TX_DMA_TRIGGER_OUT);
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, LIN_TX_DMA_CHANNEL);
+    }
+    Cy_SCB_SetTxFifoLevel(UART_HW, 0UL);
+
+    (void) Cy_SysInt_Init(&g_linIntrConfig, lin_isr);
+    NVIC_EnableIRQ(g_linIntrConfig.intrSrc);
+    Cy_SCB_ClearRxInterrupt(UART_HW, CY_SCB_UART_RX_BREAK_DETECT | CY_SCB_UART_RX_TRIGGER);
+    Cy_SCB_SetRxInterruptMask(UART_HW, CY_SCB_UART_RX_BREAK_DETECT);
+}
+
+/********************************************************************************
+* Function Name: lin_stop
+*********************************************************************************
+* Summary:
+* Stops the engine and restores the UART_HW clock setting, the channel
+* callbacks and the trigger routes saved by lin_init(). The channels are left
+* disabled and their descriptors are not restored, so drivers that owned them,
+* such as uart_rx_dma and uart_tx_dma, must be initialized again.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void lin_stop(void)
+{
+    Cy_SCB_SetRxInterruptMask(UART_HW, 0UL);
+    NVIC_DisableIRQ(g_linIntrConfig.intrSrc);
+    lin_abort();
+    if (g_linDma)
+    {
+        Cy_DMAC_Channel_Disable(USER_DMA_HW, LIN_TX_DMA_CHANNEL);
+        dma_chain_register_callback(LIN_RX_DMA_CHANNEL, g_linSaved.rxCallback);
+        dma_chain_register_callback(LIN_TX_DMA_CHANNEL, g_linSaved.txCallback);
+        if (g_linSaved.rxRoute.connected)
+        {
+            dma_chain_connect(LIN_RX_DMA_CHANNEL, g_linSaved.rxRoute.inTrig, g_linSaved.rxRoute.outTrig);
+        }
+        if (g_linSaved.txRoute.connected)
+        {
+            dma_chain_connect(LIN_TX_DMA_CHANNEL, g_linSaved.txRoute.inTrig, g_linSaved.txRoute.outTrig);
+        }
+    }
+    g_linState = LIN_STATE_IDLE;
+
+    /* The saved setting, not the one baud_tune_find() gives for the same
+     * rate: the design uses 35/12 and a negotiated rate must survive */
+    baud_tune_apply(&g_linSaved.setting);
+}
+
+/********************************************************************************
+* Function Name: lin_send_header
+*********************************************************************************
+* Summary:
+* Sends a frame header as master: break, sync field and protected identifier.
+* Blocks for the break.
+*
+* Parameters:
+*  id: Frame identifier, 0 to 63
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void lin_send_header(uint8_t id)
+{
+    Cy_SCB_UART_SendBreakBlocking(UART_HW, LIN_BREAK_BITS);
+    Cy_SCB_WriteTxFifo(UART_HW, LIN_SYNC);
+    Cy_SCB_WriteTxFifo(UART_HW, lin_protected_id(id));
+}
+
+/********************************************************************************
+* Function Name: lin_protected_id
+*********************************************************************************
+* Summary:
+* Adds the parity bits to a frame identifier.
+*
+* Parameters:
+*  id: Frame identifier, 0 to 63
+*
+* Return:
+*  uint8_t: Protected identifier
+*
+********************************************************************************/
+uint8_t lin_protected_id(uint8_t id)
+{
+    uint32_t bits = (uint32_t) id & LIN_ID_MASK;
+    uint32_t p0 = (bits ^ (bits >> 1U) ^ (bits >> 2U) ^ (bits >> 4U)) & 1UL;
+    uint32_t p1 = ~((bits >> 1U) ^ (bits >> 3U) ^ (bits >> 4U) ^ (bits >> 5U)) & 1UL;
+
+    return (uint8_t) (bits | (p0 << 6U) | (p1 << 7U));
+}
+
+/********************************************************************************
+* Function Name: lin_get_stats
+*********************************************************************************
+* Summary:
+* Returns a copy of the engine statistics.
+*
+* Parameters:
+*  stats: Receives the statistics
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void lin_get_stats(lin_stats_t *stats)
+{
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+    *stats = g_linStats;
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+/********************************************************************************
+* Function Name: lin_benchmark_run
+*********************************************************************************
+* Summary:
+* Sends LIN_BENCHMARK_FRAMES published frames of 2, 4 and 8 data bytes as
+* master in byte mode and in DMA mode, and writes the interrupts and the
+* interrupt cycles per frame as CSV. TX and RX of UART_HW must be connected,
+* as through a LIN transceiver. The terminal is unusable until the results
+* are printed at the default baud rate.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void lin_benchmark_run(void)
+{
+    static const uint32_t sizes[LIN_BENCHMARK_SIZES] = { 2UL, 4UL, LIN_MAX_DATA };
+    lin_benchmark_result_t *result;
+    uint32_t i;
+
+    (void) uart_fmt_str("# lin: switching to LIN baud rate\r\n");
+    (void) uart_fmt_flush();
+
+    for (i = 0UL; i < (2UL * LIN_BENCHMARK_SIZES); i++)
+    {
+        lin_benchmark_measure(&g_linBenchmarkResults[i], (i >= LIN_BENCHMARK_SIZES),
+                              sizes[i % LIN_BENCHMARK_SIZES]);
+    }
+
+    dma_benchmark_csv_comment("lin");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("mode");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("frames");
+    dma_benchmark_csv_str("errors");
+    dma_benchmark_csv_str("isrs_per_frame");
+    dma_benchmark_csv_str("isr_cycles_per_frame");
+    dma_benchmark_csv_str("frame_cycles");
+    dma_benchmark_csv_str("cpu_permille");
+    dma_benchmark_csv_end();
+
+    for (i = 0UL; i < (2UL * LIN_BENCHMARK_SIZES); i++)
+    {
+        result = &g_linBenchmarkResults[i];
+        dma_benchmark_csv_begin("lin");
+        dma_benchmark_csv_str(result->dma ? "dma" : "byte");
+        dma_benchmark_csv_u32(result->size);
+        dma_benchmark_csv_u32(result->stats.frames);
+        dma_benchmark_csv_u32(result->stats.errors);
+        dma_benchmark_csv_u32(result->stats.isrCount / result->frames);
+        dma_benchmark_csv_u32(result->stats.isrCycles / result->frames);
+        dma_benchmark_csv_u32(result->cycles / result->frames);
+        dma_benchmark_csv_u32((result->stats.isrCycles * 1000UL) / result->cycles);
+        dma_benchmark_csv_end();
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: lin_isr
+*********************************************************************************
+* Summary:
+* UART_HW interrupt handler: break detection, and the RX FIFO level for the
+* header (DMA mode) or every byte (byte mode).
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_isr(void)
+{
+    uint32_t start = cycle_count_now();
+    uint32_t status = Cy_SCB_GetRxInterruptStatusMasked(UART_HW);
+
+    if (0UL != (status & CY_SCB_UART_RX_BREAK_DETECT))
+    {
+        lin_on_break();
+    }
+    else if (0UL != (status & CY_SCB_UART_RX_TRIGGER))
+    {
+        if (g_linDma)
+        {
+            lin_on_header();
+        }
+        else
+        {
+            while ((0UL != Cy_SCB_UART_GetNumInRxFifo(UART_HW)) && (LIN_STATE_IDLE != g_linState))
+            {
+                lin_on_byte((uint8_t) Cy_SCB_ReadRxFifo(UART_HW));
+            }
+        }
+    }
+    else
+    {
+        /* No other source is enabled */
+    }
+
+    /* The level interrupt is set again while the FIFO is above the level */
+    Cy_SCB_ClearRxInterrupt(UART_HW, status);
+
+    g_linStats.isrCount++;
+    g_linStats.isrCycles += cycle_count_elapsed(start);
+}
+
+/********************************************************************************
+* Function Name: lin_dma_callback
+*********************************************************************************
+* Summary:
+* Receiver completion callback: the response and checksum, or the readback of
+* the published response, are in memory.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_dma_callback(uint32_t channel)
+{
+    uint32_t start = cycle_count_now();
+
+    Cy_DMAC_Channel_Disable(USER_DMA_HW, channel);
+    if (LIN_STATE_RESPONSE == g_linState)
+    {
+        lin_finish();
+    }
+
+    g_linStats.isrCount++;
+    g_linStats.isrCycles += cycle_count_elapsed(start);
+}
+
+/********************************************************************************
+* Function Name: lin_on_break
+*********************************************************************************
+* Summary:
+* Starts a frame. A response still in progress is incomplete.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_on_break(void)
+{
+    if (LIN_STATE_IDLE != g_linState)
+    {
+        g_linStats.errors++;
+        lin_abort();
+    }
+
+    /* Drop the break character and a level interrupt left from the last response */
+    Cy_SCB_ClearRxFifo(UART_HW);
+    Cy_SCB_ClearRxInterrupt(UART_HW, CY_SCB_UART_RX_TRIGGER);
+
+    if (g_linDma)
+    {
+        /* One interrupt for sync and identifier together */
+        Cy_SCB_SetRxFifoLevel(UART_HW, 1UL);
+        g_linState = LIN_STATE_HEADER;
+    }
+    else
+    {
+        Cy_SCB_SetRxFifoLevel(UART_HW, 0UL);
+        g_linState = LIN_STATE_SYNC;
+    }
+    Cy_SCB_SetRxInterruptMask(UART_HW, CY_SCB_UART_RX_BREAK_DETECT | CY_SCB_UART_RX_TRIGGER);
+}
+
+/********************************************************************************
+* Function Name: lin_on_header
+*********************************************************************************
+* Summary:
+* DMA mode: checks the sync field and protected identifier and hands the
+* response to the DMAC.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_on_header(void)
+{
+    uint8_t sync;
+    uint8_t pid;
+
+    if (Cy_SCB_UART_GetNumInRxFifo(UART_HW) < 2UL)
+    {
+        return;
+    }
+    sync = (uint8_t) Cy_SCB_ReadRxFifo(UART_HW);
+    pid = (uint8_t) Cy_SCB_ReadRxFifo(UART_HW);
+
+    Cy_SCB_SetRxInterruptMask(UART_HW, CY_SCB_UART_RX_BREAK_DETECT);
+    Cy_SCB_SetRxFifoLevel(UART_HW, 0UL);
+    g_linState = LIN_STATE_IDLE;
+
+    if (LIN_SYNC != sync)
+    {
+        g_linStats.errors++;
+    }
+    else if (lin_start_response(pid))
+    {
+        lin_arm_dma();
+    }
+    else
+    {
+        /* Not in the frame table, or parity error */
+    }
+}
+
+/********************************************************************************
+* Function Name: lin_on_byte
+*********************************************************************************
+* Summary:
+* Byte mode: processes one received byte. A published response is sent one
+* byte at a time, each after the readback of the previous one.
+*
+* Parameters:
+*  value: Received byte
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_on_byte(uint8_t value)
+{
+    lin_frame_t *frame = g_linFrame;
+
+    switch (g_linState)
+    {
+        case LIN_STATE_SYNC:
+            if (LIN_SYNC == value)
+            {
+                g_linState = LIN_STATE_PID;
+            }
+            else
+            {
+                g_linStats.errors++;
+                g_linState = LIN_STATE_IDLE;
+            }
+            break;
+
+        case LIN_STATE_PID:
+            g_linState = LIN_STATE_IDLE;
+            if (lin_start_response(value))
+            {
+                g_linIndex = 0UL;
+                g_linState = LIN_STATE_RESPONSE;
+                if (LIN_FRAME_PUBLISH == g_linFrame->direction)
+                {
+                    Cy_SCB_WriteTxFifo(UART_HW, g_linFrame->data[0]);
+                }
+            }
+            break;
+
+        case LIN_STATE_RESPONSE:
+            if (LIN_FRAME_PUBLISH == frame->direction)
+            {
+                g_linReadback[g_linIndex] = value;
+            }
+            else
+            {
+                frame->data[g_linIndex] = value;
+            }
+            g_linIndex++;
+
+            if (g_linIndex > frame->size)
+            {
+                lin_finish();
+            }
+            else if (LIN_FRAME_PUBLISH == frame->direction)
+            {
+                Cy_SCB_WriteTxFifo(UART_HW, frame->data[g_linIndex]);
+            }
+            else
+            {
+                /* Wait for the next byte */
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (LIN_STATE_IDLE == g_linState)
+    {
+        Cy_SCB_SetRxInterruptMask(UART_HW, CY_SCB_UART_RX_BREAK_DETECT);
+    }
+}
+
+/********************************************************************************
+* Function Name: lin_start_response
+*********************************************************************************
+* Summary:
+* Checks the parity of a protected identifier and looks it up in the frame
+* table. For a published frame, appends the checksum to the data.
+*
+* Parameters:
+*  pid: Received protected identifier
+*
+* Return:
+*  bool: true if this node takes part in the response
+*
+********************************************************************************/
+static bool lin_start_response(uint8_t pid)
+{
+    uint8_t id = pid & LIN_ID_MASK;
+    uint32_t i;
+
+    if (lin_protected_id(id) != pid)
+    {
+        g_linStats.errors++;
+        return false;
+    }
+
+    for (i = 0UL; i < g_linFrameCount; i++)
+    {
+        if (g_linFrames[i].id == id)
+        {
+            g_linFrame = &g_linFrames[i];
+            if (LIN_FRAME_PUBLISH == g_linFrame->direction)
+            {
+                g_linFrame->data[g_linFrame->size] = lin_checksum(g_linFrame, pid);
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/********************************************************************************
+* Function Name: lin_arm_dma
+*********************************************************************************
+* Summary:
+* DMA mode: the receiver collects the data bytes and checksum, into the frame
+* or, for a published frame, into the readback buffer, and interrupts on the
+* last byte. For a published frame, the transmitter sends data and checksum
+* and then stops the TX FIFO requests as in uart_tx_dma.c.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_arm_dma(void)
+{
+    lin_frame_t *frame = g_linFrame;
+    bool publish = (LIN_FRAME_PUBLISH == frame->direction);
+    const dma_chain_segment_t rx =
+    {
+        .src          = (const void *) &SCB_RX_FIFO_RD(UART_HW),
+        .dst          = publish ? g_linReadback : frame->data,
+        .count        = (uint32_t) frame->size + 1UL,
+        .width        = CY_DMAC_WORD_BYTE,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+    const dma_chain_segment_t tx =
+    {
+        .src          = frame->data,
+        .dst          = (void *) &SCB_TX_FIFO_WR(UART_HW),
+        .count        = (uint32_t) frame->size + 1UL,
+        .width        = CY_DMAC_BYTE_WORD,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = true,
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+    const dma_chain_segment_t stop =
+    {
+        .src          = &g_linTxFifoStop,
+        .dst          = (void *) &SCB_TX_FIFO_CTRL(UART_HW),
+        .count        = 1UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+
+    g_linState = LIN_STATE_RESPONSE;
+
+    (void) dma_chain_config(LIN_RX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &rx);
+    dma_chain_start(LIN_RX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, LIN_RX_DMA_CHANNEL);
+
+    if (publish)
+    {
+        (void) dma_chain_config(LIN_TX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &tx);
+        (void) dma_chain_config(LIN_TX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &stop);
+        dma_chain_start(LIN_TX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        Cy_SCB_SetTxFifoLevel(UART_HW, UART_TX_DMA_FIFO_LEVEL);
+    }
+}
+
+/********************************************************************************
+* Function Name: lin_finish
+*********************************************************************************
+* Summary:
+* Completes a response: checks the checksum of a received response or the
+* readback of a sent one.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_finish(void)
+{
+    lin_frame_t *frame = g_linFrame;
+    uint32_t length = (uint32_t) frame->size + 1UL;
+    bool ok;
+
+    if (LIN_FRAME_PUBLISH == frame->direction)
+    {
+        ok = (0 == memcmp(g_linReadback, frame->data, length));
+    }
+    else
+    {
+        ok = (lin_checksum(frame, lin_protected_id(frame->id)) == frame->data[frame->size]);
+    }
+
+    if (ok)
+    {
+        frame->updated = true;
+        g_linStats.frames++;
+    }
+    else
+    {
+        g_linStats.errors++;
+    }
+    g_linState = LIN_STATE_IDLE;
+}
+
+/********************************************************************************
+* Function Name: lin_abort
+*********************************************************************************
+* Summary:
+* Stops the DMAC part of a response in progress.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_abort(void)
+{
+    if (g_linDma)
+    {
+        Cy_SCB_SetTxFifoLevel(UART_HW, 0UL);
+        Cy_DMAC_Channel_Disable(USER_DMA_HW, LIN_RX_DMA_CHANNEL);
+    }
+}
+
+/********************************************************************************
+* Function Name: lin_checksum
+*********************************************************************************
+* Summary:
+* Computes the checksum of a frame: the inverted sum with carry of the data
+* bytes, and of the protected identifier for the enhanced model.
+*
+* Parameters:
+*  frame: Frame
+*  pid: Protected identifier
+*
+* Return:
+*  uint8_t: Checksum
+*
+********************************************************************************/
+static uint8_t lin_checksum(const lin_frame_t *frame, uint8_t pid)
+{
+    uint32_t sum = 0UL;
+    uint32_t i;
+
+    if ((LIN_CHECKSUM_ENHANCED == frame->checksum) &&
+        (LIN_ID_MASTER_REQUEST != frame->id) && (LIN_ID_SLAVE_RESPONSE != frame->id))
+    {
+        sum = pid;
+    }
+
+    for (i = 0UL; i < frame->size; i++)
+    {
+        sum += frame->data[i];
+        if (sum > 0xFFUL)
+        {
+            sum -= 0xFFUL;
+        }
+    }
+
+    return (uint8_t) ~sum;
+}
+
+/********************************************************************************
+* Function Name: lin_benchmark_measure
+*********************************************************************************
+* Summary:
+* Sends the benchmark frames for one mode and size and records the results.
+*
+* Parameters:
+*  result: Receives the results
+*  dma: Engine mode
+*  size: Data bytes per frame
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void lin_benchmark_measure(lin_benchmark_result_t *result, bool dma, uint32_t size)
+{
+    uint32_t timeout = (SystemCoreClock / 1000UL) * LIN_BENCHMARK_TIMEOUT_MS;
+    uint32_t start;
+    uint32_t frameStart;
+    uint32_t i;
+
+    g_linBenchmarkFrame.id = LIN_BENCHMARK_ID;
+    g_linBenchmarkFrame.direction = LIN_FRAME_PUBLISH;
+    g_linBenchmarkFrame.checksum = LIN_CHECKSUM_ENHANCED;
+    g_linBenchmarkFrame.size = (uint8_t) size;
+    for (i = 0UL; i < size; i++)
+    {
+        g_linBenchmarkFrame.data[i] = (uint8_t) (0xA0UL + i);
+    }
+
+    lin_init(&g_linBenchmarkFrame, 1UL, dma);
+
+    start = cycle_count_now();
+    for (i = 0UL; i < LIN_BENCHMARK_FRAMES; i++)
+    {
+        g_linBenchmarkFrame.updated = false;
+        frameStart = cycle_count_now();
+        lin_send_header(LIN_BENCHMARK_ID);
+        while ((!g_linBenchmarkFrame.updated) && (cycle_count_elapsed(frameStart) < timeout))
+        {
+        }
+    }
+    result->cycles = cycle_count_elapsed(start);
+
+    lin_stop();
+
+    result->dma = dma;
+    result->size = size;
+    result->frames = LIN_BENCHMARK_FRAMES;
+    lin_get_stats(&result->stats);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,155 @@
+/******************************************************************************
+* File Name:   lin.h
+*
+* Description: Public interface of the LIN frame engine on UART_HW.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef LIN_H
+#define LIN_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "uart_rx_dma.h"
+#include "uart_tx_dma.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Bit rate of the bus */
+#ifndef LIN_BAUD_RATE
+#define LIN_BAUD_RATE                   19200UL
+#endif
+
+/* Length of the break sent by lin_send_header(), in bits */
+#define LIN_BREAK_BITS                  13UL
+
+/* Sync field value */
+#define LIN_SYNC                        0x55U
+
+/* Largest response, in data bytes */
+#define LIN_MAX_DATA                    8UL
+
+/* Frame identifiers of the diagnostic frames, always with classic checksum */
+#define LIN_ID_MASTER_REQUEST           0x3CU
+#define LIN_ID_SLAVE_RESPONSE           0x3DU
+
+/* DMAC channels of the response. They are shared with the UART receiver and
+ * transmitter, which cannot be used while the LIN engine runs. */
+#ifndef LIN_RX_DMA_CHANNEL
+#define LIN_RX_DMA_CHANNEL              UART_RX_DMA_CHANNEL
+#endif
+
+#ifndef LIN_TX_DMA_CHANNEL
+#define LIN_TX_DMA_CHANNEL              UART_TX_DMA_CHANNEL
+#endif
+
+/* Interrupt of UART_HW and its priority */
+#ifndef LIN_INTR_SRC
+#define LIN_INTR_SRC                    UART_IRQ
+#endif
+
+#define LIN_INTR_PRIORITY               1UL
+
+/* Benchmark: frame identifier, frames per size, and frame timeout */
+#define LIN_BENCHMARK_ID                0x10U
+#define LIN_BENCHMARK_FRAMES            16UL
+#define LIN_BENCHMARK_TIMEOUT_MS        20UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Response direction, seen from this node */
+typedef enum
+{
+    LIN_FRAME_SUBSCRIBE,                /* Another node sends the response */
+    LIN_FRAME_PUBLISH                   /* This node sends the response */
+} lin_direction_t;
+
+/* Checksum model */
+typedef enum
+{
+    LIN_CHECKSUM_CLASSIC,               /* Data bytes only (LIN 1.x) */
+    LIN_CHECKSUM_ENHANCED               /* Protected identifier and data bytes (LIN 2.x) */
+} lin_checksum_t;
+
+/* Entry of the frame table. For a published frame, update data with
+ * interrupts masked. */
+typedef struct
+{
+    uint8_t id;                         /* Frame identifier, 0 to 63 */
+    lin_direction_t direction;
+    lin_checksum_t checksum;
+    uint8_t size;                       /* Data bytes, 1 to LIN_MAX_DATA */
+    uint8_t data[LIN_MAX_DATA + 1UL];   /* Data bytes followed by the checksum */
+    volatile bool updated;              /* Set when the response was received or sent */
+} lin_frame_t;
+
+/* Engine statistics */
+typedef struct
+{
+    uint32_t frames;                    /* Responses received or sent */
+    uint32_t errors;                    /* Sync, parity, checksum, readback or incomplete responses */
+    uint32_t isrCount;                  /* Interrupts handled by the engine */
+    uint32_t isrCycles;                 /* Cycles spent in the engine's interrupt handlers */
+} lin_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void lin_init(lin_frame_t *frames, uint32_t count, bool dma);
+void lin_stop(void);
+void lin_send_header(uint8_t id);
+uint8_t lin_protected_id(uint8_t id);
+void lin_get_stats(lin_stats_t *stats);
+void lin_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIN_H */
+
+/* [] END OF FILE */
@@ -43,6 +43,27 @@
 
 #include "cy_pdl.h"
 #include "cybsp.h"
+#include "cycle_count.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "bus_contention.h"
+#include "dma_latency.h"
+#include "event_trace.h"
+#include "uart_rx_dma.h"
+#include "reverse_copy.h"
+#include "uart_fmt.h"
+#include "telemetry.h"
+#include "baud_tune.h"
+#include "dump_compress.h"
+#include "i2c_dma.h"
+#include "spi_dma.h"
+#include "lin.h"
+#include "dma_power.h"
+#include "sram_march.h"
+#include "flash_verify.h"
+#include "dma_fill.h"
+#include "dma_queue.h"
+#include "dma_async.h"
 
 /*******************************************************************************
 * Macros
@@ -54,17 +75,110 @@
 /* Macro for DMA transfer size */
 #define DMAC_TRANSFER_SIZE              16UL
 
-/* DMA channel rrigger select line */
-#define DMA_TRIGGER_SELECT              TRIG0_OUT_CPUSS_DMAC_TR_IN0
-
-/* DMA Channel Trigger Group */
-#define DMA_TRIGGER_ASSERT_CYCLES       CY_DMAC_RETRIG_4CYC
-
-/* DELAY time */
-#define DELAY                           1u
-
-/* DEALY loop */
-#define DELAY_LOOP                      100UL
+/* Bound of the demo transfer, far longer than two 16-byte descriptors */
+#define DMAC_TRANSFER_TIMEOUT_MS        1UL
+
+/* Run the DMA benchmark suite after the demo transfer */
+#ifndef DMA_BENCHMARK_ENABLE
+#define DMA_BENCHMARK_ENABLE            (1u)
+#endif
+
+/* Run the bus contention benchmark after the DMA benchmark suite */
+#ifndef BUS_CONTENTION_ENABLE
+#define BUS_CONTENTION_ENABLE           (1u)
+#endif
+
+/* Run the trigger-to-first-write latency benchmark */
+#ifndef DMA_LATENCY_ENABLE
+#define DMA_LATENCY_ENABLE              (1u)
+#endif
+
+/* Run the reverse-order copy benchmark */
+#ifndef REVERSE_COPY_BENCHMARK_ENABLE
+#define REVERSE_COPY_BENCHMARK_ENABLE   (1u)
+#endif
+
+/* Run the formatted output benchmark */
+#ifndef UART_FMT_BENCHMARK_ENABLE
+#define UART_FMT_BENCHMARK_ENABLE       (1u)
+#endif
+
+/* Compare the payload rate of text and binary telemetry output. Disabled by
+ * default because the binary frames appear in the terminal. */
+#ifndef TELEMETRY_BENCHMARK_ENABLE
+#define TELEMETRY_BENCHMARK_ENABLE      (0u)
+#endif
+
+/* Measure the compression ratio and cycles per byte of the dump compressor */
+#ifndef DUMP_COMPRESS_BENCHMARK_ENABLE
+#define DUMP_COMPRESS_BENCHMARK_ENABLE  (1u)
+#endif
+
+/* Compare the cycles and estimated CPU energy of polled and sleeping waits */
+#ifndef DMA_POWER_BENCHMARK_ENABLE
+#define DMA_POWER_BENCHMARK_ENABLE      (1u)
+#endif
+
+/* Compare the background SRAM test at several bus time caps with a CPU test */
+#ifndef SRAM_MARCH_BENCHMARK_ENABLE
+#define SRAM_MARCH_BENCHMARK_ENABLE     (1u)
+#endif
+
+/* Compare the flash CRC check with CPU reads and with the DMA pipeline */
+#ifndef FLASH_VERIFY_BENCHMARK_ENABLE
+#define FLASH_VERIFY_BENCHMARK_ENABLE   (1u)
+#endif
+
+/* Compare DMA fills with the library memset() */
+#ifndef DMA_FILL_BENCHMARK_ENABLE
+#define DMA_FILL_BENCHMARK_ENABLE       (1u)
+#endif
+
+/* Compare blocking and queued submission of DMA copy requests */
+#ifndef DMA_QUEUE_BENCHMARK_ENABLE
+#define DMA_QUEUE_BENCHMARK_ENABLE      (1u)
+#endif
+
+/* Compare blocking pipelines with pipelines run as stackless tasks */
+#ifndef DMA_ASYNC_BENCHMARK_ENABLE
+#define DMA_ASYNC_BENCHMARK_ENABLE      (1u)
+#endif
+
+/* Compare I2C register-block reads through the DMAC with the CPU-driven PDL
+ * functions. Disabled by default: requires a SCB named I2C, configured as
+ * I2C master, in the design and a device at I2C_DMA_BENCHMARK_ADDRESS. */
+#ifndef I2C_DMA_BENCHMARK_ENABLE
+#define I2C_DMA_BENCHMARK_ENABLE        (0u)
+#endif
+
+/* Send blocks through the SPI engine and check that they come back.
+ * Disabled by default: requires a SCB named SPI, configured as SPI master,
+ * in the design and its MOSI pin connected to its MISO pin. */
+#ifndef SPI_DMA_BENCHMARK_ENABLE
+#define SPI_DMA_BENCHMARK_ENABLE        (0u)
+#endif
+
+/* Compare the interrupts and CPU load per LIN frame with byte-wise and DMA
+ * response handling. Disabled by default: requires TX and RX of UART_HW to be
+ * connected, as through a LIN transceiver. */
+#ifndef LIN_BENCHMARK_ENABLE
+#define LIN_BENCHMARK_ENABLE            (0u)
+#endif
+
+/* Receive terminal input through the DMAC instead of polling the RX FIFO.
+ * Disabled by default: check UART_RX_DMA_TRIGGER_IN against the device first. */
+#ifndef UART_RX_DMA_ENABLE
+#define UART_RX_DMA_ENABLE              (0u)
+#endif
+
+/* Terminal command: dump the event trace */
+#define COMMAND_TRACE_DUMP              't'
+
+/* Terminal command: send the transfer buffers as binary telemetry */
+#define COMMAND_TELEMETRY_BUFFERS       'b'
+
+/* Terminal command: write a compressed dump of the SRAM */
+#define COMMAND_SRAM_DUMP               'z'
 
 /*******************************************************************************
 * Global Variables
@@ -76,6 +190,17 @@ uint8_t g_region1Dst[DMAC_TRANSFER_SIZE] = {0UL};
 const uint8_t g_region2Src[DMAC_TRANSFER_SIZE] = "PSoC4_HVMS-DMADC";
 uint8_t g_region2Dst[DMAC_TRANSFER_SIZE] = {0UL};
 
+#if (I2C_DMA_BENCHMARK_ENABLE)
+/* I2C master context */
+static cy_stc_scb_i2c_context_t g_i2cContext;
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void process_command(uint32_t command);
+static void print_region(const char *label, const uint8_t *data);
 
 /********************************************************************************
 * Function Name: main
@@ -91,15 +216,30 @@ uint8_t g_region2Dst[DMAC_TRANSFER_SIZE] = {0UL};
 *  5. Enable using DMAC channel
 *  6. Set Trigger to initialize transfer
 *  7. Confirm results on the display of terminal software
+*  8. Run the DMA benchmark suite and print the results as CSV
+*  9. Measure CPU slowdown under concurrent DMA at each channel priority
+* 10. Measure the trigger-to-first-write latency of the DMA
+* 11. Compare reverse-order and endian-swap copies (naive, CPU kernel, DMA)
+* 12. Measure the cycles per field of the formatted output layer
+* 13. Measure the compression ratio and cycles per byte of the dump compressor,
+*     the energy per KB of polled and sleeping waits, the CPU and bus time of
+*     the background SRAM test, the flash verification time, DMA fills
+*     against memset(), blocking and queued DMA requests, blocking and
+*     task-based pipelines and, with I2C_DMA_BENCHMARK_ENABLE, the latency of
+*     I2C reads through the DMAC, with SPI_DMA_BENCHMARK_ENABLE, SPI loopback
+*     transactions through the DMAC and, with LIN_BENCHMARK_ENABLE, the CPU
+*     load per LIN frame
+* 14. Process terminal commands (event trace dump, binary telemetry,
+*     baud rate negotiation, compressed SRAM dump), received by polling or,
+*     with UART_RX_DMA_ENABLE, through the DMAC
 *
 ********************************************************************************/
 int main(void)
 {
     cy_rslt_t result;
-    char srcdata1[16];
-    char dstdata1[16];
-    char srcdata2[16];
-    char dstdata2[16];
+    dma_chain_status_t status;
+    uint8_t srcdata2[DMAC_TRANSFER_SIZE];
+    uint8_t dstdata2[DMAC_TRANSFER_SIZE];
 
     /* Initialize system */
     result = cybsp_init() ;
@@ -111,6 +251,10 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+    /* Start the cycle counter used for timing and the event trace */
+    cycle_count_init();
+    event_trace_init();
+
     /* Allocate channel number to use with DMA functions. */
     Cy_DMAC_Channel_Init(USER_DMA_HW, USER_DMA_CHANNEL, &USER_DMA_channel_config);
 
@@ -134,10 +278,15 @@ int main(void)
     Cy_SCB_UART_Init(UART_HW, &UART_config, NULL);
     Cy_SCB_UART_Enable(UART_HW);
 
-    Cy_SCB_UART_PutString(UART_HW, "\x1b[2J\x1b[;H");
-    Cy_SCB_UART_PutString(UART_HW, "************************************************************\r\n");
-    Cy_SCB_UART_PutString(UART_HW, "DMA Data Transfer with Descriptor Chain \r\n");
-    Cy_SCB_UART_PutString(UART_HW, "************************************************************\r\n\n");
+#if (UART_RX_DMA_ENABLE)
+    uart_rx_dma_init(baud_tune_get_baud_rate());
+#endif
+    telemetry_init();
+
+    (void) uart_fmt_str("\x1b[2J\x1b[;H");
+    (void) uart_fmt_str("************************************************************\r\n");
+    (void) uart_fmt_str("DMA Data Transfer with Descriptor Chain \r\n");
+    (void) uart_fmt_str("************************************************************\r\n\n");
 
     /* At this point both transfer descriptors are configured, the DMA channel
     * is enabled and waiting for a trigger.
@@ -146,86 +295,227 @@ int main(void)
     */
     Cy_TrigMux_SwTrigger(DMA_TRIGGER_SELECT, DMA_TRIGGER_ASSERT_CYCLES);
 
-    /* Wait until transfer is over */
-    while (CY_DMAC_DONE == Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG));
+    /* Wait until transfer is over. PONG follows PING in the descriptor list,
+    * so its response covers both. On a fault the channel is reset within
+    * microseconds instead of hanging until the watchdog fires. */
+    status = dma_chain_wait_timeout(USER_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG,
+                                    CYCLE_COUNT_MS_TO_CYCLES(DMAC_TRANSFER_TIMEOUT_MS));
+    if (DMA_CHAIN_STATUS_DONE != status)
+    {
+        /* The benchmarks configure their own descriptors on this channel */
+        dma_chain_recover(USER_DMA_CHANNEL);
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, USER_DMA_CHANNEL);
+        (void) uart_fmt_str("- DMA transfer failed: ");
+        (void) uart_fmt_str(dma_chain_status_name(status));
+        (void) uart_fmt_str("\r\n");
+    }
 
     /* Validate the transferred data */
-    Cy_SCB_UART_PutString(UART_HW, "PING source = ");
+    reverse_copy_cpu(srcdata2, g_region2Src, DMAC_TRANSFER_SIZE, 1UL);
+    reverse_copy_cpu(dstdata2, g_region2Dst, DMAC_TRANSFER_SIZE, 1UL);
 
-    for(uint8_t i=0; i<DMAC_TRANSFER_SIZE; i++)
+    print_region("PING source = ", g_region1Src);
+    print_region("PING destination = ", g_region1Dst);
+    print_region("PONG source = ", srcdata2);
+    print_region("PONG destination = ", dstdata2);
+
+    if (DMA_CHAIN_STATUS_DONE == status)
     {
-        srcdata1[i] = g_region1Src[i];
-        for(uint8_t j=0; j<DELAY_LOOP; j++)
-        {
-            if(Cy_SCB_UART_IsTxComplete(UART_HW))
-            {
-                Cy_SCB_UART_Put(UART_HW, srcdata1[i]);
-                break;
-            }
-            Cy_SysLib_Delay(DELAY);
-        }
+        (void) uart_fmt_str("- DMA transfer is completed. \r\n");
     }
-    /* Validate the transferred data */
-    Cy_SCB_UART_PutString(UART_HW, "\r\n");
-    Cy_SCB_UART_PutString(UART_HW, "PING destination = ");
 
-    for(uint8_t i=0; i<DMAC_TRANSFER_SIZE; i++)
+#if (DMA_BENCHMARK_ENABLE)
+    (void) uart_fmt_str("\r\n");
+    dma_benchmark_run();
+#endif
+
+#if (BUS_CONTENTION_ENABLE)
+    bus_contention_run();
+#endif
+
+#if (DMA_LATENCY_ENABLE)
+    dma_latency_run();
+#endif
+
+#if (REVERSE_COPY_BENCHMARK_ENABLE)
+    reverse_copy_benchmark_run();
+#endif
+
+#if (UART_FMT_BENCHMARK_ENABLE)
+    uart_fmt_benchmark_run();
+#endif
+
+#if (TELEMETRY_BENCHMARK_ENABLE)
+    telemetry_benchmark_run();
+#endif
+
+#if (DUMP_COMPRESS_BENCHMARK_ENABLE)
+    dump_compress_benchmark_run();
+#endif
+
+#if (DMA_POWER_BENCHMARK_ENABLE)
+    dma_power_benchmark_run();
+#endif
+
+#if (SRAM_MARCH_BENCHMARK_ENABLE)
+    sram_march_init();
+    sram_march_benchmark_run();
+#endif
+
+#if (FLASH_VERIFY_BENCHMARK_ENABLE)
+    flash_verify_benchmark_run();
+#endif
+
+#if (DMA_FILL_BENCHMARK_ENABLE)
+    dma_fill_benchmark_run();
+#endif
+
+#if (DMA_QUEUE_BENCHMARK_ENABLE || DMA_ASYNC_BENCHMARK_ENABLE)
+    dma_queue_init();
+#endif
+
+#if (DMA_QUEUE_BENCHMARK_ENABLE)
+    dma_queue_benchmark_run();
+#endif
+
+#if (DMA_ASYNC_BENCHMARK_ENABLE)
+    dma_async_benchmark_run();
+#endif
+
+#if (I2C_DMA_BENCHMARK_ENABLE)
+    (void) Cy_SCB_I2C_Init(I2C_HW, &I2C_config, &g_i2cContext);
+    Cy_SCB_I2C_Enable(I2C_HW);
+    i2c_dma_init(I2C_HW, &g_i2cContext);
+    i2c_dma_benchmark_run();
+#endif
+
+#if (SPI_DMA_BENCHMARK_ENABLE)
+    (void) Cy_SCB_SPI_Init(SPI_HW, &SPI_config, NULL);
+    Cy_SCB_SPI_Enable(SPI_HW);
+    spi_dma_init(SPI_HW);
+    spi_dma_benchmark_run();
+#endif
+
+#if (LIN_BENCHMARK_ENABLE)
+    lin_benchmark_run();
+
+    /* The LIN engine reprogrammed the UART channels */
+#if (UART_RX_DMA_ENABLE)
+    uart_rx_dma_init(baud_tune_get_baud_rate());
+#endif
+    telemetry_init();
+#endif
+
+    for(;;)
     {
-        dstdata1[i] = g_region1Dst[i];
-        for(uint8_t j=0; j<DELAY_LOOP; j++)
+        if (baud_tune_poll())
         {
-            if(Cy_SCB_UART_IsTxComplete(UART_HW))
-            {
-                Cy_SCB_UART_Put(UART_HW, dstdata1[i]);
-                break;
-            }
-            Cy_SysLib_Delay(DELAY);
+#if (UART_RX_DMA_ENABLE)
+            uart_rx_dma_resume(baud_tune_get_baud_rate());
+#endif
         }
-    }
-    Cy_SCB_UART_PutString(UART_HW, "\r\n");
 
-    /* Validate the transferred data */
-    Cy_SCB_UART_PutString(UART_HW, "PONG source = ");
+#if (UART_RX_DMA_ENABLE)
+        const uint8_t *frame;
+        uint32_t length;
 
-    for(uint32_t i=15; i<DMAC_TRANSFER_SIZE; i--)
-    {
-        srcdata2[i] = g_region2Src[i];
-        for(uint8_t j=0; j<DELAY_LOOP; j++)
+        uart_rx_dma_poll();
+        frame = uart_rx_dma_get_frame(&length);
+        if (NULL != frame)
         {
-            if(Cy_SCB_UART_IsTxComplete(UART_HW))
+            for (uint32_t i = 0UL; i < length; i++)
             {
-                Cy_SCB_UART_Put(UART_HW, srcdata2[i]);
-                break;
+                process_command(frame[i]);
             }
-            Cy_SysLib_Delay(DELAY);
+            uart_rx_dma_release();
         }
-    }
-    /* Validate the transferred data */
-    Cy_SCB_UART_PutString(UART_HW, "\r\n");
-    Cy_SCB_UART_PutString(UART_HW, "PONG destination = ");
-
-    for(uint32_t i=15; i<DMAC_TRANSFER_SIZE; i--)
-    {
-        dstdata2[i] = g_region2Dst[i];
-        for(uint8_t j=0; j<DELAY_LOOP; j++)
+#else
+        if (0UL != Cy_SCB_UART_GetNumInRxFifo(UART_HW))
         {
-            if(Cy_SCB_UART_IsTxComplete(UART_HW))
-            {
-                Cy_SCB_UART_Put(UART_HW, dstdata2[i]);
-                break;
-            }
-            Cy_SysLib_Delay(DELAY);
+            event_trace_record(EVENT_TRACE_UART_RX, Cy_SCB_UART_GetNumInRxFifo(UART_HW));
+            process_command(Cy_SCB_UART_Get(UART_HW));
         }
-   }
-
-    Cy_SCB_UART_PutString(UART_HW, "\r\n");
+#endif
+    }
+}
 
+/********************************************************************************
+* Function Name: process_command
+*********************************************************************************
+* Summary:
+* Executes a single-character command received on the terminal.
+*
+* Parameters:
+*  command: Received character
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void process_command(uint32_t command)
+{
+    switch (command)
+    {
+        case COMMAND_TRACE_DUMP:
+            event_trace_dump();
+            break;
+
+        case BAUD_TUNE_COMMAND:
+            telemetry_flush();
+#if (UART_RX_DMA_ENABLE)
+            uart_rx_dma_suspend();
+            (void) baud_tune_negotiate();
+            uart_rx_dma_resume(baud_tune_get_baud_rate());
+#else
+            (void) baud_tune_negotiate();
+#endif
+            break;
+
+        case COMMAND_TELEMETRY_BUFFERS:
+            telemetry_send_buffer(g_region1Dst, DMAC_TRANSFER_SIZE);
+            telemetry_send_buffer(g_region2Dst, DMAC_TRANSFER_SIZE);
+            telemetry_flush();
+            break;
+
+        case COMMAND_SRAM_DUMP:
+            telemetry_flush();
+            (void) dump_compress_uart((const void *) CY_SRAM_BASE, CY_SRAM_SIZE, false);
+            break;
+
+        default:
+            /* Unknown commands are ignored */
+            break;
+    }
+}
 
-    Cy_SCB_UART_PutString(UART_HW, "- DMA transfer is completed. \r\n");
+/********************************************************************************
+* Function Name: print_region
+*********************************************************************************
+* Summary:
+* Prints a label and the DMAC_TRANSFER_SIZE characters of a demo region. A
+* stalled UART drops the rest of the line and reports it instead of hanging.
+*
+* Parameters:
+*  label: Text printed before the region
+*  data: Region to print
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void print_region(const char *label, const uint8_t *data)
+{
+    uint32_t written;
 
-    for(;;)
+    (void) uart_fmt_str(label);
+    written = uart_fmt_chars((const char *) data, DMAC_TRANSFER_SIZE);
+    if (written < DMAC_TRANSFER_SIZE)
     {
+        (void) uart_fmt_str(" (");
+        (void) uart_fmt_u32(DMAC_TRANSFER_SIZE - written);
+        (void) uart_fmt_str(" characters dropped)");
     }
+    (void) uart_fmt_str("\r\n");
 }
 
 /* [] END OF FILE */
@@ -0,0 +1,708 @@
+/******************************************************************************
+* File Name:   reverse_copy.c
+*
+* Description: This file contains the reverse-order and endian-swap copy
+*              primitives and their benchmark.
+*
+*              The DMAC cannot decrement addresses, so a reversed DMA copy needs
+*              one descriptor per element. The CPU kernels move a word per
+*              iteration and reorder it with REV/REV16/ROR, which is cheaper for
+*              all but very large elements; the benchmark compares both against
+*              the element-by-element loop used by the demo.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "reverse_copy.h"
+#include "dma_benchmark.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Alignment mask of a word */
+#define REVERSE_COPY_WORD_MASK          3UL
+
+/* Number of runs per configuration. The fastest run is reported. */
+#define REVERSE_COPY_BENCHMARK_REPEAT   4UL
+
+/* Smallest buffer of the benchmark, in bytes */
+#define REVERSE_COPY_BENCHMARK_MIN_SIZE 16UL
+
+/* Number of descriptors per channel */
+#define REVERSE_COPY_DESCRIPTORS        2UL
+
+/* Source and destination are the two halves of the shared benchmark buffer */
+#if ((2UL * REVERSE_COPY_BENCHMARK_MAX_SIZE) > DMA_BENCHMARK_MAX_SIZE)
+#error "REVERSE_COPY_BENCHMARK_MAX_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Operation under test */
+typedef enum
+{
+    REVERSE_COPY_OP_REVERSE,
+    REVERSE_COPY_OP_SWAP
+} reverse_copy_op_t;
+
+/* Copy method under test */
+typedef void (*reverse_copy_method_t)(uint8_t *dst, const uint8_t *src, uint32_t count,
+                                      uint32_t elementSize);
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Descriptors in the order the elements are transferred */
+static const cy_en_dmac_descriptor_t g_reverseDescriptors[REVERSE_COPY_DESCRIPTORS] =
+{
+    CY_DMAC_DESCRIPTOR_PING,
+    CY_DMAC_DESCRIPTOR_PONG
+};
+
+/* Benchmark buffers, in the shared benchmark buffer */
+static uint8_t *g_reverseSrc = NULL;
+static uint8_t *g_reverseDst = NULL;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void reverse_copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t count);
+static void reverse_copy_halfwords(uint16_t *dst, const uint16_t *src, uint32_t count);
+static void reverse_copy_dma_element(cy_en_dmac_descriptor_t descriptor, uint8_t *dst,
+                                     const uint8_t *src, uint32_t count, uint32_t index,
+                                     cy_en_dmac_data_transfer_width_t width);
+static void reverse_copy_naive(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize);
+static void reverse_copy_naive_swap(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize);
+static void reverse_copy_kernel(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize);
+static void reverse_copy_kernel_swap(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize);
+static void reverse_copy_dma_method(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize);
+static bool reverse_copy_check(reverse_copy_op_t op, uint32_t size, uint32_t elementSize);
+static void reverse_copy_measure(reverse_copy_op_t op, uint32_t size, uint32_t elementSize,
+                                 const char *name, reverse_copy_method_t method);
+
+/********************************************************************************
+* Function Name: reverse_copy_cpu
+*********************************************************************************
+* Summary:
+* Copies elements in reverse order. Bytes and halfwords are moved a word at a
+* time once the destination is word aligned and the source end is word
+* aligned; otherwise they are moved one element at a time.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes (1, 2 or 4)
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void reverse_copy_cpu(void *dst, const void *src, uint32_t count, uint32_t elementSize)
+{
+    uint32_t *dstWord = (uint32_t *) dst;
+    const uint32_t *srcWord = (const uint32_t *) src + count;
+
+    switch (elementSize)
+    {
+        case 1UL:
+            reverse_copy_bytes((uint8_t *) dst, (const uint8_t *) src, count);
+            break;
+
+        case 2UL:
+            reverse_copy_halfwords((uint16_t *) dst, (const uint16_t *) src, count);
+            break;
+
+        case 4UL:
+            while (0UL != count)
+            {
+                *dstWord++ = *--srcWord;
+                count--;
+            }
+            break;
+
+        default:
+            CY_ASSERT(0);
+            break;
+    }
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_swap_cpu
+*********************************************************************************
+* Summary:
+* Copies elements and swaps the byte order of each. Halfwords are swapped a
+* word at a time with REV16 when both buffers are word aligned.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes (2 or 4)
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void reverse_copy_swap_cpu(void *dst, const void *src, uint32_t count, uint32_t elementSize)
+{
+    uint16_t *dstHalf = (uint16_t *) dst;
+    const uint16_t *srcHalf = (const uint16_t *) src;
+    uint32_t *dstWord = (uint32_t *) dst;
+    const uint32_t *srcWord = (const uint32_t *) src;
+
+    switch (elementSize)
+    {
+        case 2UL:
+            if ((0UL != count) && (0UL != ((uintptr_t) dstHalf & REVERSE_COPY_WORD_MASK)))
+            {
+                *dstHalf++ = (uint16_t) __REV16(*srcHalf++);
+                count--;
+            }
+            if (0UL == ((uintptr_t) srcHalf & REVERSE_COPY_WORD_MASK))
+            {
+                dstWord = (uint32_t *) dstHalf;
+                srcWord = (const uint32_t *) srcHalf;
+                while (count >= 2UL)
+                {
+                    *dstWord++ = __REV16(*srcWord++);
+                    count -= 2UL;
+                }
+                dstHalf = (uint16_t *) dstWord;
+                srcHalf = (const uint16_t *) srcWord;
+            }
+            while (0UL != count)
+            {
+                *dstHalf++ = (uint16_t) __REV16(*srcHalf++);
+                count--;
+            }
+            break;
+
+        case 4UL:
+            while (0UL != count)
+            {
+                *dstWord++ = __REV(*srcWord++);
+                count--;
+            }
+            break;
+
+        default:
+            CY_ASSERT(0);
+            break;
+    }
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_dma
+*********************************************************************************
+* Summary:
+* Copies elements in reverse order with the DMAC. Each element is a
+* single-descriptor transfer; while one descriptor is transferring, the CPU
+* programs the other with the next element but one. Flipping makes the
+* descriptor of the next element current on completion.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  width: Transfer width; the element size is its source size
+*
+* Return:
+*  cy_en_dmac_response_t: CY_DMAC_DONE, or the response of the failed transfer
+*
+********************************************************************************/
+cy_en_dmac_response_t reverse_copy_dma(void *dst, const void *src, uint32_t count,
+                                       cy_en_dmac_data_transfer_width_t width)
+{
+    cy_en_dmac_response_t response = CY_DMAC_DONE;
+    cy_en_dmac_descriptor_t descriptor;
+    uint32_t i;
+
+    for (i = 0UL; (i < count) && (i < REVERSE_COPY_DESCRIPTORS); i++)
+    {
+        reverse_copy_dma_element(g_reverseDescriptors[i], (uint8_t *) dst, (const uint8_t *) src,
+                                 count, i, width);
+    }
+
+    if (0UL != count)
+    {
+        dma_chain_start(REVERSE_COPY_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        dma_chain_trigger();
+    }
+
+    for (i = 0UL; i < count; i++)
+    {
+        descriptor = g_reverseDescriptors[i & 1UL];
+        response = dma_chain_wait(REVERSE_COPY_DMA_CHANNEL, descriptor);
+        if (CY_DMAC_DONE != response)
+        {
+            break;
+        }
+
+        if ((i + 1UL) < count)
+        {
+            dma_chain_trigger();
+        }
+        if ((i + REVERSE_COPY_DESCRIPTORS) < count)
+        {
+            reverse_copy_dma_element(descriptor, (uint8_t *) dst, (const uint8_t *) src,
+                                     count, i + REVERSE_COPY_DESCRIPTORS, width);
+        }
+    }
+
+    return response;
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_benchmark_run
+*********************************************************************************
+* Summary:
+* Measures reversal and byte swapping of SRAM buffers with the naive loop, the
+* CPU kernels and the DMA, and writes the results as CSV.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void reverse_copy_benchmark_run(void)
+{
+    uint32_t size;
+    uint32_t elementSize;
+
+    g_reverseSrc = dma_benchmark_scratch();
+    g_reverseDst = &g_reverseSrc[REVERSE_COPY_BENCHMARK_MAX_SIZE];
+
+    for (size = 0UL; size < REVERSE_COPY_BENCHMARK_MAX_SIZE; size++)
+    {
+        g_reverseSrc[size] = (uint8_t) (size * 7UL + 1UL);
+    }
+
+    dma_benchmark_csv_comment("reverse_copy");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("op");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("width");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (size = REVERSE_COPY_BENCHMARK_MIN_SIZE; size <= REVERSE_COPY_BENCHMARK_MAX_SIZE; size <<= 2U)
+    {
+        for (elementSize = 1UL; elementSize <= 4UL; elementSize <<= 1U)
+        {
+            reverse_copy_measure(REVERSE_COPY_OP_REVERSE, size, elementSize, "naive", reverse_copy_naive);
+            reverse_copy_measure(REVERSE_COPY_OP_REVERSE, size, elementSize, "cpu", reverse_copy_kernel);
+            reverse_copy_measure(REVERSE_COPY_OP_REVERSE, size, elementSize, "dma", reverse_copy_dma_method);
+
+            if (1UL != elementSize)
+            {
+                reverse_copy_measure(REVERSE_COPY_OP_SWAP, size, elementSize, "naive", reverse_copy_naive_swap);
+                reverse_copy_measure(REVERSE_COPY_OP_SWAP, size, elementSize, "cpu", reverse_copy_kernel_swap);
+            }
+        }
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_bytes
+*********************************************************************************
+* Summary:
+* Byte reversal: aligns the destination, then moves aligned source words
+* reversed with REV.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t count)
+{
+    const uint8_t *srcEnd = src + count;
+    uint32_t *dstWord;
+    const uint32_t *srcWord;
+
+    while ((0UL != count) && (0UL != ((uintptr_t) dst & REVERSE_COPY_WORD_MASK)))
+    {
+        *dst++ = *--srcEnd;
+        count--;
+    }
+
+    if (0UL == ((uintptr_t) srcEnd & REVERSE_COPY_WORD_MASK))
+    {
+        dstWord = (uint32_t *) dst;
+        srcWord = (const uint32_t *) srcEnd;
+        while (count >= 4UL)
+        {
+            *dstWord++ = __REV(*--srcWord);
+            count -= 4UL;
+        }
+        dst = (uint8_t *) dstWord;
+        srcEnd = (const uint8_t *) srcWord;
+    }
+
+    while (0UL != count)
+    {
+        *dst++ = *--srcEnd;
+        count--;
+    }
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_halfwords
+*********************************************************************************
+* Summary:
+* Halfword reversal: aligns the destination, then moves aligned source words
+* with their halfwords exchanged by a 16-bit rotation.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of halfwords
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_halfwords(uint16_t *dst, const uint16_t *src, uint32_t count)
+{
+    const uint16_t *srcEnd = src + count;
+    uint32_t *dstWord;
+    const uint32_t *srcWord;
+
+    if ((0UL != count) && (0UL != ((uintptr_t) dst & REVERSE_COPY_WORD_MASK)))
+    {
+        *dst++ = *--srcEnd;
+        count--;
+    }
+
+    if (0UL == ((uintptr_t) srcEnd & REVERSE_COPY_WORD_MASK))
+    {
+        dstWord = (uint32_t *) dst;
+        srcWord = (const uint32_t *) srcEnd;
+        while (count >= 2UL)
+        {
+            *dstWord++ = __ROR(*--srcWord, 16U);
+            count -= 2UL;
+        }
+        dst = (uint16_t *) dstWord;
+        srcEnd = (const uint16_t *) srcWord;
+    }
+
+    while (0UL != count)
+    {
+        *dst++ = *--srcEnd;
+        count--;
+    }
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_dma_element
+*********************************************************************************
+* Summary:
+* Configures a descriptor to move one element to its reversed position.
+*
+* Parameters:
+*  descriptor: PING or PONG
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  index: Destination index of the element
+*  width: Transfer width
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_dma_element(cy_en_dmac_descriptor_t descriptor, uint8_t *dst,
+                                     const uint8_t *src, uint32_t count, uint32_t index,
+                                     cy_en_dmac_data_transfer_width_t width)
+{
+    uint32_t elementSize = dma_chain_element_size(width);
+    const dma_chain_segment_t segment =
+    {
+        .src          = src + ((count - 1UL - index) * elementSize),
+        .dst          = dst + (index * elementSize),
+        .count        = 1UL,
+        .width        = width,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = false,
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+
+    (void) dma_chain_config(REVERSE_COPY_DMA_CHANNEL, descriptor, &segment);
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_naive
+*********************************************************************************
+* Summary:
+* Element-by-element reversal with a descending index, as done by the demo.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_naive(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize)
+{
+    uint32_t i;
+    uint32_t b;
+
+    for (i = 0UL; i < count; i++)
+    {
+        for (b = 0UL; b < elementSize; b++)
+        {
+            dst[(i * elementSize) + b] = src[((count - 1UL - i) * elementSize) + b];
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_naive_swap
+*********************************************************************************
+* Summary:
+* Byte-by-byte swap of each element.
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_naive_swap(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize)
+{
+    uint32_t i;
+    uint32_t b;
+
+    for (i = 0UL; i < count; i++)
+    {
+        for (b = 0UL; b < elementSize; b++)
+        {
+            dst[(i * elementSize) + b] = src[(i * elementSize) + (elementSize - 1UL - b)];
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_kernel
+*********************************************************************************
+* Summary:
+* Benchmark adapter of reverse_copy_cpu().
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_kernel(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize)
+{
+    reverse_copy_cpu(dst, src, count, elementSize);
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_kernel_swap
+*********************************************************************************
+* Summary:
+* Benchmark adapter of reverse_copy_swap_cpu().
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_kernel_swap(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize)
+{
+    reverse_copy_swap_cpu(dst, src, count, elementSize);
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_dma_method
+*********************************************************************************
+* Summary:
+* Benchmark adapter of reverse_copy_dma().
+*
+* Parameters:
+*  dst: Destination buffer
+*  src: Source buffer
+*  count: Number of elements
+*  elementSize: Element size in bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_dma_method(uint8_t *dst, const uint8_t *src, uint32_t count, uint32_t elementSize)
+{
+    static const cy_en_dmac_data_transfer_width_t widths[] =
+    {
+        CY_DMAC_BYTE_BYTE,
+        CY_DMAC_HALFWORD_HALFWORD,
+        CY_DMAC_WORD_WORD,
+        CY_DMAC_WORD_WORD
+    };
+
+    (void) reverse_copy_dma(dst, src, count, widths[elementSize >> 1U]);
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_check
+*********************************************************************************
+* Summary:
+* Verifies the destination buffer against the source buffer.
+*
+* Parameters:
+*  op: Operation that produced the destination
+*  size: Buffer size in bytes
+*  elementSize: Element size in bytes
+*
+* Return:
+*  bool: true if the destination is correct
+*
+********************************************************************************/
+static bool reverse_copy_check(reverse_copy_op_t op, uint32_t size, uint32_t elementSize)
+{
+    uint32_t i;
+    uint32_t srcIndex;
+
+    for (i = 0UL; i < size; i++)
+    {
+        if (REVERSE_COPY_OP_REVERSE == op)
+        {
+            srcIndex = (size - elementSize) - ((i / elementSize) * elementSize) + (i % elementSize);
+        }
+        else
+        {
+            srcIndex = (i - (i % elementSize)) + (elementSize - 1UL - (i % elementSize));
+        }
+
+        if (g_reverseDst[i] != g_reverseSrc[srcIndex])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: reverse_copy_measure
+*********************************************************************************
+* Summary:
+* Times the fastest of REVERSE_COPY_BENCHMARK_REPEAT runs of a method and
+* writes a CSV row.
+*
+* Parameters:
+*  op: Operation
+*  size: Buffer size in bytes
+*  elementSize: Element size in bytes
+*  name: Method name
+*  method: Method under test
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void reverse_copy_measure(reverse_copy_op_t op, uint32_t size, uint32_t elementSize,
+                                 const char *name, reverse_copy_method_t method)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t run;
+    bool ok = true;
+
+    for (run = 0UL; run < REVERSE_COPY_BENCHMARK_REPEAT; run++)
+    {
+        (void) memset(g_reverseDst, 0, size);
+
+        start = cycle_count_now();
+        method(g_reverseDst, g_reverseSrc, size / elementSize, elementSize);
+        cycles = cycle_count_elapsed(start);
+
+        best = (cycles < best) ? cycles : best;
+        ok = ok && reverse_copy_check(op, size, elementSize);
+    }
+
+    dma_benchmark_csv_begin((REVERSE_COPY_OP_REVERSE == op) ? "reverse" : "swap");
+    dma_benchmark_csv_u32(size);
+    dma_benchmark_csv_u32(elementSize);
+    dma_benchmark_csv_str(name);
+    dma_benchmark_csv_u32(best);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/* [] END OF FILE */
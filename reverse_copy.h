@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   reverse_copy.h
+*
+* Description: Public interface of the reverse-order and endian-swap copy
+*              primitives.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef REVERSE_COPY_H
+#define REVERSE_COPY_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channel used by reverse_copy_dma(). The software trigger of
+ * dma_chain_trigger() is routed to this channel. */
+#define REVERSE_COPY_DMA_CHANNEL        USER_DMA_CHANNEL
+
+/* Largest buffer of the benchmark, in bytes */
+#ifndef REVERSE_COPY_BENCHMARK_MAX_SIZE
+#define REVERSE_COPY_BENCHMARK_MAX_SIZE 256UL
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+/* Copies count elements of elementSize (1, 2 or 4) bytes in reverse order.
+ * Elements must be naturally aligned and the buffers must not overlap. */
+void reverse_copy_cpu(void *dst, const void *src, uint32_t count, uint32_t elementSize);
+
+/* Copies count elements of elementSize (2 or 4) bytes, swapping the byte
+ * order of each element. Elements must be naturally aligned. dst may equal src. */
+void reverse_copy_swap_cpu(void *dst, const void *src, uint32_t count, uint32_t elementSize);
+
+/* Copies count elements of the given width in reverse order with one DMA
+ * descriptor per element, alternating between PING and PONG. */
+cy_en_dmac_response_t reverse_copy_dma(void *dst, const void *src, uint32_t count,
+                                       cy_en_dmac_data_transfer_width_t width);
+
+void reverse_copy_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* REVERSE_COPY_H */
+
+/* [] END OF FILE */
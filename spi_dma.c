@@ -0,0 +1,450 @@
+/******************************************************************************
+* File Name:   spi_dma.c
+*
+* Description: This file contains a full-duplex SPI master engine on a SCB block.
+*              One DMAC channel fills the TX FIFO and another empties the RX FIFO,
+*              so the CPU does not touch the FIFOs during a transaction. Transactions
+*              are queued in submission order; the receiver interrupt at the end of
+*              each transaction reports its completion and starts the next one.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "spi_dma.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* SPI SCB */
+static CySCB_Type *g_spiDmaBase = NULL;
+
+/* Transaction in progress (queue head) and last queued transaction */
+static spi_dma_transfer_t *volatile g_spiDmaHead = NULL;
+static spi_dma_transfer_t *g_spiDmaTail = NULL;
+
+/* Source of transfers without transmit data and sink of transfers without
+ * receive buffer */
+static const uint8_t g_spiDmaDummy = SPI_DMA_DUMMY_BYTE;
+static uint32_t g_spiDmaDiscard;
+
+/* Value written to the TX FIFO control register to stop the requests */
+static const uint32_t g_spiDmaTxFifoStop = 0UL;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void spi_dma_start(spi_dma_transfer_t *transfer);
+static void spi_dma_callback(uint32_t channel);
+static void spi_dma_benchmark_loopback(uint32_t transfers, uint32_t size);
+
+/********************************************************************************
+* Function Name: spi_dma_init
+*********************************************************************************
+* Summary:
+* Routes the SCB FIFO requests to the transmitter and receiver channels and
+* enables the channels. The SCB must be initialized as SPI master and enabled,
+* and the DMAC enabled.
+*
+* Parameters:
+*  base: SCB of the SPI master, not the SCB of UART_HW
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void spi_dma_init(CySCB_Type *base)
+{
+    const cy_stc_dmac_channel_config_t txConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = SPI_DMA_TX_PRIORITY,
+        .enable     = false
+    };
+    const cy_stc_dmac_channel_config_t rxConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = SPI_DMA_RX_PRIORITY,
+        .enable     = false
+    };
+
+    /* The SCB of UART_HW cannot serve as the SPI master */
+    CY_ASSERT(UART_HW != base);
+
+    g_spiDmaBase = base;
+    g_spiDmaHead = NULL;
+    g_spiDmaTail = NULL;
+
+    /* No TX requests until a transaction is started; an RX request per byte */
+    Cy_SCB_SetTxFifoLevel(base, 0UL);
+    Cy_SCB_SetRxFifoLevel(base, 0UL);
+
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, SPI_DMA_TX_CHANNEL, &txConfig);
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, SPI_DMA_RX_CHANNEL, &rxConfig);
+    dma_chain_register_callback(SPI_DMA_RX_CHANNEL, spi_dma_callback);
+#if defined(SPI_DMA_TX_TRIGGER_IN)
+    dma_chain_connect(SPI_DMA_TX_CHANNEL, SPI_DMA_TX_TRIGGER_IN, SPI_DMA_TX_TRIGGER_OUT);
+#else
+    dma_chain_connect(SPI_DMA_TX_CHANNEL, DMA_CHAIN_SCB_TX_TRIGGER(base), SPI_DMA_TX_TRIGGER_OUT);
+#endif
+#if defined(SPI_DMA_RX_TRIGGER_IN)
+    dma_chain_connect(SPI_DMA_RX_CHANNEL, SPI_DMA_RX_TRIGGER_IN, SPI_DMA_RX_TRIGGER_OUT);
+#else
+    dma_chain_connect(SPI_DMA_RX_CHANNEL, DMA_CHAIN_SCB_RX_TRIGGER(base), SPI_DMA_RX_TRIGGER_OUT);
+#endif
+
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, SPI_DMA_TX_CHANNEL);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, SPI_DMA_RX_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: spi_dma_submit
+*********************************************************************************
+* Summary:
+* Appends a transaction to the queue and starts it if the engine is idle.
+* Safe to call from a transfer callback.
+*
+* Parameters:
+*  transfer: Transaction, not already queued
+*
+* Return:
+*  bool: true if the transaction was queued, false if the size is out of range
+*
+********************************************************************************/
+bool spi_dma_submit(spi_dma_transfer_t *transfer)
+{
+    uint32_t interruptState;
+
+    if ((0UL == transfer->size) || (transfer->size > SPI_DMA_MAX_SIZE))
+    {
+        return false;
+    }
+
+    transfer->response = DMA_CHAIN_RESPONSE_PENDING;
+    transfer->next = NULL;
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+    if (NULL == g_spiDmaHead)
+    {
+        g_spiDmaHead = transfer;
+        g_spiDmaTail = transfer;
+        spi_dma_start(transfer);
+    }
+    else
+    {
+        g_spiDmaTail->next = transfer;
+        g_spiDmaTail = transfer;
+    }
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: spi_dma_is_busy
+*********************************************************************************
+* Summary:
+* Reports whether transactions are in progress or queued.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true while the queue is not empty
+*
+********************************************************************************/
+bool spi_dma_is_busy(void)
+{
+    return (NULL != g_spiDmaHead);
+}
+
+/********************************************************************************
+* Function Name: spi_dma_wait
+*********************************************************************************
+* Summary:
+* Waits until a submitted transaction is complete, for at most
+* SPI_DMA_WAIT_TIMEOUT_MS. After a timeout the queue is stuck and
+* spi_dma_init() resets the engine.
+*
+* Parameters:
+*  transfer: Submitted transaction
+*
+* Return:
+*  cy_en_dmac_response_t: CY_DMAC_DONE, the error response of the receiver or
+*                         DMA_CHAIN_RESPONSE_PENDING on timeout
+*
+********************************************************************************/
+cy_en_dmac_response_t spi_dma_wait(const spi_dma_transfer_t *transfer)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(SPI_DMA_WAIT_TIMEOUT_MS);
+    uint32_t start = cycle_count_now();
+
+    while ((DMA_CHAIN_RESPONSE_PENDING == transfer->response) && !cycle_count_expired(start, timeout))
+    {
+    }
+
+    return transfer->response;
+}
+
+/********************************************************************************
+* Function Name: spi_dma_benchmark_run
+*********************************************************************************
+* Summary:
+* Sends blocks through the engine with MOSI connected to MISO and checks that
+* every byte comes back. Each size is sent as one transaction and as a batch
+* of SPI_DMA_BENCHMARK_BATCH queued transactions of a quarter of the size, and
+* the cycles are written as CSV. cpu_cycles counts the time spent in
+* spi_dma_submit() and excludes the DMAC interrupt per transaction.
+* spi_dma_init() must have been called.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void spi_dma_benchmark_run(void)
+{
+    static const uint32_t sizes[] = { 16UL, 256UL, SPI_DMA_BENCHMARK_MAX_SIZE };
+    uint32_t i;
+
+    dma_benchmark_csv_comment("spi_dma");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("transfers");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("cycles_per_transfer");
+    dma_benchmark_csv_str("cpu_cycles");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    for (i = 0UL; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        spi_dma_benchmark_loopback(1UL, sizes[i]);
+        spi_dma_benchmark_loopback(SPI_DMA_BENCHMARK_BATCH, sizes[i] / SPI_DMA_BENCHMARK_BATCH);
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: spi_dma_start
+*********************************************************************************
+* Summary:
+* Starts a transaction. The receiver reads every byte into PING and
+* interrupts at the end. The transmitter writes every byte from PING, then
+* PONG sets the TX FIFO trigger level to zero, which stops the requests
+* before the receiver completes. Called with interrupts masked or from the
+* DMAC interrupt.
+*
+* Parameters:
+*  transfer: Transaction to start
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void spi_dma_start(spi_dma_transfer_t *transfer)
+{
+    const dma_chain_segment_t rx =
+    {
+        .src          = (const void *) &SCB_RX_FIFO_RD(g_spiDmaBase),
+        .dst          = (NULL != transfer->rxData) ? (void *) transfer->rxData : (void *) &g_spiDmaDiscard,
+        .count        = transfer->size,
+        .width        = CY_DMAC_WORD_BYTE,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = (NULL != transfer->rxData),
+        .interrupt    = true
+    };
+    const dma_chain_segment_t tx =
+    {
+        .src          = (NULL != transfer->txData) ? (const void *) transfer->txData : (const void *) &g_spiDmaDummy,
+        .dst          = (void *) &SCB_TX_FIFO_WR(g_spiDmaBase),
+        .count        = transfer->size,
+        .width        = CY_DMAC_BYTE_WORD,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = (NULL != transfer->txData),
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+    const dma_chain_segment_t stop =
+    {
+        .src          = &g_spiDmaTxFifoStop,
+        .dst          = (void *) &SCB_TX_FIFO_CTRL(g_spiDmaBase),
+        .count        = 1UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+
+    event_trace_record(EVENT_TRACE_SPI_START, transfer->size);
+    Cy_SCB_SPI_SetActiveSlaveSelect(g_spiDmaBase, transfer->slaveSelect);
+
+    /* Descriptors are invalidated on completion, so all are rewritten */
+    (void) dma_chain_config(SPI_DMA_RX_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &rx);
+    dma_chain_start(SPI_DMA_RX_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+    (void) dma_chain_config(SPI_DMA_TX_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &tx);
+    (void) dma_chain_config(SPI_DMA_TX_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &stop);
+    dma_chain_start(SPI_DMA_TX_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+
+    Cy_SCB_SetTxFifoLevel(g_spiDmaBase, SPI_DMA_TX_FIFO_LEVEL);
+}
+
+/********************************************************************************
+* Function Name: spi_dma_callback
+*********************************************************************************
+* Summary:
+* Receiver completion callback: the last byte of the transaction has been
+* received. Starts the next queued transaction first, to keep the bus busy,
+* then reports the completed one.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void spi_dma_callback(uint32_t channel)
+{
+    spi_dma_transfer_t *transfer = g_spiDmaHead;
+    cy_en_dmac_response_t response;
+
+    if (NULL == transfer)
+    {
+        return;
+    }
+
+    response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, channel, CY_DMAC_DESCRIPTOR_PING);
+    event_trace_record(EVENT_TRACE_SPI_DONE, EVENT_TRACE_DMA_ARG(channel, CY_DMAC_DESCRIPTOR_PING, response));
+
+    g_spiDmaHead = transfer->next;
+    if (NULL == g_spiDmaHead)
+    {
+        g_spiDmaTail = NULL;
+    }
+    else
+    {
+        spi_dma_start(g_spiDmaHead);
+    }
+
+    transfer->response = response;
+    if (NULL != transfer->callback)
+    {
+        transfer->callback(transfer);
+    }
+}
+
+/********************************************************************************
+* Function Name: spi_dma_benchmark_loopback
+*********************************************************************************
+* Summary:
+* Submits a number of transactions back to back, waits for all of them and
+* writes one CSV row. The transmit data is the first half of the shared
+* benchmark buffer and the receive data the second half.
+*
+* Parameters:
+*  transfers: Number of queued transactions, at most SPI_DMA_BENCHMARK_BATCH
+*  size: Bytes per transaction
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void spi_dma_benchmark_loopback(uint32_t transfers, uint32_t size)
+{
+    spi_dma_transfer_t transfer[SPI_DMA_BENCHMARK_BATCH];
+    uint8_t *txData = dma_benchmark_scratch();
+    uint8_t *rxData = &txData[SPI_DMA_BENCHMARK_MAX_SIZE];
+    uint32_t start;
+    uint32_t mark;
+    uint32_t cycles;
+    uint32_t cpuCycles = 0UL;
+    uint32_t i;
+    bool ok = true;
+
+    for (i = 0UL; i < (transfers * size); i++)
+    {
+        txData[i] = (uint8_t) ((i * 29UL) + size);
+    }
+    (void) memset(rxData, 0, transfers * size);
+
+    start = cycle_count_now();
+    for (i = 0UL; i < transfers; i++)
+    {
+        transfer[i] = (spi_dma_transfer_t)
+        {
+            .txData      = &txData[i * size],
+            .rxData      = &rxData[i * size],
+            .size        = size,
+            .slaveSelect = SPI_DMA_BENCHMARK_SLAVE_SELECT
+        };
+        mark = cycle_count_now();
+        ok = spi_dma_submit(&transfer[i]) && ok;
+        cpuCycles += cycle_count_elapsed(mark);
+    }
+    for (i = 0UL; i < transfers; i++)
+    {
+        ok = (CY_DMAC_DONE == spi_dma_wait(&transfer[i])) && ok;
+    }
+    cycles = cycle_count_elapsed(start);
+
+    ok = ok && (0 == memcmp(rxData, txData, transfers * size));
+
+    dma_benchmark_csv_begin("spi");
+    dma_benchmark_csv_u32(transfers);
+    dma_benchmark_csv_u32(size);
+    dma_benchmark_csv_u32(cycles);
+    dma_benchmark_csv_u32(cycles / transfers);
+    dma_benchmark_csv_u32(cpuCycles);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,157 @@
+/******************************************************************************
+* File Name:   spi_dma.h
+*
+* Description: Public interface of the DMA-driven SPI master engine.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef SPI_DMA_H
+#define SPI_DMA_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_benchmark.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channels of the transmitter and the receiver */
+#ifndef SPI_DMA_TX_CHANNEL
+#define SPI_DMA_TX_CHANNEL              3UL
+#endif
+
+#ifndef SPI_DMA_RX_CHANNEL
+#define SPI_DMA_RX_CHANNEL              4UL
+#endif
+
+/* Channel priorities. The receiver must win so that the RX FIFO never
+ * overflows while the transmitter keeps the TX FIFO filled. */
+#ifndef SPI_DMA_TX_PRIORITY
+#define SPI_DMA_TX_PRIORITY             1UL
+#endif
+
+#ifndef SPI_DMA_RX_PRIORITY
+#define SPI_DMA_RX_PRIORITY             0UL
+#endif
+
+/* Trigger multiplexer inputs of the SPI SCB requests and the outputs to the
+ * channels. Unless SPI_DMA_TX_TRIGGER_IN and SPI_DMA_RX_TRIGGER_IN are
+ * defined, spi_dma_init() derives the inputs from the SCB it is given, which
+ * is the design alias of the SPI block, such as SPI_HW. */
+#ifndef SPI_DMA_TX_TRIGGER_OUT
+#define SPI_DMA_TX_TRIGGER_OUT          TRIG0_OUT_CPUSS_DMAC_TR_IN3
+#endif
+
+#ifndef SPI_DMA_RX_TRIGGER_OUT
+#define SPI_DMA_RX_TRIGGER_OUT          TRIG0_OUT_CPUSS_DMAC_TR_IN4
+#endif
+
+/* The SCB requests data while the TX FIFO holds fewer entries than this. It
+ * also bounds the bytes in flight, which must fit into the RX FIFO. */
+#ifndef SPI_DMA_TX_FIFO_LEVEL
+#define SPI_DMA_TX_FIFO_LEVEL           4UL
+#endif
+
+/* Byte sent when a transfer has no transmit data */
+#ifndef SPI_DMA_DUMMY_BYTE
+#define SPI_DMA_DUMMY_BYTE              0xFFU
+#endif
+
+/* Bound of spi_dma_wait(), long enough for a queue of large transfers */
+#ifndef SPI_DMA_WAIT_TIMEOUT_MS
+#define SPI_DMA_WAIT_TIMEOUT_MS         1000UL
+#endif
+
+/* Largest transfer, in bytes */
+#define SPI_DMA_MAX_SIZE                65536UL
+
+/* Slave select of the loopback benchmark */
+#ifndef SPI_DMA_BENCHMARK_SLAVE_SELECT
+#define SPI_DMA_BENCHMARK_SLAVE_SELECT  CY_SCB_SPI_SLAVE_SELECT0
+#endif
+
+/* Largest transfer and number of transactions per batch of the loopback
+ * benchmark. The transmit and receive data share the benchmark buffer. */
+#define SPI_DMA_BENCHMARK_MAX_SIZE      (DMA_BENCHMARK_MAX_SIZE / 2UL)
+#define SPI_DMA_BENCHMARK_BATCH         4UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+typedef struct spi_dma_transfer spi_dma_transfer_t;
+
+/* Transfer completion callback, called from the DMAC interrupt */
+typedef void (*spi_dma_callback_t)(spi_dma_transfer_t *transfer);
+
+/* One SPI transaction. The structure is owned by the caller and must stay
+ * valid until the transaction is complete. */
+struct spi_dma_transfer
+{
+    const uint8_t *txData;              /* Data to send, or NULL to send SPI_DMA_DUMMY_BYTE */
+    uint8_t *rxData;                    /* Receive buffer, or NULL to discard */
+    uint32_t size;                      /* Number of bytes, 1 to SPI_DMA_MAX_SIZE */
+    cy_en_scb_spi_slave_select_t slaveSelect;
+    spi_dma_callback_t callback;        /* Called on completion, or NULL */
+    void *context;                      /* Application data for the callback */
+    volatile cy_en_dmac_response_t response;    /* DMA_CHAIN_RESPONSE_PENDING until complete */
+    spi_dma_transfer_t *next;           /* Queue link, used by the engine */
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void spi_dma_init(CySCB_Type *base);
+bool spi_dma_submit(spi_dma_transfer_t *transfer);
+bool spi_dma_is_busy(void);
+cy_en_dmac_response_t spi_dma_wait(const spi_dma_transfer_t *transfer);
+void spi_dma_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SPI_DMA_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,792 @@
+/******************************************************************************
+* File Name:   sram_march.c
+*
+* Description: This file contains the background SRAM March test engine. A
+*              region is tested one chunk at a time with a MATS+ March test in
+*              ascending address order: a low-priority DMAC channel writes each
+*              data background into the chunk, and the CPU runs the read/write
+*              elements. After each chunk the engine idles long enough to keep
+*              its bus time below a cap. In preserve (scrub) mode, the DMAC
+*              saves each chunk before and restores it after its test, with
+*              interrupts masked in between.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "sram_march.h"
+#include "dma_chain.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+#if (SRAM_MARCH_CHANNEL >= CPUSS_DMAC_CH_NR)
+#error "SRAM_MARCH_CHANNEL is not a DMAC channel of this device"
+#endif
+
+#if (SRAM_MARCH_BENCHMARK_SIZE > DMA_BENCHMARK_MAX_SIZE)
+#error "SRAM_MARCH_BENCHMARK_SIZE exceeds the shared benchmark buffer"
+#endif
+
+/* Words per chunk */
+#define SRAM_MARCH_CHUNK_WORDS          (SRAM_MARCH_CHUNK_SIZE / 4UL)
+
+/* Number of data backgrounds */
+#define SRAM_MARCH_BACKGROUNDS          2UL
+
+/* Full scale of the bus time cap */
+#define SRAM_MARCH_PERCENT              100UL
+
+/* Full scale of the reported bus share */
+#define SRAM_MARCH_PERMILLE             1000UL
+
+/* Bus time caps of the benchmark, in percent */
+#define SRAM_MARCH_BENCHMARK_CAPS       { 100UL, 25UL, SRAM_MARCH_BUS_PERCENT }
+
+/* Seed of the benchmark region contents */
+#define SRAM_MARCH_BENCHMARK_SEED       0x9E3779B9UL
+
+/* Stack of the application, which a region must not overlap. The defaults
+ * are the symbols of the GCC_ARM linker script; define both for another
+ * toolchain. */
+#if !defined(SRAM_MARCH_STACK_LIMIT)
+extern const uint8_t __StackLimit[];
+extern const uint8_t __StackTop[];
+#define SRAM_MARCH_STACK_LIMIT          ((uintptr_t) __StackLimit)
+#define SRAM_MARCH_STACK_TOP            ((uintptr_t) __StackTop)
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Result of the test of one chunk */
+typedef struct
+{
+    uint32_t errors;                    /* Reads that returned a wrong word */
+    uint32_t firstError;                /* Address of the first wrong word */
+    bool transferOk;                    /* All DMAC transfers completed */
+} sram_march_chunk_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Data backgrounds. Each is written and read as itself and as its inverse,
+ * so every bit is written to 1 and to 0 from the opposite value, and the
+ * second puts opposite values in adjacent bits. */
+static const uint32_t g_marchBackgrounds[SRAM_MARCH_BACKGROUNDS] =
+{
+    0x00000000UL,
+    0x55555555UL
+};
+
+/* Saved contents of the chunk under test */
+static CY_ALIGN(4) uint32_t g_marchSave[SRAM_MARCH_CHUNK_WORDS];
+
+/* Pass configuration */
+static uint32_t *g_marchRegion = NULL;
+static uint32_t g_marchChunks = 0UL;
+static bool g_marchPreserve = false;
+static uint32_t g_marchBusPercent = SRAM_MARCH_BUS_PERCENT;
+
+/* Pass progress */
+static sram_march_state_t g_marchState = SRAM_MARCH_IDLE;
+static uint32_t g_marchChunk = 0UL;
+static uint32_t g_marchGapStart = 0UL;
+static uint32_t g_marchGap = 0UL;
+static sram_march_stats_t g_marchStats;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static bool sram_march_overlaps(uintptr_t address, uint32_t size, uintptr_t start, uintptr_t end);
+static void sram_march_step(void);
+static void sram_march_chunk(uint32_t *chunk, bool preserve, uint32_t timeout, sram_march_chunk_t *result);
+static bool sram_march_dma(const void *src, void *dst, bool srcIncrement, uint32_t timeout);
+static void sram_march_elements(volatile uint32_t *chunk, uint32_t background, sram_march_chunk_t *result);
+static uint32_t sram_march_cpu(uint32_t *region, uint32_t size, bool preserve);
+static void sram_march_benchmark_fill(uint32_t *target);
+static bool sram_march_benchmark_verify(const uint32_t *target);
+static void sram_march_benchmark_row(const char *method, uint32_t busPercent, uint32_t cycles,
+                                     uint32_t cpuCycles, uint32_t busCycles, uint32_t errors, bool ok);
+
+/********************************************************************************
+* Function Name: sram_march_init
+*********************************************************************************
+* Summary:
+* Initializes the engine channel at SRAM_MARCH_PRIORITY and enables it. The
+* DMAC must be enabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void sram_march_init(void)
+{
+    const cy_stc_dmac_channel_config_t channelConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = SRAM_MARCH_PRIORITY,
+        .enable     = false
+    };
+
+    g_marchState = SRAM_MARCH_IDLE;
+
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, SRAM_MARCH_CHANNEL, &channelConfig);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, SRAM_MARCH_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: sram_march_start
+*********************************************************************************
+* Summary:
+* Starts a pass over a region. Without preserve, the engine owns the region
+* until the pass ends and leaves the last background in it. In preserve
+* mode, each chunk is restored before sram_march_poll() returns, so the
+* region may hold live data; see sram_march_poll() for what it must not
+* contain. Regions that overlap the stack or the save buffer of the engine
+* are rejected.
+*
+* Parameters:
+*  region: Start of the region, word-aligned
+*  size: Size in bytes, a multiple of SRAM_MARCH_CHUNK_SIZE
+*  preserve: Restore the contents of each chunk after testing it
+*  busPercent: Bus time cap, 1 to 100 percent
+*
+* Return:
+*  bool: true if the pass was started, false if a pass is running or the
+*        arguments are invalid
+*
+********************************************************************************/
+bool sram_march_start(void *region, uint32_t size, bool preserve, uint32_t busPercent)
+{
+    uintptr_t address = (uintptr_t) region;
+    uintptr_t save = (uintptr_t) g_marchSave;
+    bool valid = (SRAM_MARCH_RUNNING != g_marchState) &&
+                 (NULL != region) && (0UL == (address & 3UL)) &&
+                 (0UL != size) && (0UL == (size % SRAM_MARCH_CHUNK_SIZE)) &&
+                 (0UL != busPercent) && (busPercent <= SRAM_MARCH_PERCENT) &&
+                 !sram_march_overlaps(address, size, save, save + sizeof(g_marchSave)) &&
+                 !sram_march_overlaps(address, size, SRAM_MARCH_STACK_LIMIT, SRAM_MARCH_STACK_TOP);
+
+    if (valid)
+    {
+        g_marchRegion = (uint32_t *) region;
+        g_marchChunks = size / SRAM_MARCH_CHUNK_SIZE;
+        g_marchPreserve = preserve;
+        g_marchBusPercent = busPercent;
+
+        g_marchChunk = 0UL;
+        g_marchGapStart = cycle_count_now();
+        g_marchGap = 0UL;
+        (void) memset(&g_marchStats, 0, sizeof(g_marchStats));
+
+        g_marchState = SRAM_MARCH_RUNNING;
+    }
+
+    return valid;
+}
+
+/********************************************************************************
+* Function Name: sram_march_poll
+*********************************************************************************
+* Summary:
+* Advances a running pass: tests the next chunk once the bus time cap allows
+* it. Call it from the main loop; the engine makes no progress between calls.
+*
+* A chunk is tested in one call. In preserve mode, interrupts are masked from
+* the save to the restore, so no handler sees the chunk while it holds test
+* data. Between the save and the restore the engine reads and writes only
+* the chunk, its save buffer, the stack and peripheral registers. A preserved
+* region may therefore hold any data of the application, including the
+* variables of the engine and of the DMA and trace drivers, but not the stack
+* or memory written by another DMAC channel or bus master during the pass.
+*
+* A transfer that does not complete within SRAM_MARCH_TIMEOUT_MS, or ends
+* with an error, fails the pass; in preserve mode the CPU restores the chunk
+* before the channel is reset.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true while a pass is running
+*
+********************************************************************************/
+bool sram_march_poll(void)
+{
+    uint32_t start = cycle_count_now();
+
+    if ((SRAM_MARCH_RUNNING == g_marchState) && cycle_count_expired(g_marchGapStart, g_marchGap))
+    {
+        sram_march_step();
+        g_marchStats.cpuCycles += cycle_count_elapsed(start);
+    }
+
+    return (SRAM_MARCH_RUNNING == g_marchState);
+}
+
+/********************************************************************************
+* Function Name: sram_march_get_state
+*********************************************************************************
+* Summary:
+* Returns the state of the engine.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  sram_march_state_t: Running, or the result of the last pass
+*
+********************************************************************************/
+sram_march_state_t sram_march_get_state(void)
+{
+    return g_marchState;
+}
+
+/********************************************************************************
+* Function Name: sram_march_get_stats
+*********************************************************************************
+* Summary:
+* Returns the results of the running or last pass.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  const sram_march_stats_t *: Pass results
+*
+********************************************************************************/
+const sram_march_stats_t *sram_march_get_stats(void)
+{
+    return &g_marchStats;
+}
+
+/********************************************************************************
+* Function Name: sram_march_overlaps
+*********************************************************************************
+* Summary:
+* Tests whether a region overlaps an address range.
+*
+* Parameters:
+*  address: Start of the region
+*  size: Size of the region in bytes
+*  start: Start of the range
+*  end: End of the range, exclusive
+*
+* Return:
+*  bool: true if they overlap
+*
+********************************************************************************/
+static bool sram_march_overlaps(uintptr_t address, uint32_t size, uintptr_t start, uintptr_t end)
+{
+    return (address < end) && (start < (address + size));
+}
+
+/********************************************************************************
+* Function Name: sram_march_step
+*********************************************************************************
+* Summary:
+* Tests the current chunk, accounts the result, and sets the idle time that
+* keeps the engine's share of the elapsed time at the cap. The busy time of
+* a chunk includes any wait for the bus behind higher-priority channels, so
+* the cap errs on the side of the application.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void sram_march_step(void)
+{
+    uint32_t *chunk = &g_marchRegion[g_marchChunk * SRAM_MARCH_CHUNK_WORDS];
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(SRAM_MARCH_TIMEOUT_MS);
+    sram_march_chunk_t result;
+    uint32_t start;
+    uint32_t busy;
+
+    event_trace_record(EVENT_TRACE_DMA_TRIGGER,
+                       EVENT_TRACE_DMA_ARG(SRAM_MARCH_CHANNEL, EVENT_TRACE_DESCR_UNKNOWN, 0UL));
+
+    start = cycle_count_now();
+    sram_march_chunk(chunk, g_marchPreserve, timeout, &result);
+    busy = cycle_count_elapsed(start);
+
+    g_marchStats.busCycles += busy;
+    if ((0UL == g_marchStats.errors) && (0UL != result.errors))
+    {
+        g_marchStats.firstError = result.firstError;
+    }
+    g_marchStats.errors += result.errors;
+
+    if (!result.transferOk)
+    {
+        g_marchStats.transferErrors++;
+        dma_chain_recover(SRAM_MARCH_CHANNEL);
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, SRAM_MARCH_CHANNEL);
+        g_marchState = SRAM_MARCH_FAILED;
+    }
+    else
+    {
+        g_marchChunk++;
+        g_marchStats.chunks++;
+
+        if (g_marchChunk < g_marchChunks)
+        {
+            g_marchGap = (uint32_t) (((uint64_t) busy * (SRAM_MARCH_PERCENT - g_marchBusPercent)) /
+                                     g_marchBusPercent);
+            g_marchGapStart = cycle_count_now();
+        }
+        else
+        {
+            g_marchState = (0UL == g_marchStats.errors) ? SRAM_MARCH_PASSED : SRAM_MARCH_FAILED;
+        }
+    }
+}
+
+/********************************************************************************
+* Function Name: sram_march_chunk
+*********************************************************************************
+* Summary:
+* Tests one chunk with a MATS+ March test in ascending address order, for
+* each data background b:
+*
+*   up(w b); up(r b, w ~b); up(r ~b, w b)
+*
+* The DMAC saves the chunk, writes the background and restores the chunk.
+* The read/write elements need a compare between the read and the write of
+* each word, which the DMAC cannot do, so the CPU runs them. The DMAC only
+* increments addresses, so the third element is ascending as well.
+*
+* Everything is passed in arguments and results are returned through the
+* caller's stack, because the chunk may hold the engine's own variables.
+*
+* Parameters:
+*  chunk: Chunk under test
+*  preserve: Save and restore the chunk, with interrupts masked
+*  timeout: Bound of each transfer in CPU cycles
+*  result: Errors and transfer result of the chunk
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void sram_march_chunk(uint32_t *chunk, bool preserve, uint32_t timeout, sram_march_chunk_t *result)
+{
+    uint32_t interruptState = 0UL;
+    uint32_t b;
+    uint32_t i;
+    bool saved = false;
+
+    result->errors = 0UL;
+    result->firstError = 0UL;
+    result->transferOk = true;
+
+    if (preserve)
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        saved = sram_march_dma(chunk, g_marchSave, true, timeout);
+        result->transferOk = saved;
+    }
+
+    for (b = 0UL; result->transferOk && (b < SRAM_MARCH_BACKGROUNDS); b++)
+    {
+        result->transferOk = sram_march_dma(&g_marchBackgrounds[b], chunk, false, timeout);
+        if (result->transferOk)
+        {
+            sram_march_elements(chunk, g_marchBackgrounds[b], result);
+        }
+    }
+
+    if (saved)
+    {
+        if (result->transferOk)
+        {
+            result->transferOk = sram_march_dma(g_marchSave, chunk, true, timeout);
+        }
+        if (!result->transferOk)
+        {
+            /* The channel may still be moving the fill or the restore: stop
+             * it before the CPU puts the saved words back */
+            Cy_DMAC_Channel_Disable(USER_DMA_HW, SRAM_MARCH_CHANNEL);
+            for (i = 0UL; i < SRAM_MARCH_CHUNK_WORDS; i++)
+            {
+                chunk[i] = g_marchSave[i];
+            }
+        }
+    }
+
+    if (preserve)
+    {
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+}
+
+/********************************************************************************
+* Function Name: sram_march_dma
+*********************************************************************************
+* Summary:
+* Copies or fills one chunk with PING and waits for the response. The wait
+* measures time from the SysTick register, not with cycle_count_now(), whose
+* wrap count may lie in the chunk under test.
+*
+* Parameters:
+*  src: Source, a chunk or a single background word
+*  dst: Destination chunk
+*  srcIncrement: Copy a chunk rather than fill from one word
+*  timeout: Bound of the transfer in CPU cycles
+*
+* Return:
+*  bool: true if the transfer completed in time
+*
+********************************************************************************/
+static bool sram_march_dma(const void *src, void *dst, bool srcIncrement, uint32_t timeout)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = src,
+        .dst          = dst,
+        .count        = SRAM_MARCH_CHUNK_WORDS,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = srcIncrement,
+        .dstIncrement = true,
+        .interrupt    = false
+    };
+    cy_en_dmac_response_t response;
+    uint32_t previous;
+    uint32_t now;
+    uint32_t elapsed = 0UL;
+
+    (void) dma_chain_config(SRAM_MARCH_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+    Cy_DMAC_Channel_SetCurrentDescriptor(USER_DMA_HW, SRAM_MARCH_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+
+    previous = Cy_SysTick_GetValue();
+    (void) Cy_TrigMux_SwTrigger(SRAM_MARCH_TRIGGER, DMA_TRIGGER_ASSERT_CYCLES);
+
+    do
+    {
+        response = Cy_DMAC_Descriptor_GetResponse(USER_DMA_HW, SRAM_MARCH_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        now = Cy_SysTick_GetValue();
+        elapsed += (previous - now) & CYCLE_COUNT_RELOAD;
+        previous = now;
+    } while ((DMA_CHAIN_RESPONSE_PENDING == response) && (elapsed < timeout));
+
+    return (CY_DMAC_DONE == response);
+}
+
+/********************************************************************************
+* Function Name: sram_march_elements
+*********************************************************************************
+* Summary:
+* Runs the read/write elements of one background on a chunk that holds the
+* background: up(r b, w ~b) and up(r ~b, w b).
+*
+* Parameters:
+*  chunk: Chunk under test
+*  background: Data background b
+*  result: Errors of the chunk, updated
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void sram_march_elements(volatile uint32_t *chunk, uint32_t background, sram_march_chunk_t *result)
+{
+    uint32_t expected = background;
+    uint32_t e;
+    uint32_t i;
+
+    for (e = 0UL; e < 2UL; e++)
+    {
+        for (i = 0UL; i < SRAM_MARCH_CHUNK_WORDS; i++)
+        {
+            if (chunk[i] != expected)
+            {
+                if (0UL == result->errors)
+                {
+                    result->firstError = (uint32_t) (uintptr_t) &chunk[i];
+                }
+                result->errors++;
+            }
+            chunk[i] = ~expected;
+        }
+        expected = ~expected;
+    }
+}
+
+/********************************************************************************
+* Function Name: sram_march_cpu
+*********************************************************************************
+* Summary:
+* CPU reference of a pass: the same March test and chunk order, with the CPU
+* also saving, writing the background and restoring.
+*
+* Parameters:
+*  region: Start of the region, word-aligned
+*  size: Size in bytes, a multiple of SRAM_MARCH_CHUNK_SIZE
+*  preserve: Restore the contents of each chunk after testing it
+*
+* Return:
+*  uint32_t: Number of reads that returned a wrong word
+*
+********************************************************************************/
+static uint32_t sram_march_cpu(uint32_t *region, uint32_t size, bool preserve)
+{
+    volatile uint32_t *chunk;
+    sram_march_chunk_t result = { 0UL, 0UL, true };
+    uint32_t interruptState = 0UL;
+    uint32_t offset;
+    uint32_t b;
+    uint32_t i;
+
+    for (offset = 0UL; offset < (size / 4UL); offset += SRAM_MARCH_CHUNK_WORDS)
+    {
+        chunk = &region[offset];
+
+        if (preserve)
+        {
+            interruptState = Cy_SysLib_EnterCriticalSection();
+            for (i = 0UL; i < SRAM_MARCH_CHUNK_WORDS; i++)
+            {
+                g_marchSave[i] = chunk[i];
+            }
+        }
+
+        for (b = 0UL; b < SRAM_MARCH_BACKGROUNDS; b++)
+        {
+            for (i = 0UL; i < SRAM_MARCH_CHUNK_WORDS; i++)
+            {
+                chunk[i] = g_marchBackgrounds[b];
+            }
+            sram_march_elements(chunk, g_marchBackgrounds[b], &result);
+        }
+
+        if (preserve)
+        {
+            for (i = 0UL; i < SRAM_MARCH_CHUNK_WORDS; i++)
+            {
+                chunk[i] = g_marchSave[i];
+            }
+            Cy_SysLib_ExitCriticalSection(interruptState);
+        }
+    }
+
+    return result.errors;
+}
+
+/********************************************************************************
+* Function Name: sram_march_benchmark_run
+*********************************************************************************
+* Summary:
+* Tests SRAM_MARCH_BENCHMARK_SIZE bytes in preserve mode with the CPU and
+* with the engine at several bus time caps, and writes the elapsed cycles,
+* the CPU cycles and the engine's share of the elapsed time as CSV. ok checks
+* that the pass found no error and restored the region. The cycle counter,
+* the engine, the DMAC and UART_HW must be initialized.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void sram_march_benchmark_run(void)
+{
+    static const uint32_t caps[] = SRAM_MARCH_BENCHMARK_CAPS;
+    uint32_t *target = (uint32_t *) dma_benchmark_scratch();
+    uint32_t errors;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t c;
+    bool ok;
+
+    dma_benchmark_csv_comment("sram_march");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("bus_percent");
+    dma_benchmark_csv_str("size");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("cpu_cycles");
+    dma_benchmark_csv_str("bus_permille");
+    dma_benchmark_csv_str("errors");
+    dma_benchmark_csv_str("ok");
+    dma_benchmark_csv_end();
+
+    sram_march_benchmark_fill(target);
+    start = cycle_count_now();
+    errors = sram_march_cpu(target, SRAM_MARCH_BENCHMARK_SIZE, true);
+    cycles = cycle_count_elapsed(start);
+    ok = (0UL == errors) && sram_march_benchmark_verify(target);
+    sram_march_benchmark_row("cpu", 0UL, cycles, cycles, 0UL, errors, ok);
+
+    for (c = 0UL; c < (sizeof(caps) / sizeof(caps[0])); c++)
+    {
+        sram_march_benchmark_fill(target);
+        start = cycle_count_now();
+        if (sram_march_start(target, SRAM_MARCH_BENCHMARK_SIZE, true, caps[c]))
+        {
+            while (sram_march_poll())
+            {
+                /* Each transfer is bounded by SRAM_MARCH_TIMEOUT_MS */
+            }
+        }
+        cycles = cycle_count_elapsed(start);
+
+        ok = (SRAM_MARCH_PASSED == g_marchState) && sram_march_benchmark_verify(target);
+        sram_march_benchmark_row("dma", caps[c], cycles, g_marchStats.cpuCycles, g_marchStats.busCycles,
+                                 g_marchStats.errors + g_marchStats.transferErrors, ok);
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: sram_march_benchmark_fill
+*********************************************************************************
+* Summary:
+* Fills the benchmark region with a pattern that differs from the data
+* backgrounds, so a missing restore is detected.
+*
+* Parameters:
+*  target: Benchmark region, SRAM_MARCH_BENCHMARK_SIZE bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void sram_march_benchmark_fill(uint32_t *target)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < (SRAM_MARCH_BENCHMARK_SIZE / 4UL); i++)
+    {
+        target[i] = (i + 1UL) * SRAM_MARCH_BENCHMARK_SEED;
+    }
+}
+
+/********************************************************************************
+* Function Name: sram_march_benchmark_verify
+*********************************************************************************
+* Summary:
+* Checks that the benchmark region holds the contents written by
+* sram_march_benchmark_fill().
+*
+* Parameters:
+*  target: Benchmark region, SRAM_MARCH_BENCHMARK_SIZE bytes
+*
+* Return:
+*  bool: true if the contents were restored
+*
+********************************************************************************/
+static bool sram_march_benchmark_verify(const uint32_t *target)
+{
+    uint32_t i;
+    bool ok = true;
+
+    for (i = 0UL; i < (SRAM_MARCH_BENCHMARK_SIZE / 4UL); i++)
+    {
+        ok = ok && (target[i] == (uint32_t) ((i + 1UL) * SRAM_MARCH_BENCHMARK_SEED));
+    }
+
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: sram_march_benchmark_row
+*********************************************************************************
+* Summary:
+* Writes one benchmark result as CSV. The bus share is the part of the
+* elapsed time the engine spent testing chunks; the CPU method has neither a
+* cap nor a share.
+*
+* Parameters:
+*  method: "cpu" or "dma"
+*  busPercent: Bus time cap, 0 for the CPU method
+*  cycles: Elapsed cycles of the pass
+*  cpuCycles: CPU cycles spent on the pass
+*  busCycles: Cycles spent testing chunks
+*  errors: Wrong reads and transfer errors
+*  ok: Pass without error and region restored
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void sram_march_benchmark_row(const char *method, uint32_t busPercent, uint32_t cycles,
+                                     uint32_t cpuCycles, uint32_t busCycles, uint32_t errors, bool ok)
+{
+    dma_benchmark_csv_begin("march");
+    dma_benchmark_csv_str(method);
+    if (0UL != busPercent)
+    {
+        dma_benchmark_csv_u32(busPercent);
+    }
+    else
+    {
+        dma_benchmark_csv_str("-");
+    }
+    dma_benchmark_csv_u32(SRAM_MARCH_BENCHMARK_SIZE);
+    dma_benchmark_csv_u32(cycles);
+    dma_benchmark_csv_u32(cpuCycles);
+    if (0UL != busPercent)
+    {
+        dma_benchmark_csv_u32((uint32_t) (((uint64_t) busCycles * SRAM_MARCH_PERMILLE) / cycles));
+    }
+    else
+    {
+        dma_benchmark_csv_str("-");
+    }
+    dma_benchmark_csv_u32(errors);
+    dma_benchmark_csv_u32(ok ? 1UL : 0UL);
+    dma_benchmark_csv_end();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,138 @@
+/******************************************************************************
+* File Name:   sram_march.h
+*
+* Description: This file contains the declarations of the background SRAM March
+*              test engine.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef SRAM_MARCH_H
+#define SRAM_MARCH_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channel of the engine. Check it against CPUSS_DMAC_CH_NR. */
+#ifndef SRAM_MARCH_CHANNEL
+#define SRAM_MARCH_CHANNEL              6UL
+#endif
+
+/* Channel priority. The lowest, so application transfers win arbitration. */
+#ifndef SRAM_MARCH_PRIORITY
+#define SRAM_MARCH_PRIORITY             3UL
+#endif
+
+/* Trigger multiplexer output of the engine channel, software-triggered */
+#ifndef SRAM_MARCH_TRIGGER
+#define SRAM_MARCH_TRIGGER              TRIG0_OUT_CPUSS_DMAC_TR_IN6
+#endif
+
+/* Bytes tested per sram_march_poll() call, a multiple of 4. The engine holds
+ * a save buffer of this size. In preserve mode, interrupts are masked while
+ * a chunk is tested. */
+#ifndef SRAM_MARCH_CHUNK_SIZE
+#define SRAM_MARCH_CHUNK_SIZE           64UL
+#endif
+
+/* Default bus time cap, in percent of the time the engine runs */
+#ifndef SRAM_MARCH_BUS_PERCENT
+#define SRAM_MARCH_BUS_PERCENT          10UL
+#endif
+
+/* Bound of one transfer of the engine. A transfer that has not completed by
+ * then is abandoned and the pass fails. */
+#ifndef SRAM_MARCH_TIMEOUT_MS
+#define SRAM_MARCH_TIMEOUT_MS           10UL
+#endif
+
+/* Region size of the benchmark, a multiple of SRAM_MARCH_CHUNK_SIZE. The
+ * region is in the shared benchmark buffer. */
+#ifndef SRAM_MARCH_BENCHMARK_SIZE
+#define SRAM_MARCH_BENCHMARK_SIZE       1024UL
+#endif
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Engine state */
+typedef enum
+{
+    SRAM_MARCH_IDLE,                    /* No pass started */
+    SRAM_MARCH_RUNNING,                 /* Pass in progress */
+    SRAM_MARCH_PASSED,                  /* Last pass found no error */
+    SRAM_MARCH_FAILED                   /* Last pass found an error or timed out */
+} sram_march_state_t;
+
+/* Results of the current or last pass */
+typedef struct
+{
+    uint32_t chunks;                    /* Chunks completed */
+    uint32_t errors;                    /* Reads that returned a wrong word */
+    uint32_t firstError;                /* Address of the first wrong word */
+    uint32_t transferErrors;            /* DMAC error responses and timeouts */
+    uint32_t busCycles;                 /* Cycles spent testing chunks */
+    uint32_t cpuCycles;                 /* Cycles spent in sram_march_poll() work */
+} sram_march_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void sram_march_init(void);
+bool sram_march_start(void *region, uint32_t size, bool preserve, uint32_t busPercent);
+bool sram_march_poll(void);
+sram_march_state_t sram_march_get_state(void);
+const sram_march_stats_t *sram_march_get_stats(void);
+void sram_march_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SRAM_MARCH_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,403 @@
+/******************************************************************************
+* File Name:   telemetry.c
+*
+* Description: This file contains the binary telemetry channel. A packet is a
+*              type, a sequence number, the payload and a CRC-16/CCITT of these,
+*              COBS-encoded so that it contains no zero byte, and sent between two
+*              zero delimiters. The leading delimiter resynchronizes the host after
+*              text output on the same UART.
+*
+*              Frames are encoded alternately into two buffers, so the next frame
+*              is encoded while the previous one is sent by the DMA.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "telemetry.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+#include "uart_fmt.h"
+#if (TELEMETRY_TX_DMA)
+#include "uart_tx_dma.h"
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Type and sequence number */
+#define TELEMETRY_HEADER_SIZE           2UL
+
+/* CRC-16/CCITT, least significant byte first */
+#define TELEMETRY_CRC_SIZE              2UL
+#define TELEMETRY_CRC_INIT              0xFFFFU
+
+/* Largest unencoded packet */
+#define TELEMETRY_PACKET_SIZE           (TELEMETRY_HEADER_SIZE + TELEMETRY_MAX_PAYLOAD + TELEMETRY_CRC_SIZE)
+
+/* COBS adds one code byte per 254 data bytes, plus one. Two delimiters. */
+#define TELEMETRY_COBS_BLOCK            254UL
+#define TELEMETRY_FRAME_SIZE            (TELEMETRY_PACKET_SIZE + (TELEMETRY_PACKET_SIZE / TELEMETRY_COBS_BLOCK) + 3UL)
+
+/* Frame delimiter */
+#define TELEMETRY_DELIMITER             0x00U
+
+/* Number of frame buffers */
+#define TELEMETRY_FRAMES                2UL
+
+/* Payload bytes of each format in the benchmark */
+#define TELEMETRY_BENCHMARK_SIZE        1024UL
+
+/* Address prefix of a buffer packet */
+#define TELEMETRY_ADDRESS_SIZE          4UL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* CRC-16/CCITT (polynomial 0x1021) for one nibble */
+static const uint16_t g_telemetryCrcTable[16] =
+{
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+/* Encoded frames */
+static uint8_t g_telemetryFrames[TELEMETRY_FRAMES][TELEMETRY_FRAME_SIZE];
+static uint32_t g_telemetryNext = 0UL;
+
+/* Sequence number of the next packet */
+static uint8_t g_telemetrySequence = 0U;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static uint16_t telemetry_crc16(uint16_t crc, const uint8_t *data, uint32_t size);
+static uint32_t telemetry_cobs_encode(uint8_t *dst, const uint8_t *src, uint32_t size);
+
+/********************************************************************************
+* Function Name: telemetry_init
+*********************************************************************************
+* Summary:
+* Initializes the telemetry channel and, with TELEMETRY_TX_DMA, the DMA
+* transmitter. UART_HW must be initialized and the DMAC enabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void telemetry_init(void)
+{
+    g_telemetryNext = 0UL;
+    g_telemetrySequence = 0U;
+
+#if (TELEMETRY_TX_DMA)
+    uart_tx_dma_init();
+#endif
+}
+
+/********************************************************************************
+* Function Name: telemetry_send
+*********************************************************************************
+* Summary:
+* Encodes a packet and sends it. With the DMA transmitter, the function
+* returns once the previous frame is in the TX FIFO and this one is started.
+*
+* Parameters:
+*  type: Packet type
+*  payload: Payload
+*  size: Payload size in bytes (up to TELEMETRY_MAX_PAYLOAD)
+*
+* Return:
+*  bool: true if the packet was sent, false if the payload is too large
+*
+********************************************************************************/
+bool telemetry_send(uint8_t type, const void *payload, uint32_t size)
+{
+    uint8_t packet[TELEMETRY_PACKET_SIZE];
+    uint8_t *frame = g_telemetryFrames[g_telemetryNext];
+    uint32_t length;
+    uint16_t crc;
+
+    if (size > TELEMETRY_MAX_PAYLOAD)
+    {
+        return false;
+    }
+
+    packet[0] = type;
+    packet[1] = g_telemetrySequence++;
+    (void) memcpy(&packet[TELEMETRY_HEADER_SIZE], payload, size);
+    length = TELEMETRY_HEADER_SIZE + size;
+
+    crc = telemetry_crc16(TELEMETRY_CRC_INIT, packet, length);
+    packet[length++] = (uint8_t) crc;
+    packet[length++] = (uint8_t) (crc >> 8U);
+
+    frame[0] = TELEMETRY_DELIMITER;
+    length = 1UL + telemetry_cobs_encode(&frame[1], packet, length);
+    frame[length++] = TELEMETRY_DELIMITER;
+
+#if (TELEMETRY_TX_DMA)
+    /* The other buffer may still be in flight; this one is free */
+    (void) uart_tx_dma_wait();
+    (void) uart_tx_dma_send(frame, length);
+#else
+    (void) uart_fmt_chars((const char *) frame, length);
+#endif
+
+    g_telemetryNext ^= 1UL;
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: telemetry_send_buffer
+*********************************************************************************
+* Summary:
+* Sends a memory buffer as TELEMETRY_TYPE_BUFFER packets, each with the
+* address of its first byte.
+*
+* Parameters:
+*  data: Buffer to send
+*  size: Number of bytes
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void telemetry_send_buffer(const void *data, uint32_t size)
+{
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t address;
+    uint32_t chunk;
+
+    while (0UL != size)
+    {
+        chunk = TELEMETRY_MAX_PAYLOAD - TELEMETRY_ADDRESS_SIZE;
+        chunk = (size < chunk) ? size : chunk;
+        address = (uint32_t) (uintptr_t) bytes;
+
+        (void) memcpy(payload, &address, TELEMETRY_ADDRESS_SIZE);
+        (void) memcpy(&payload[TELEMETRY_ADDRESS_SIZE], bytes, chunk);
+        (void) telemetry_send(TELEMETRY_TYPE_BUFFER, payload, TELEMETRY_ADDRESS_SIZE + chunk);
+
+        bytes += chunk;
+        size -= chunk;
+    }
+}
+
+/********************************************************************************
+* Function Name: telemetry_flush
+*********************************************************************************
+* Summary:
+* Waits until all frames are transmitted on the line.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void telemetry_flush(void)
+{
+#if (TELEMETRY_TX_DMA)
+    (void) uart_tx_dma_wait();
+#endif
+
+    (void) uart_fmt_flush();
+}
+
+/********************************************************************************
+* Function Name: telemetry_benchmark_run
+*********************************************************************************
+* Summary:
+* Sends the same TELEMETRY_BENCHMARK_SIZE bytes as a text hex dump and as
+* telemetry buffer packets, and writes the estimated bytes on the line and
+* the measured time until the line is idle as CSV. The byte counts follow
+* from the formats, not from the UART. The payload rate is payload_bytes *
+* cpu_hz / cycles. The binary frames appear in the terminal; capture the output
+* with tools/telemetry_decode.py to verify them.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void telemetry_benchmark_run(void)
+{
+    const uint8_t *payload = (const uint8_t *) CY_FLASH_BASE;
+    uint32_t packets;
+    uint32_t wireText;
+    uint32_t wireBinary;
+    uint32_t cyclesText;
+    uint32_t cyclesBinary;
+    uint32_t start;
+
+    wireText = (TELEMETRY_BENCHMARK_SIZE / UART_FMT_HEXDUMP_WIDTH) * UART_FMT_HEXDUMP_LINE_SIZE;
+
+    /* One packet per (TELEMETRY_MAX_PAYLOAD - 4) bytes, each with the address,
+     * header, CRC, COBS code byte and two delimiters */
+    packets = (TELEMETRY_BENCHMARK_SIZE + (TELEMETRY_MAX_PAYLOAD - TELEMETRY_ADDRESS_SIZE) - 1UL) /
+              (TELEMETRY_MAX_PAYLOAD - TELEMETRY_ADDRESS_SIZE);
+    wireBinary = TELEMETRY_BENCHMARK_SIZE +
+                 (packets * (TELEMETRY_ADDRESS_SIZE + TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE + 3UL));
+
+    telemetry_flush();
+    start = cycle_count_now();
+    (void) uart_fmt_hexdump(payload, TELEMETRY_BENCHMARK_SIZE, (uint32_t) (uintptr_t) payload);
+    telemetry_flush();
+    cyclesText = cycle_count_elapsed(start);
+
+    start = cycle_count_now();
+    telemetry_send_buffer(payload, TELEMETRY_BENCHMARK_SIZE);
+    telemetry_flush();
+    cyclesBinary = cycle_count_elapsed(start);
+
+    (void) uart_fmt_str("\r\n");
+    dma_benchmark_csv_comment("telemetry");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("format");
+    dma_benchmark_csv_str("payload_bytes");
+    dma_benchmark_csv_str("est_wire_bytes");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_end();
+
+    dma_benchmark_csv_begin("link");
+    dma_benchmark_csv_str("text");
+    dma_benchmark_csv_u32(TELEMETRY_BENCHMARK_SIZE);
+    dma_benchmark_csv_u32(wireText);
+    dma_benchmark_csv_u32(cyclesText);
+    dma_benchmark_csv_end();
+
+    dma_benchmark_csv_begin("link");
+    dma_benchmark_csv_str("telemetry");
+    dma_benchmark_csv_u32(TELEMETRY_BENCHMARK_SIZE);
+    dma_benchmark_csv_u32(wireBinary);
+    dma_benchmark_csv_u32(cyclesBinary);
+    dma_benchmark_csv_end();
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: telemetry_crc16
+*********************************************************************************
+* Summary:
+* Updates a CRC-16/CCITT (polynomial 0x1021, no reflection) with a 16-entry
+* table, one lookup per nibble.
+*
+* Parameters:
+*  crc: CRC of the preceding data, or TELEMETRY_CRC_INIT
+*  data: Data
+*  size: Number of bytes
+*
+* Return:
+*  uint16_t: Updated CRC
+*
+********************************************************************************/
+static uint16_t telemetry_crc16(uint16_t crc, const uint8_t *data, uint32_t size)
+{
+    uint32_t value = crc;
+    uint32_t i;
+
+    for (i = 0UL; i < size; i++)
+    {
+        value = (value << 4U) ^ g_telemetryCrcTable[((value >> 12U) ^ (data[i] >> 4U)) & 0xFU];
+        value = (value << 4U) ^ g_telemetryCrcTable[((value >> 12U) ^ data[i]) & 0xFU];
+    }
+
+    return (uint16_t) value;
+}
+
+/********************************************************************************
+* Function Name: telemetry_cobs_encode
+*********************************************************************************
+* Summary:
+* Consistent overhead byte stuffing: replaces each zero byte by the distance
+* to the next one, with a code byte at least every 254 bytes.
+*
+* Parameters:
+*  dst: Destination of at least size + size / 254 + 1 bytes
+*  src: Data to encode
+*  size: Number of bytes
+*
+* Return:
+*  uint32_t: Number of bytes written
+*
+********************************************************************************/
+static uint32_t telemetry_cobs_encode(uint8_t *dst, const uint8_t *src, uint32_t size)
+{
+    uint32_t codeIndex = 0UL;
+    uint32_t length = 1UL;
+    uint8_t code = 1U;
+    uint32_t i;
+
+    for (i = 0UL; i < size; i++)
+    {
+        if (0U == src[i])
+        {
+            dst[codeIndex] = code;
+            codeIndex = length++;
+            code = 1U;
+        }
+        else
+        {
+            dst[length++] = src[i];
+            code++;
+            if ((TELEMETRY_COBS_BLOCK + 1UL) == code)
+            {
+                dst[codeIndex] = code;
+                codeIndex = length++;
+                code = 1U;
+            }
+        }
+    }
+    dst[codeIndex] = code;
+
+    return length;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,90 @@
+/******************************************************************************
+* File Name:   telemetry.h
+*
+* Description: Public interface of the binary telemetry channel.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Send frames through the DMA transmitter (uart_tx_dma.c) instead of writing
+ * them to the TX FIFO with the CPU. Check the trigger routing of the
+ * transmitter against the device before enabling. */
+#ifndef TELEMETRY_TX_DMA
+#define TELEMETRY_TX_DMA                (0u)
+#endif
+
+/* Largest payload of a packet, in bytes */
+#ifndef TELEMETRY_MAX_PAYLOAD
+#define TELEMETRY_MAX_PAYLOAD           64UL
+#endif
+
+/* Packet types. Types from TELEMETRY_TYPE_USER are free for the application. */
+#define TELEMETRY_TYPE_BUFFER           0x01U   /* u32 address, then memory contents */
+#define TELEMETRY_TYPE_COUNTERS         0x02U   /* Array of u32 counters */
+#define TELEMETRY_TYPE_USER             0x80U
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void telemetry_init(void);
+bool telemetry_send(uint8_t type, const void *payload, uint32_t size);
+void telemetry_send_buffer(const void *data, uint32_t size);
+void telemetry_flush(void);
+void telemetry_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TELEMETRY_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+################################################################################
+# \file baud_tune.py
+# \version 1.0
+#
+# \brief
+# Negotiates a higher UART baud rate with the firmware (baud_tune.c). The
+# script requests the rate, switches the port when the device answers,
+# exchanges the test pattern and confirms. If any step fails, the port is
+# returned to the old rate, as the device does after its timeout. Requires
+# pyserial.
+#
+# Usage:
+#   python3 baud_tune.py COM3 --baud 1000000 [--initial 115200]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import sys
+import time
+
+try:
+    import serial
+except ImportError:
+    sys.exit("baud_tune.py requires pyserial: pip install pyserial")
+
+# Protocol constants (baud_tune.h / baud_tune.c)
+COMMAND = b"u"
+CONFIRM = b"K"
+PATTERN_SIZE = 64
+PATTERN_STEP = 37
+PATTERN_SEED = 0x55
+
+# Device timeout for each step, in seconds. The script stays well within it.
+DEVICE_TIMEOUT = 0.5
+
+# Time for the device to switch after its answer is complete
+SWITCH_DELAY = 0.02
+
+# Rates tried by --ladder, highest first
+LADDER = (3000000, 2000000, 1000000, 921600, 460800, 230400)
+
+
+def pattern():
+    """Returns the test pattern."""
+    return bytes((PATTERN_SEED + i * PATTERN_STEP) & 0xFF for i in range(PATTERN_SIZE))
+
+
+def read_line(port, prefix, timeout):
+    """Returns the first line starting with prefix, or None on timeout.
+    Other output (for example benchmark CSV) is skipped."""
+    deadline = time.monotonic() + timeout
+    line = b""
+    while time.monotonic() < deadline:
+        data = port.read(1)
+        if not data:
+            continue
+        if data == b"\n":
+            text = line.strip().decode("ascii", errors="replace")
+            if text.startswith(prefix):
+                return text
+            line = b""
+        else:
+            line += data
+    return None
+
+
+def negotiate(port, baud):
+    """Negotiates one rate. Returns the rate reported by the device, or None
+    with the port back at its previous rate."""
+    previous = port.baudrate
+    port.reset_input_buffer()
+    port.write(COMMAND)
+    if read_line(port, "BAUD?", 2.0) is None:
+        print("no prompt from the device", file=sys.stderr)
+        return None
+
+    port.write(b"%d\r" % baud)
+    answer = read_line(port, "BAUD", DEVICE_TIMEOUT * 2)
+    if answer is None or answer == "BAUD ERR":
+        print("device rejected %d baud: %s" % (baud, answer), file=sys.stderr)
+        return None
+    actual = int(answer.split()[1])
+
+    time.sleep(SWITCH_DELAY)
+    port.baudrate = actual
+    port.reset_input_buffer()
+    port.write(pattern())
+    echo = port.read(PATTERN_SIZE)
+    if echo != pattern():
+        print("pattern check failed at %d baud (%d of %d bytes)"
+              % (actual, len(echo), PATTERN_SIZE), file=sys.stderr)
+        port.baudrate = previous
+        time.sleep(DEVICE_TIMEOUT)
+        return None
+
+    port.write(CONFIRM)
+    port.flush()
+    return actual
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Negotiate the UART baud rate with the device.")
+    parser.add_argument("port", help="serial port, e.g. COM3 or /dev/ttyACM0")
+    parser.add_argument("--baud", type=int, default=1000000, help="requested baud rate")
+    parser.add_argument("--initial", type=int, default=115200, help="current baud rate")
+    parser.add_argument("--ladder", action="store_true",
+                        help="try the rates of LADDER up to --baud, highest first")
+    args = parser.parse_args()
+
+    rates = [r for r in LADDER if r <= args.baud] if args.ladder else [args.baud]
+    with serial.Serial(args.port, args.initial, timeout=DEVICE_TIMEOUT) as port:
+        for rate in rates:
+            actual = negotiate(port, rate)
+            if actual is not None:
+                print("link at %d baud (requested %d)" % (actual, rate))
+                return 0
+    print("link stays at %d baud" % args.initial)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
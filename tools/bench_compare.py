@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+################################################################################
+# \file bench_compare.py
+# \version 1.0
+#
+# \brief
+# Compares two captures of the DMA benchmark CSV output and reports rows
+# whose measured cycles regressed beyond a threshold. Exits with status 1 on
+# a regression or a failed data check, so it can gate CI jobs.
+#
+# Usage:
+#   python3 bench_compare.py baseline.csv current.csv [--threshold 5]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import sys
+
+# Columns that hold measurements rather than parameters of a row
+METRIC_COLUMNS = {"cycles", "ok", "base_cycles", "isr_cycles", "slowdown_permille",
+                  "dma_bytes", "dma_bytes_per_kcycle", "samples", "min", "mean", "max", "chars",
+                  "est_wire_bytes", "compressed", "ratio_permille", "cycles_per_byte",
+                  "cycles_per_read", "cpu_cycles", "errors", "isrs_per_frame",
+                  "isr_cycles_per_frame", "frame_cycles", "cpu_permille", "frames",
+                  "active_cycles", "sleep_cycles", "wakes", "nj_per_kb", "bus_permille", "us",
+                  "state_bytes", "transfers", "merged"}
+
+# Metric columns checked for regressions
+TIME_COLUMNS = ("cycles", "mean")
+
+
+def load(path):
+    """Returns {key: row} for every benchmark row of a serial capture.
+
+    A capture may contain terminal output around the CSV. Lines starting with
+    "test," define the columns of the rows that follow; comment lines start
+    with "#".
+    """
+    rows = {}
+    columns = None
+    with open(path, encoding="ascii", errors="replace") as capture:
+        for line in capture:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split(",")
+            if fields[0] == "test":
+                columns = fields
+                continue
+            if columns is None or len(fields) != len(columns):
+                continue
+            row = dict(zip(columns, fields))
+            key = tuple((name, row[name]) for name in columns if name not in METRIC_COLUMNS)
+            rows[key] = row
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two DMA benchmark CSV captures.")
+    parser.add_argument("baseline", help="CSV capture of the reference run")
+    parser.add_argument("current", help="CSV capture of the run under test")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed slowdown in percent (default: 5)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    failures = 0
+
+    for key, row in sorted(current.items()):
+        name = " ".join("%s=%s" % item for item in key)
+        if row.get("ok", "1") != "1":
+            print("FAIL  %s: data mismatch" % name)
+            failures += 1
+            continue
+        if key not in baseline:
+            continue
+        for column in TIME_COLUMNS:
+            if column not in row:
+                continue
+            old = int(baseline[key][column])
+            new = int(row[column])
+            if old > 0 and new > old * (1.0 + args.threshold / 100.0):
+                print("SLOW  %s: %s %d -> %d (+%.1f%%)" % (name, column, old, new, 100.0 * (new - old) / old))
+                failures += 1
+
+    missing = len(set(baseline) - set(current))
+    print("%d rows compared, %d failures, %d baseline rows missing" % (len(current), failures, missing))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+################################################################################
+# \file dump_decompress.py
+# \version 1.0
+#
+# \brief
+# Extracts and decompresses the memory dumps written by dump_compress_uart()
+# from a raw serial capture. Each dump is a 12-byte header ("DZ", version,
+# mode, address, size) followed by the run-length encoded, optionally
+# delta-encoded, bytes. Text output around dumps is skipped.
+#
+# Usage:
+#   python3 dump_decompress.py capture.bin [--out PREFIX] [--hex]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import struct
+import sys
+
+# Dump header (dump_compress.c)
+MAGIC = b"DZ"
+VERSION = 1
+HEADER = struct.Struct("<2sBBII")
+MODE_RLE = 0
+MODE_DELTA = 1
+
+# Encoding (dump_compress.h)
+RUN_FLAG = 0x80
+MIN_RUN = 3
+
+
+def decompress(data, offset, size):
+    """Decodes size bytes starting at data[offset]. Returns (bytes, end offset),
+    or (None, offset) if the stream is truncated or invalid."""
+    out = bytearray()
+    index = offset
+    while len(out) < size:
+        if index >= len(data):
+            return None, offset
+        control = data[index]
+        index += 1
+        if control & RUN_FLAG:
+            if index >= len(data):
+                return None, offset
+            out += bytes([data[index]]) * ((control & ~RUN_FLAG) + MIN_RUN)
+            index += 1
+        else:
+            count = control + 1
+            if index + count > len(data):
+                return None, offset
+            out += data[index:index + count]
+            index += count
+    if len(out) != size:
+        return None, offset
+    return bytes(out), index
+
+
+def undelta(data):
+    """Reverses the delta encoding."""
+    out = bytearray(len(data))
+    previous = 0
+    for i, value in enumerate(data):
+        previous = (previous + value) & 0xFF
+        out[i] = previous
+    return bytes(out)
+
+
+def dumps(capture):
+    """Yields (address, mode, compressed size, data) for each dump."""
+    index = capture.find(MAGIC)
+    while 0 <= index and index + HEADER.size <= len(capture):
+        magic, version, mode, address, size = HEADER.unpack_from(capture, index)
+        if version == VERSION and mode in (MODE_RLE, MODE_DELTA):
+            data, end = decompress(capture, index + HEADER.size, size)
+            if data is not None:
+                if mode == MODE_DELTA:
+                    data = undelta(data)
+                yield address, mode, end - index - HEADER.size, data
+                index = capture.find(MAGIC, end)
+                continue
+        index = capture.find(MAGIC, index + 1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decompress memory dumps from a raw serial capture.")
+    parser.add_argument("capture", help="raw capture of the UART output")
+    parser.add_argument("--out", metavar="PREFIX",
+                        help="write each dump to PREFIX_<address>.bin")
+    parser.add_argument("--hex", action="store_true", help="print the contents as hex")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as capture:
+        data = capture.read()
+
+    count = 0
+    for address, mode, compressed, contents in dumps(data):
+        count += 1
+        ratio = compressed / len(contents) if contents else 0.0
+        print("0x%08X %6d bytes %6d compressed (%.3f) %s" %
+              (address, len(contents), compressed, ratio, "delta" if mode == MODE_DELTA else "rle"))
+        if args.hex:
+            for offset in range(0, len(contents), 16):
+                print("  0x%08X: %s" % (address + offset, contents[offset:offset + 16].hex(" ")))
+        if args.out:
+            with open("%s_%08X.bin" % (args.out, address), "wb") as out:
+                out.write(contents)
+
+    print("%d dumps" % count, file=sys.stderr)
+    return 0 if count else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+################################################################################
+# \file footprint.py
+# \version 1.0
+#
+# \brief
+# Reports the flash and RAM footprint of object files from the GNU linker
+# map file of a build. Only sections kept in the image are counted, so
+# functions removed by --gc-sections do not contribute.
+#
+# Usage:
+#   python3 footprint.py build/<TARGET>/<CONFIG>/<APP>.map [uart_fmt ...]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import os
+import re
+import sys
+
+# Start of the placed sections in a GNU ld map file
+MAP_START = "Linker script and memory map"
+
+# Input section with its address, size and object on one line, or with the
+# address, size and object on the following line when the name is long
+SECTION_LINE = re.compile(r"^ (\.\S+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)$")
+SECTION_NAME = re.compile(r"^ (\.\S+|COMMON)$")
+SECTION_CONT = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)$")
+
+# Section name prefixes by region. Initialized data occupies both.
+TEXT_PREFIXES = (".text", ".rodata", ".ramfunc")
+DATA_PREFIXES = (".data",)
+BSS_PREFIXES = (".bss", "COMMON", ".noinit")
+
+
+def object_name(path):
+    """Returns the object name without directory, archive member brackets and
+    extension, e.g. "uart_fmt" for "./build/.../uart_fmt.o"."""
+    member = re.search(r"\(([^)]+)\)$", path)
+    name = member.group(1) if member else os.path.basename(path)
+    return os.path.splitext(name)[0]
+
+
+def load(path):
+    """Returns {object: [text, data, bss]} in bytes for the placed sections."""
+    sizes = {}
+    placed = False
+    pending = None
+    with open(path, encoding="ascii", errors="replace") as mapfile:
+        for line in mapfile:
+            line = line.rstrip("\n")
+            if not placed:
+                placed = line.startswith(MAP_START)
+                continue
+
+            match = SECTION_LINE.match(line)
+            if match:
+                section, size, obj = match.group(1), int(match.group(3), 16), match.group(4)
+            elif pending is not None and SECTION_CONT.match(line):
+                match = SECTION_CONT.match(line)
+                section, size, obj = pending, int(match.group(2), 16), match.group(3)
+            else:
+                match = SECTION_NAME.match(line)
+                pending = match.group(1) if match else None
+                continue
+            pending = None
+
+            if size == 0:
+                continue
+            entry = sizes.setdefault(object_name(obj), [0, 0, 0])
+            if section.startswith(TEXT_PREFIXES):
+                entry[0] += size
+            elif section.startswith(DATA_PREFIXES):
+                entry[1] += size
+            elif section.startswith(BSS_PREFIXES):
+                entry[2] += size
+    return sizes
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Report the flash and RAM footprint of objects from a linker map file.")
+    parser.add_argument("map", help="GNU linker map file")
+    parser.add_argument("objects", nargs="*",
+                        help="object names to report (default: all)")
+    args = parser.parse_args()
+
+    sizes = load(args.map)
+    names = args.objects if args.objects else sorted(sizes, key=lambda n: -sum(sizes[n]))
+
+    print("object,text,data,bss,flash,ram")
+    total = [0, 0, 0]
+    for name in names:
+        text, data, bss = sizes.get(name, [0, 0, 0])
+        if name not in sizes:
+            print("warning: no placed sections for %s" % name, file=sys.stderr)
+        print("%s,%d,%d,%d,%d,%d" % (name, text, data, bss, text + data, data + bss))
+        total = [total[0] + text, total[1] + data, total[2] + bss]
+    print("total,%d,%d,%d,%d,%d" % (total[0], total[1], total[2],
+                                    total[0] + total[1], total[1] + total[2]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
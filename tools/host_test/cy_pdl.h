@@ -0,0 +1,229 @@
+/* Host model of the PDL subset used by the DMA helpers. The declarations
+ * follow the PSoC 4 PDL; host_model.c implements them on a model of the
+ * DMAC, two SCB blocks, SysTick and the interrupt mask. Only the host tests
+ * in tools/host_test include it. */
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Compiler and assertion macros */
+#define __STATIC_INLINE                 static inline
+#define __STATIC_FORCEINLINE            static inline
+#define CY_ALIGN(align)                 __attribute__((aligned(align)))
+#define CY_UNUSED_PARAMETER(x)          ((void) (x))
+#define CY_SECTION_RAMFUNC_BEGIN
+#define CY_SECTION_RAMFUNC_END
+#define CY_NOINIT
+#define CY_RSLT_SUCCESS                 0UL
+#define CY_ASSERT(x)                    do { if (!(x)) { model_assert(#x, __FILE__, __LINE__); } } while (0)
+
+typedef uint32_t cy_rslt_t;
+typedef char char_t;
+
+void model_assert(const char *condition, const char *file, int line);
+
+/* Memory map. Flash is an array of the model filled with a pseudo-random
+ * image; CY_SRAM_SIZE selects the benchmark buffer size of dma_benchmark.h. */
+extern uint8_t g_modelFlash[];
+#define CY_FLASH_BASE                   ((uintptr_t) g_modelFlash)
+#define CY_FLASH_SIZE                   0x4000UL
+#ifndef CY_SRAM_SIZE
+#define CY_SRAM_SIZE                    0x4000UL
+#endif
+
+/* Core: interrupt mask, SysTick and the pending bit of its interrupt */
+typedef struct { volatile uint32_t ICSR; } SCB_Type;
+typedef struct { volatile uint32_t CTRL; volatile uint32_t LOAD; volatile uint32_t VAL; } SysTick_Type;
+extern SCB_Type *SCB;
+extern SysTick_Type *SysTick;
+#define SCB_ICSR_PENDSTSET_Msk          (1UL << 26)
+
+extern uint32_t SystemCoreClock;
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+void __enable_irq(void);
+void __WFI(void);
+static inline void __NOP(void) {}
+static inline void __DSB(void) {}
+static inline void __ISB(void) {}
+static inline uint32_t __REV(uint32_t value) { return __builtin_bswap32(value); }
+static inline uint32_t __REV16(uint32_t value) { return ((value & 0xFF00FF00UL) >> 8U) | ((value & 0x00FF00FFUL) << 8U); }
+
+typedef enum
+{
+    SysTick_IRQn = -1,
+    cpuss_interrupt_dma_IRQn = 5,
+    scb_0_interrupt_IRQn = 6,
+    scb_1_interrupt_IRQn = 7
+} IRQn_Type;
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+/* SysInt */
+typedef void (*cy_israddress)(void);
+typedef struct { IRQn_Type intrSrc; uint32_t intrPriority; } cy_stc_sysint_t;
+typedef enum { CY_SYSINT_SUCCESS = 0, CY_SYSINT_BAD_PARAM } cy_en_sysint_status_t;
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr);
+
+/* SysTick */
+typedef enum { CY_SYSTICK_CLOCK_SOURCE_CLK_LF, CY_SYSTICK_CLOCK_SOURCE_CLK_CPU } cy_en_systick_clock_source_t;
+typedef void (*Cy_SysTick_Callback)(void);
+void Cy_SysTick_Init(cy_en_systick_clock_source_t clockSource, uint32_t interval);
+Cy_SysTick_Callback Cy_SysTick_SetCallback(uint32_t number, Cy_SysTick_Callback function);
+uint32_t Cy_SysTick_GetValue(void);
+
+/* SysLib and SysPm */
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+typedef enum { CY_SYSPM_SUCCESS = 0, CY_SYSPM_FAIL } cy_en_syspm_status_t;
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(void);
+
+/* DMAC */
+#define CPUSS_DMAC_CH_NR                8UL
+
+typedef struct { uint32_t reserved; } DMAC_Type;
+extern DMAC_Type *DMAC;
+
+typedef enum { CY_DMAC_DESCRIPTOR_PING = 0, CY_DMAC_DESCRIPTOR_PONG = 1 } cy_en_dmac_descriptor_t;
+typedef enum { CY_DMAC_SUCCESS = 0, CY_DMAC_BAD_PARAM } cy_en_dmac_status_t;
+typedef enum
+{
+    CY_DMAC_DONE = 1, CY_DMAC_SRC_BUS_ERROR, CY_DMAC_DST_BUS_ERROR,
+    CY_DMAC_SRC_MISAL, CY_DMAC_DST_MISAL, CY_DMAC_INVALID_DESCR
+} cy_en_dmac_response_t;
+typedef enum
+{
+    CY_DMAC_BYTE_BYTE, CY_DMAC_BYTE_HALFWORD, CY_DMAC_BYTE_WORD,
+    CY_DMAC_HALFWORD_BYTE, CY_DMAC_HALFWORD_HALFWORD, CY_DMAC_HALFWORD_WORD,
+    CY_DMAC_WORD_BYTE, CY_DMAC_WORD_HALFWORD, CY_DMAC_WORD_WORD
+} cy_en_dmac_data_transfer_width_t;
+typedef enum { CY_DMAC_SINGLE_ELEMENT, CY_DMAC_SINGLE_DESCR, CY_DMAC_DESCR_LIST } cy_en_dmac_trigger_type_t;
+typedef enum { CY_DMAC_RETRIG_IM, CY_DMAC_RETRIG_4CYC, CY_DMAC_RETRIG_16CYC, CY_DMAC_WAIT_FOR_REACT } cy_en_dmac_retrigger_t;
+
+typedef struct
+{
+    cy_en_dmac_retrigger_t retrigger;
+    bool interrupt;
+    cy_en_dmac_trigger_type_t triggerType;
+    bool preemptable;
+    bool flipping;
+    bool cpltState;                     /* Descriptor stays valid after completion */
+    cy_en_dmac_data_transfer_width_t dataTransferWidth;
+    uint32_t dataCount;
+    bool srcAddrIncrement;
+    bool dstAddrIncrement;
+} cy_stc_dmac_descriptor_config_t;
+
+typedef struct
+{
+    cy_en_dmac_descriptor_t descriptor;
+    uint32_t priority;
+    bool enable;
+} cy_stc_dmac_channel_config_t;
+
+cy_en_dmac_status_t Cy_DMAC_Descriptor_Init(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                            const cy_stc_dmac_descriptor_config_t *config);
+void Cy_DMAC_Descriptor_DeInit(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor);
+void Cy_DMAC_Descriptor_SetSrcAddress(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                      void const *srcAddress);
+void Cy_DMAC_Descriptor_SetDstAddress(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                      void const *dstAddress);
+void Cy_DMAC_Descriptor_SetDataCount(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                     uint32_t dataCount);
+cy_en_dmac_response_t Cy_DMAC_Descriptor_GetResponse(DMAC_Type const *base, uint32_t channel,
+                                                     cy_en_dmac_descriptor_t descriptor);
+cy_en_dmac_status_t Cy_DMAC_Channel_Init(DMAC_Type *base, uint32_t channel, cy_stc_dmac_channel_config_t const *config);
+void Cy_DMAC_Channel_DeInit(DMAC_Type *base, uint32_t channel);
+void Cy_DMAC_Channel_Enable(DMAC_Type *base, uint32_t channel);
+void Cy_DMAC_Channel_Disable(DMAC_Type *base, uint32_t channel);
+void Cy_DMAC_Channel_SetPriority(DMAC_Type *base, uint32_t channel, uint32_t priority);
+void Cy_DMAC_Channel_SetCurrentDescriptor(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor);
+cy_en_dmac_descriptor_t Cy_DMAC_Channel_GetCurrentDescriptor(DMAC_Type const *base, uint32_t channel);
+uint32_t Cy_DMAC_Channel_GetCurrentIndex(DMAC_Type const *base, uint32_t channel);
+void Cy_DMAC_Enable(DMAC_Type *base);
+void Cy_DMAC_Disable(DMAC_Type *base);
+uint32_t Cy_DMAC_GetInterruptStatus(DMAC_Type const *base);
+uint32_t Cy_DMAC_GetInterruptStatusMasked(DMAC_Type const *base);
+void Cy_DMAC_ClearInterrupt(DMAC_Type *base, uint32_t interrupt);
+void Cy_DMAC_SetInterrupt(DMAC_Type *base, uint32_t interrupt);
+uint32_t Cy_DMAC_GetInterruptMask(DMAC_Type const *base);
+void Cy_DMAC_SetInterruptMask(DMAC_Type *base, uint32_t interrupt);
+
+/* Trigger multiplexer. The output lines select a DMAC channel by their low
+ * byte; the inputs are the SCB FIFO requests. */
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN0     0x40000000UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN1     0x40000001UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN2     0x40000002UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN3     0x40000003UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN4     0x40000004UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN5     0x40000005UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN6     0x40000006UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN7     0x40000007UL
+#define TRIG0_IN_SCB0_TR_TX_REQ         0x00000001UL
+#define TRIG0_IN_SCB0_TR_RX_REQ         0x00000002UL
+#define TRIG0_IN_SCB1_TR_TX_REQ         0x00000003UL
+#define TRIG0_IN_SCB1_TR_RX_REQ         0x00000004UL
+
+typedef enum { CY_TRIGMUX_SUCCESS = 0, CY_TRIGMUX_BAD_PARAM } cy_en_trigmux_status_t;
+cy_en_trigmux_status_t Cy_TrigMux_Connect(uint32_t inTrig, uint32_t outTrig);
+cy_en_trigmux_status_t Cy_TrigMux_SwTrigger(uint32_t trigLine, uint32_t cycles);
+
+/* SCB. The FIFO registers are fields of the block; the model watches DMA
+ * reads of RX_FIFO_RD and writes of TX_FIFO_WR, and reads the trigger levels
+ * from the control registers. */
+typedef struct
+{
+    volatile uint32_t TX_FIFO_CTRL;
+    volatile uint32_t TX_FIFO_WR;
+    volatile uint32_t RX_FIFO_CTRL;
+    volatile uint32_t RX_FIFO_RD;
+} CySCB_Type;
+
+#define SCB_TX_FIFO_CTRL(base)          (((CySCB_Type *) (base))->TX_FIFO_CTRL)
+#define SCB_TX_FIFO_WR(base)            (((CySCB_Type *) (base))->TX_FIFO_WR)
+#define SCB_RX_FIFO_CTRL(base)          (((CySCB_Type *) (base))->RX_FIFO_CTRL)
+#define SCB_RX_FIFO_RD(base)            (((CySCB_Type *) (base))->RX_FIFO_RD)
+
+#define CY_SCB_UART_RX_TRIGGER          (1UL << 0)
+#define CY_SCB_UART_RX_NOT_EMPTY        (1UL << 2)
+#define CY_SCB_UART_RX_OVERFLOW         (1UL << 5)
+#define CY_SCB_UART_RX_NO_DATA          0xFFFFFFFFUL
+
+typedef enum
+{
+    CY_SCB_SPI_SLAVE_SELECT0, CY_SCB_SPI_SLAVE_SELECT1,
+    CY_SCB_SPI_SLAVE_SELECT2, CY_SCB_SPI_SLAVE_SELECT3
+} cy_en_scb_spi_slave_select_t;
+
+void Cy_SCB_SetTxFifoLevel(CySCB_Type *base, uint32_t level);
+void Cy_SCB_SetRxFifoLevel(CySCB_Type *base, uint32_t level);
+uint32_t Cy_SCB_GetRxInterruptStatus(CySCB_Type const *base);
+void Cy_SCB_ClearRxInterrupt(CySCB_Type *base, uint32_t interruptMask);
+uint32_t Cy_SCB_UART_Put(CySCB_Type *base, uint32_t data);
+uint32_t Cy_SCB_UART_PutArray(CySCB_Type *base, void *buffer, uint32_t size);
+void Cy_SCB_UART_PutArrayBlocking(CySCB_Type *base, void *buffer, uint32_t size);
+void Cy_SCB_UART_PutString(CySCB_Type *base, char_t const *string);
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_GetNumInTxFifo(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_GetNumInRxFifo(CySCB_Type const *base);
+bool Cy_SCB_UART_IsTxComplete(CySCB_Type const *base);
+void Cy_SCB_SPI_SetActiveSlaveSelect(CySCB_Type *base, cy_en_scb_spi_slave_select_t slaveSelect);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_PDL_H */
@@ -0,0 +1,32 @@
+/* Host model of the design aliases. SCB1 is the UART of the kit and SCB0 is
+ * free for SPI; the USER_DMA descriptors flip and are invalidated on
+ * completion, as in the Device Configurator design. */
+#ifndef CYBSP_H
+#define CYBSP_H
+
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+extern CySCB_Type g_modelScb[2];
+#define SCB0                            (&g_modelScb[0])
+#define SCB1                            (&g_modelScb[1])
+
+#define UART_HW                         SCB1
+#define UART_IRQ                        scb_1_interrupt_IRQn
+
+#define USER_DMA_HW                     DMAC
+#define USER_DMA_CHANNEL                0UL
+extern const cy_stc_dmac_channel_config_t USER_DMA_channel_config;
+extern const cy_stc_dmac_descriptor_config_t USER_DMA_ping_config;
+extern const cy_stc_dmac_descriptor_config_t USER_DMA_pong_config;
+
+cy_rslt_t cybsp_init(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CYBSP_H */
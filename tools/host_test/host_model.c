@@ -0,0 +1,1146 @@
+/* Host model of the PDL subset declared in cy_pdl.h. See host_model.h. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_model.h"
+
+/* Cycles charged to each PDL call, and per DMA element */
+#define MODEL_CALL_CYCLES               4UL
+#define MODEL_ELEMENT_CYCLES            4UL
+
+/* Longest sleep without a wake-up source before the model gives up */
+#define MODEL_SLEEP_LIMIT               (1ULL << 32)
+
+/* Number of SysTick callback slots */
+#define MODEL_SYSTICK_CALLBACKS         5UL
+
+/* Descriptor response before the descriptor finishes */
+#define MODEL_RESPONSE_PENDING          ((cy_en_dmac_response_t) 0)
+
+/* Number of interrupt vectors of the model, indexed by IRQn + 1 */
+#define MODEL_VECTORS                   9UL
+
+typedef struct
+{
+    cy_stc_dmac_descriptor_config_t config;
+    uintptr_t src;
+    uintptr_t dst;
+    uint32_t index;
+    cy_en_dmac_response_t response;
+    bool valid;
+} model_descr_t;
+
+typedef struct
+{
+    model_descr_t descr[2];
+    uint32_t current;
+    uint32_t priority;
+    bool enabled;
+    bool active;                        /* Working on a trigger */
+    bool swTrigger;                     /* Software trigger not yet taken */
+    uint32_t inTrig;                    /* Routed trigger multiplexer input, 0 if none */
+} model_channel_t;
+
+typedef struct
+{
+    uint8_t fifo[MODEL_SCB_FIFO_DEPTH];
+    uint32_t head;
+    uint32_t count;
+} model_fifo_t;
+
+typedef struct
+{
+    model_fifo_t tx;
+    model_fifo_t rx;
+    uint32_t rxIntr;
+    uint32_t charCycles;
+    bool txStall;
+    bool loopback;
+    bool shifting;
+    uint8_t shiftData;
+    uint64_t shiftEnd;
+    const uint8_t *feed;
+    uint32_t feedSize;
+    uint32_t feedPos;
+    uint64_t feedNext;
+    uint8_t capture[MODEL_SCB_CAPTURE_SIZE];
+    uint32_t captured;
+    uint32_t txOverflows;
+    cy_en_scb_spi_slave_select_t slaveSelect;
+} model_scb_t;
+
+/* Register blocks seen by the firmware */
+CySCB_Type g_modelScb[2];
+static SCB_Type g_modelCoreScb;
+static SysTick_Type g_modelSysTick;
+static DMAC_Type g_modelDmac;
+SCB_Type *SCB = &g_modelCoreScb;
+SysTick_Type *SysTick = &g_modelSysTick;
+DMAC_Type *DMAC = &g_modelDmac;
+uint32_t SystemCoreClock = MODEL_CORE_CLOCK_HZ;
+uint8_t g_modelFlash[CY_FLASH_SIZE];
+
+/* USER_DMA design of the Device Configurator */
+const cy_stc_dmac_channel_config_t USER_DMA_channel_config =
+{
+    .descriptor = CY_DMAC_DESCRIPTOR_PING,
+    .priority   = 3UL,
+    .enable     = false
+};
+
+const cy_stc_dmac_descriptor_config_t USER_DMA_ping_config =
+{
+    .retrigger         = CY_DMAC_RETRIG_4CYC,
+    .interrupt         = false,
+    .triggerType       = CY_DMAC_DESCR_LIST,
+    .preemptable       = true,
+    .flipping          = true,
+    .cpltState         = false,
+    .dataTransferWidth = CY_DMAC_WORD_WORD,
+    .dataCount         = 1UL,
+    .srcAddrIncrement  = true,
+    .dstAddrIncrement  = true
+};
+
+const cy_stc_dmac_descriptor_config_t USER_DMA_pong_config =
+{
+    .retrigger         = CY_DMAC_RETRIG_4CYC,
+    .interrupt         = true,
+    .triggerType       = CY_DMAC_SINGLE_DESCR,
+    .preemptable       = true,
+    .flipping          = true,
+    .cpltState         = false,
+    .dataTransferWidth = CY_DMAC_WORD_WORD,
+    .dataCount         = 1UL,
+    .srcAddrIncrement  = true,
+    .dstAddrIncrement  = true
+};
+
+static uint64_t g_modelNow;
+static uint32_t g_modelPrimask;
+static bool g_modelInIsr;
+static cy_israddress g_modelVectors[MODEL_VECTORS];
+static bool g_modelIrqEnabled[MODEL_VECTORS];
+static uint64_t g_modelSysTickStart;
+static uint64_t g_modelSysTickWraps;
+static Cy_SysTick_Callback g_modelSysTickCallbacks[MODEL_SYSTICK_CALLBACKS];
+static model_hook_t g_modelSleepHook;
+static uint32_t g_modelSleeps;
+
+static model_channel_t g_modelChannels[CPUSS_DMAC_CH_NR];
+static bool g_modelDmacEnabled;
+static bool g_modelDmacHold;
+static uint32_t g_modelDmacIntr;
+static uint32_t g_modelDmacMask;
+
+static model_scb_t g_modelScbState[2];
+
+static uint32_t g_modelFailures;
+static uint32_t g_modelAsserts;
+
+static void model_step(uint32_t cycles);
+
+/*******************************************************************************
+* Interrupts and time
+********************************************************************************/
+
+void model_assert(const char *condition, const char *file, int line)
+{
+    printf("ASSERT %s at %s:%d\n", condition, file, line);
+    g_modelAsserts++;
+}
+
+static void model_fatal(const char *reason)
+{
+    printf("FATAL %s at cycle %llu\n", reason, (unsigned long long) g_modelNow);
+    exit(2);
+}
+
+static bool model_systick_running(void)
+{
+    return (0UL != (SysTick->CTRL & 1UL));
+}
+
+static bool model_dmac_irq_pending(void)
+{
+    return g_modelIrqEnabled[cpuss_interrupt_dma_IRQn + 1] && (0UL != (g_modelDmacIntr & g_modelDmacMask));
+}
+
+static bool model_systick_irq_pending(void)
+{
+    return (0UL != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk));
+}
+
+static bool model_irq_pending(void)
+{
+    return model_dmac_irq_pending() || model_systick_irq_pending();
+}
+
+static void model_deliver(void)
+{
+    uint32_t i;
+
+    if ((0UL != g_modelPrimask) || g_modelInIsr)
+    {
+        return;
+    }
+
+    g_modelInIsr = true;
+    while (model_irq_pending())
+    {
+        if (model_systick_irq_pending())
+        {
+            SCB->ICSR &= ~SCB_ICSR_PENDSTSET_Msk;
+            for (i = 0UL; i < MODEL_SYSTICK_CALLBACKS; i++)
+            {
+                if (NULL != g_modelSysTickCallbacks[i])
+                {
+                    g_modelSysTickCallbacks[i]();
+                }
+            }
+        }
+        if (model_dmac_irq_pending())
+        {
+            if (NULL == g_modelVectors[cpuss_interrupt_dma_IRQn + 1])
+            {
+                model_fatal("DMAC interrupt without a handler");
+            }
+            g_modelVectors[cpuss_interrupt_dma_IRQn + 1]();
+        }
+    }
+    g_modelInIsr = false;
+}
+
+/*******************************************************************************
+* SCB
+********************************************************************************/
+
+static model_scb_t *model_scb(CySCB_Type const *base)
+{
+    return &g_modelScbState[(base == &g_modelScb[1]) ? 1 : 0];
+}
+
+static bool model_fifo_push(model_fifo_t *fifo, uint8_t data)
+{
+    if (fifo->count >= MODEL_SCB_FIFO_DEPTH)
+    {
+        return false;
+    }
+    fifo->fifo[(fifo->head + fifo->count) % MODEL_SCB_FIFO_DEPTH] = data;
+    fifo->count++;
+    return true;
+}
+
+static uint32_t model_fifo_pop(model_fifo_t *fifo)
+{
+    uint32_t data = CY_SCB_UART_RX_NO_DATA;
+
+    if (0UL != fifo->count)
+    {
+        data = fifo->fifo[fifo->head];
+        fifo->head = (fifo->head + 1UL) % MODEL_SCB_FIFO_DEPTH;
+        fifo->count--;
+    }
+    return data;
+}
+
+static void model_scb_receive(model_scb_t *scb, uint8_t data)
+{
+    if (!model_fifo_push(&scb->rx, data))
+    {
+        scb->rxIntr |= CY_SCB_UART_RX_OVERFLOW;
+    }
+}
+
+/* Runs the shifter and the receive feed of one SCB up to the current cycle */
+static void model_scb_run(model_scb_t *scb)
+{
+    bool progress = true;
+
+    while (progress)
+    {
+        progress = false;
+        if (scb->shifting && (scb->shiftEnd <= g_modelNow))
+        {
+            scb->shifting = false;
+            if (scb->captured < MODEL_SCB_CAPTURE_SIZE)
+            {
+                scb->capture[scb->captured++] = scb->shiftData;
+            }
+            if (scb->loopback)
+            {
+                model_scb_receive(scb, scb->shiftData);
+            }
+            progress = true;
+        }
+        if (!scb->shifting && !scb->txStall && (0UL != scb->tx.count))
+        {
+            scb->shiftData = (uint8_t) model_fifo_pop(&scb->tx);
+            scb->shiftEnd = g_modelNow + scb->charCycles;
+            scb->shifting = true;
+            progress = true;
+        }
+        if ((NULL != scb->feed) && (scb->feedNext <= g_modelNow))
+        {
+            model_scb_receive(scb, scb->feed[scb->feedPos++]);
+            scb->feedNext += scb->charCycles;
+            if (scb->feedPos == scb->feedSize)
+            {
+                scb->feed = NULL;
+            }
+            progress = true;
+        }
+    }
+}
+
+static uint64_t model_scb_next_event(model_scb_t const *scb)
+{
+    uint64_t next = UINT64_MAX;
+
+    if (scb->shifting)
+    {
+        next = scb->shiftEnd;
+    }
+    if ((NULL != scb->feed) && (scb->feedNext < next))
+    {
+        next = scb->feedNext;
+    }
+    return next;
+}
+
+/* Trigger level of a routed SCB FIFO request */
+static bool model_scb_request(uint32_t inTrig)
+{
+    uint32_t index = (inTrig - TRIG0_IN_SCB0_TR_TX_REQ) / 2UL;
+    bool rxRequest = (1UL == ((inTrig - TRIG0_IN_SCB0_TR_TX_REQ) % 2UL));
+    model_scb_t const *scb;
+
+    if ((inTrig < TRIG0_IN_SCB0_TR_TX_REQ) || (index > 1UL))
+    {
+        return false;
+    }
+    scb = &g_modelScbState[index];
+    if (!rxRequest)
+    {
+        return (scb->tx.count < (g_modelScb[index].TX_FIFO_CTRL & 0xFFUL));
+    }
+    return (scb->rx.count > (g_modelScb[index].RX_FIFO_CTRL & 0xFFUL));
+}
+
+/*******************************************************************************
+* DMAC
+********************************************************************************/
+
+static uint32_t model_width_src(cy_en_dmac_data_transfer_width_t width)
+{
+    static const uint32_t sizes[] = { 1, 1, 1, 2, 2, 2, 4, 4, 4 };
+    return sizes[width];
+}
+
+static uint32_t model_width_dst(cy_en_dmac_data_transfer_width_t width)
+{
+    static const uint32_t sizes[] = { 1, 2, 4, 1, 2, 4, 1, 2, 4 };
+    return sizes[width];
+}
+
+static uint32_t model_bus_read(uintptr_t address, uint32_t size)
+{
+    uint32_t value = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < 2UL; i++)
+    {
+        if (address == (uintptr_t) &g_modelScb[i].RX_FIFO_RD)
+        {
+            return model_fifo_pop(&g_modelScbState[i].rx);
+        }
+    }
+    (void) memcpy(&value, (const void *) address, size);
+    return value;
+}
+
+static void model_bus_write(uintptr_t address, uint32_t value, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < 2UL; i++)
+    {
+        if (address == (uintptr_t) &g_modelScb[i].TX_FIFO_WR)
+        {
+            if (!model_fifo_push(&g_modelScbState[i].tx, (uint8_t) value))
+            {
+                g_modelScbState[i].txOverflows++;
+            }
+            return;
+        }
+    }
+    (void) memcpy((void *) address, &value, size);
+}
+
+static bool model_channel_triggered(model_channel_t const *ch)
+{
+    return ch->swTrigger || ((0UL != ch->inTrig) && model_scb_request(ch->inTrig));
+}
+
+static bool model_channel_ready(model_channel_t const *ch)
+{
+    return g_modelDmacEnabled && !g_modelDmacHold && ch->enabled && (ch->active || model_channel_triggered(ch));
+}
+
+static void model_channel_error(model_channel_t *ch, uint32_t channel, cy_en_dmac_response_t response)
+{
+    ch->descr[ch->current].response = response;
+    ch->enabled = false;
+    ch->active = false;
+    ch->swTrigger = false;
+    g_modelDmacIntr |= (1UL << channel);
+}
+
+/* Moves one element of a channel that is ready */
+static void model_channel_element(model_channel_t *ch, uint32_t channel)
+{
+    model_descr_t *d = &ch->descr[ch->current];
+    uint32_t srcSize;
+    uint32_t dstSize;
+    uint32_t value;
+
+    if (!ch->active)
+    {
+        ch->active = true;
+        ch->swTrigger = false;
+    }
+
+    if (!d->valid)
+    {
+        model_channel_error(ch, channel, CY_DMAC_INVALID_DESCR);
+        return;
+    }
+
+    srcSize = model_width_src(d->config.dataTransferWidth);
+    dstSize = model_width_dst(d->config.dataTransferWidth);
+    if (0UL == d->index)
+    {
+        d->response = MODEL_RESPONSE_PENDING;
+        if (0UL != (d->src % srcSize))
+        {
+            model_channel_error(ch, channel, CY_DMAC_SRC_MISAL);
+            return;
+        }
+        if (0UL != (d->dst % dstSize))
+        {
+            model_channel_error(ch, channel, CY_DMAC_DST_MISAL);
+            return;
+        }
+    }
+
+    value = model_bus_read(d->src + (d->config.srcAddrIncrement ? (d->index * srcSize) : 0UL), srcSize);
+    if (dstSize < 4UL)
+    {
+        value &= (1UL << (8UL * dstSize)) - 1UL;
+    }
+    model_bus_write(d->dst + (d->config.dstAddrIncrement ? (d->index * dstSize) : 0UL), value, dstSize);
+    d->index++;
+
+    if (d->index >= d->config.dataCount)
+    {
+        d->index = 0UL;
+        d->response = CY_DMAC_DONE;
+        if (!d->config.cpltState)
+        {
+            d->valid = false;
+        }
+        if (d->config.interrupt)
+        {
+            g_modelDmacIntr |= (1UL << channel);
+        }
+        if (d->config.flipping)
+        {
+            ch->current ^= 1UL;
+        }
+        ch->active = (CY_DMAC_DESCR_LIST == d->config.triggerType) && ch->descr[ch->current].valid;
+    }
+    else if (CY_DMAC_SINGLE_ELEMENT == d->config.triggerType)
+    {
+        ch->active = false;
+    }
+    else
+    {
+        /* The descriptor continues on the same trigger */
+    }
+}
+
+/* Returns the ready channel that wins the arbitration, or CPUSS_DMAC_CH_NR */
+static uint32_t model_dmac_winner(void)
+{
+    uint32_t winner = CPUSS_DMAC_CH_NR;
+    uint32_t i;
+
+    for (i = 0UL; i < CPUSS_DMAC_CH_NR; i++)
+    {
+        if (model_channel_ready(&g_modelChannels[i]) &&
+            ((CPUSS_DMAC_CH_NR == winner) || (g_modelChannels[i].priority < g_modelChannels[winner].priority)))
+        {
+            winner = i;
+        }
+    }
+    return winner;
+}
+
+/*******************************************************************************
+* Hardware run loop
+********************************************************************************/
+
+static void model_systick_run(void)
+{
+    uint64_t wraps;
+
+    if (model_systick_running())
+    {
+        wraps = (g_modelNow - g_modelSysTickStart) / ((uint64_t) SysTick->LOAD + 1U);
+        if (wraps != g_modelSysTickWraps)
+        {
+            g_modelSysTickWraps = wraps;
+            SCB->ICSR |= SCB_ICSR_PENDSTSET_Msk;
+        }
+    }
+}
+
+static uint64_t model_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint64_t event;
+    uint32_t i;
+
+    if (model_systick_running())
+    {
+        next = g_modelSysTickStart + ((g_modelSysTickWraps + 1U) * ((uint64_t) SysTick->LOAD + 1U));
+    }
+    for (i = 0UL; i < 2UL; i++)
+    {
+        event = model_scb_next_event(&g_modelScbState[i]);
+        if (event < next)
+        {
+            next = event;
+        }
+    }
+    return next;
+}
+
+/* Runs the hardware up to a cycle, or until an interrupt is pending when
+ * stopOnIrq is set */
+static void model_run(uint64_t target, bool stopOnIrq)
+{
+    uint32_t channel;
+    uint64_t next;
+
+    while (g_modelNow < target)
+    {
+        channel = model_dmac_winner();
+        if (CPUSS_DMAC_CH_NR != channel)
+        {
+            model_channel_element(&g_modelChannels[channel], channel);
+            g_modelNow += MODEL_ELEMENT_CYCLES;
+        }
+        else
+        {
+            next = model_next_event();
+            g_modelNow = (next < target) ? ((next > g_modelNow) ? next : (g_modelNow + 1U)) : target;
+        }
+        model_scb_run(&g_modelScbState[0]);
+        model_scb_run(&g_modelScbState[1]);
+        model_systick_run();
+
+        if (stopOnIrq && model_irq_pending())
+        {
+            break;
+        }
+    }
+}
+
+static void model_step(uint32_t cycles)
+{
+    uint64_t target = g_modelNow + cycles;
+
+    do
+    {
+        model_run(target, (0UL == g_modelPrimask) && !g_modelInIsr);
+        model_deliver();
+    } while (g_modelNow < target);
+}
+
+static void model_sleep(void)
+{
+    uint64_t limit = g_modelNow + MODEL_SLEEP_LIMIT;
+
+    g_modelSleeps++;
+
+    /* WFI with an interrupt pending does not sleep */
+    if (!model_irq_pending())
+    {
+        model_run(limit, true);
+        if (!model_irq_pending())
+        {
+            model_fatal("sleep without a wake-up source");
+        }
+    }
+    model_step(MODEL_CALL_CYCLES);
+}
+
+/*******************************************************************************
+* Test interface
+********************************************************************************/
+
+void model_reset(void)
+{
+    uint32_t i;
+
+    g_modelNow = 0U;
+    g_modelPrimask = 0UL;
+    g_modelInIsr = false;
+    (void) memset(g_modelVectors, 0, sizeof(g_modelVectors));
+    (void) memset(g_modelIrqEnabled, 0, sizeof(g_modelIrqEnabled));
+    (void) memset(&g_modelCoreScb, 0, sizeof(g_modelCoreScb));
+    (void) memset(&g_modelSysTick, 0, sizeof(g_modelSysTick));
+    g_modelSysTickStart = 0U;
+    g_modelSysTickWraps = 0U;
+    (void) memset(g_modelSysTickCallbacks, 0, sizeof(g_modelSysTickCallbacks));
+    g_modelSleepHook = NULL;
+    g_modelSleeps = 0UL;
+    (void) memset(g_modelChannels, 0, sizeof(g_modelChannels));
+    g_modelDmacEnabled = false;
+    g_modelDmacHold = false;
+    g_modelDmacIntr = 0UL;
+    g_modelDmacMask = 0UL;
+    (void) memset(g_modelScb, 0, sizeof(g_modelScb));
+    (void) memset(g_modelScbState, 0, sizeof(g_modelScbState));
+    for (i = 0UL; i < 2UL; i++)
+    {
+        g_modelScbState[i].charCycles = MODEL_CORE_CLOCK_HZ / 11520UL;
+    }
+    for (i = 0UL; i < CY_FLASH_SIZE; i++)
+    {
+        g_modelFlash[i] = (uint8_t) ((i * 2654435761UL) >> 13);
+    }
+}
+
+void model_advance(uint32_t cycles)
+{
+    model_step(cycles);
+}
+
+uint64_t model_cycles(void)
+{
+    return g_modelNow;
+}
+
+void model_set_sleep_hook(model_hook_t hook)
+{
+    g_modelSleepHook = hook;
+}
+
+uint32_t model_sleeps(void)
+{
+    return g_modelSleeps;
+}
+
+void model_dmac_hold(bool hold)
+{
+    g_modelDmacHold = hold;
+}
+
+bool model_dmac_channel_enabled(uint32_t channel)
+{
+    return g_modelChannels[channel].enabled;
+}
+
+void model_scb_char_cycles(CySCB_Type *base, uint32_t cycles)
+{
+    model_scb(base)->charCycles = cycles;
+}
+
+void model_scb_tx_stall(CySCB_Type *base, bool stall)
+{
+    model_scb(base)->txStall = stall;
+}
+
+void model_scb_loopback(CySCB_Type *base, bool loopback)
+{
+    model_scb(base)->loopback = loopback;
+}
+
+void model_scb_rx_feed(CySCB_Type *base, const uint8_t *data, uint32_t size, uint32_t delayCycles)
+{
+    model_scb_t *scb = model_scb(base);
+
+    scb->feed = (0UL != size) ? data : NULL;
+    scb->feedSize = size;
+    scb->feedPos = 0UL;
+    scb->feedNext = g_modelNow + delayCycles;
+}
+
+bool model_scb_rx_fed(CySCB_Type const *base)
+{
+    return (NULL == model_scb(base)->feed);
+}
+
+uint32_t model_scb_tx_take(CySCB_Type *base, uint8_t *data, uint32_t size)
+{
+    model_scb_t *scb = model_scb(base);
+    uint32_t count = (scb->captured < size) ? scb->captured : size;
+
+    (void) memcpy(data, scb->capture, count);
+    (void) memmove(scb->capture, &scb->capture[count], scb->captured - count);
+    scb->captured -= count;
+    return count;
+}
+
+uint32_t model_scb_tx_overflows(CySCB_Type const *base)
+{
+    return model_scb(base)->txOverflows;
+}
+
+bool model_check(bool condition, const char *name)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", name);
+    if (!condition)
+    {
+        g_modelFailures++;
+    }
+    return condition;
+}
+
+uint32_t model_take_asserts(void)
+{
+    uint32_t asserts = g_modelAsserts;
+
+    g_modelAsserts = 0UL;
+    return asserts;
+}
+
+int model_summary(void)
+{
+    g_modelFailures += g_modelAsserts;
+    printf("%lu failures\n", (unsigned long) g_modelFailures);
+    return (0UL == g_modelFailures) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Core
+********************************************************************************/
+
+uint32_t __get_PRIMASK(void)
+{
+    return g_modelPrimask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+    g_modelPrimask = priMask & 1UL;
+    model_step(1UL);
+}
+
+void __disable_irq(void)
+{
+    g_modelPrimask = 1UL;
+}
+
+void __enable_irq(void)
+{
+    g_modelPrimask = 0UL;
+    model_step(1UL);
+}
+
+void __WFI(void)
+{
+    model_sleep();
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    g_modelIrqEnabled[irq + 1] = true;
+    model_step(MODEL_CALL_CYCLES);
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+    g_modelIrqEnabled[irq + 1] = false;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    (void) irq;
+}
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr)
+{
+    g_modelVectors[config->intrSrc + 1] = userIsr;
+    return CY_SYSINT_SUCCESS;
+}
+
+void Cy_SysTick_Init(cy_en_systick_clock_source_t clockSource, uint32_t interval)
+{
+    (void) clockSource;
+    SysTick->LOAD = interval;
+    SysTick->CTRL = 7UL;
+    g_modelSysTickStart = g_modelNow;
+    g_modelSysTickWraps = 0U;
+}
+
+Cy_SysTick_Callback Cy_SysTick_SetCallback(uint32_t number, Cy_SysTick_Callback function)
+{
+    Cy_SysTick_Callback previous = g_modelSysTickCallbacks[number];
+
+    g_modelSysTickCallbacks[number] = function;
+    return previous;
+}
+
+uint32_t Cy_SysTick_GetValue(void)
+{
+    model_step(MODEL_CALL_CYCLES);
+    if (!model_systick_running())
+    {
+        return 0UL;
+    }
+    SysTick->VAL = SysTick->LOAD - (uint32_t) ((g_modelNow - g_modelSysTickStart) % ((uint64_t) SysTick->LOAD + 1U));
+    return SysTick->VAL;
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    uint32_t state = g_modelPrimask;
+
+    g_modelPrimask = 1UL;
+    return state;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    g_modelPrimask = savedIntrStatus;
+    model_step(1UL);
+}
+
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    model_step((MODEL_CORE_CLOCK_HZ / 1000000UL) * microseconds);
+}
+
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(void)
+{
+    if (NULL != g_modelSleepHook)
+    {
+        g_modelSleepHook();
+    }
+    model_sleep();
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* DMAC
+********************************************************************************/
+
+cy_en_dmac_status_t Cy_DMAC_Descriptor_Init(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                            const cy_stc_dmac_descriptor_config_t *config)
+{
+    model_descr_t *d = &g_modelChannels[channel].descr[descriptor];
+
+    (void) base;
+    if ((0UL == config->dataCount) || (config->dataCount > 65536UL))
+    {
+        return CY_DMAC_BAD_PARAM;
+    }
+    d->config = *config;
+    d->index = 0UL;
+    d->response = MODEL_RESPONSE_PENDING;
+    d->valid = true;
+    model_step(MODEL_CALL_CYCLES);
+    return CY_DMAC_SUCCESS;
+}
+
+void Cy_DMAC_Descriptor_DeInit(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    (void) base;
+    (void) memset(&g_modelChannels[channel].descr[descriptor], 0, sizeof(model_descr_t));
+    model_step(MODEL_CALL_CYCLES);
+}
+
+void Cy_DMAC_Descriptor_SetSrcAddress(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                      void const *srcAddress)
+{
+    (void) base;
+    g_modelChannels[channel].descr[descriptor].src = (uintptr_t) srcAddress;
+}
+
+void Cy_DMAC_Descriptor_SetDstAddress(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                      void const *dstAddress)
+{
+    (void) base;
+    g_modelChannels[channel].descr[descriptor].dst = (uintptr_t) dstAddress;
+}
+
+void Cy_DMAC_Descriptor_SetDataCount(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                     uint32_t dataCount)
+{
+    (void) base;
+    g_modelChannels[channel].descr[descriptor].config.dataCount = dataCount;
+}
+
+cy_en_dmac_response_t Cy_DMAC_Descriptor_GetResponse(DMAC_Type const *base, uint32_t channel,
+                                                     cy_en_dmac_descriptor_t descriptor)
+{
+    (void) base;
+    model_step(MODEL_CALL_CYCLES);
+    return g_modelChannels[channel].descr[descriptor].response;
+}
+
+cy_en_dmac_status_t Cy_DMAC_Channel_Init(DMAC_Type *base, uint32_t channel, cy_stc_dmac_channel_config_t const *config)
+{
+    model_channel_t *ch = &g_modelChannels[channel];
+
+    (void) base;
+    ch->current = (uint32_t) config->descriptor;
+    ch->priority = config->priority;
+    ch->enabled = config->enable;
+    ch->active = false;
+    ch->swTrigger = false;
+    model_step(MODEL_CALL_CYCLES);
+    return CY_DMAC_SUCCESS;
+}
+
+void Cy_DMAC_Channel_DeInit(DMAC_Type *base, uint32_t channel)
+{
+    (void) base;
+    g_modelChannels[channel].enabled = false;
+    g_modelChannels[channel].active = false;
+    g_modelChannels[channel].swTrigger = false;
+    g_modelChannels[channel].current = 0UL;
+    g_modelChannels[channel].priority = 0UL;
+}
+
+void Cy_DMAC_Channel_Enable(DMAC_Type *base, uint32_t channel)
+{
+    (void) base;
+    g_modelChannels[channel].enabled = true;
+    model_step(MODEL_CALL_CYCLES);
+}
+
+void Cy_DMAC_Channel_Disable(DMAC_Type *base, uint32_t channel)
+{
+    (void) base;
+    g_modelChannels[channel].enabled = false;
+    g_modelChannels[channel].swTrigger = false;
+    model_step(MODEL_CALL_CYCLES);
+}
+
+void Cy_DMAC_Channel_SetPriority(DMAC_Type *base, uint32_t channel, uint32_t priority)
+{
+    (void) base;
+    g_modelChannels[channel].priority = priority;
+}
+
+void Cy_DMAC_Channel_SetCurrentDescriptor(DMAC_Type *base, uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    (void) base;
+    g_modelChannels[channel].current = (uint32_t) descriptor;
+    g_modelChannels[channel].active = false;
+}
+
+cy_en_dmac_descriptor_t Cy_DMAC_Channel_GetCurrentDescriptor(DMAC_Type const *base, uint32_t channel)
+{
+    (void) base;
+    return (cy_en_dmac_descriptor_t) g_modelChannels[channel].current;
+}
+
+uint32_t Cy_DMAC_Channel_GetCurrentIndex(DMAC_Type const *base, uint32_t channel)
+{
+    model_channel_t const *ch = &g_modelChannels[channel];
+
+    (void) base;
+    model_step(MODEL_CALL_CYCLES);
+    return ch->descr[ch->current].index;
+}
+
+void Cy_DMAC_Enable(DMAC_Type *base)
+{
+    (void) base;
+    g_modelDmacEnabled = true;
+}
+
+void Cy_DMAC_Disable(DMAC_Type *base)
+{
+    (void) base;
+    g_modelDmacEnabled = false;
+}
+
+uint32_t Cy_DMAC_GetInterruptStatus(DMAC_Type const *base)
+{
+    (void) base;
+    model_step(MODEL_CALL_CYCLES);
+    return g_modelDmacIntr;
+}
+
+uint32_t Cy_DMAC_GetInterruptStatusMasked(DMAC_Type const *base)
+{
+    (void) base;
+    return g_modelDmacIntr & g_modelDmacMask;
+}
+
+void Cy_DMAC_ClearInterrupt(DMAC_Type *base, uint32_t interrupt)
+{
+    (void) base;
+    g_modelDmacIntr &= ~interrupt;
+}
+
+void Cy_DMAC_SetInterrupt(DMAC_Type *base, uint32_t interrupt)
+{
+    (void) base;
+    g_modelDmacIntr |= interrupt;
+    model_step(1UL);
+}
+
+uint32_t Cy_DMAC_GetInterruptMask(DMAC_Type const *base)
+{
+    (void) base;
+    return g_modelDmacMask;
+}
+
+void Cy_DMAC_SetInterruptMask(DMAC_Type *base, uint32_t interrupt)
+{
+    (void) base;
+    g_modelDmacMask = interrupt;
+    model_step(1UL);
+}
+
+/*******************************************************************************
+* Trigger multiplexer
+********************************************************************************/
+
+cy_en_trigmux_status_t Cy_TrigMux_Connect(uint32_t inTrig, uint32_t outTrig)
+{
+    uint32_t channel = outTrig & 0xFFUL;
+
+    if (((outTrig & ~0xFFUL) != TRIG0_OUT_CPUSS_DMAC_TR_IN0) || (channel >= CPUSS_DMAC_CH_NR))
+    {
+        return CY_TRIGMUX_BAD_PARAM;
+    }
+    g_modelChannels[channel].inTrig = inTrig;
+    return CY_TRIGMUX_SUCCESS;
+}
+
+cy_en_trigmux_status_t Cy_TrigMux_SwTrigger(uint32_t trigLine, uint32_t cycles)
+{
+    uint32_t channel = trigLine & 0xFFUL;
+
+    (void) cycles;
+    if (channel >= CPUSS_DMAC_CH_NR)
+    {
+        return CY_TRIGMUX_BAD_PARAM;
+    }
+    if (g_modelChannels[channel].enabled)
+    {
+        g_modelChannels[channel].swTrigger = true;
+    }
+    model_step(MODEL_CALL_CYCLES);
+    return CY_TRIGMUX_SUCCESS;
+}
+
+/*******************************************************************************
+* SCB
+********************************************************************************/
+
+void Cy_SCB_SetTxFifoLevel(CySCB_Type *base, uint32_t level)
+{
+    base->TX_FIFO_CTRL = level;
+}
+
+void Cy_SCB_SetRxFifoLevel(CySCB_Type *base, uint32_t level)
+{
+    base->RX_FIFO_CTRL = level;
+}
+
+uint32_t Cy_SCB_GetRxInterruptStatus(CySCB_Type const *base)
+{
+    model_step(MODEL_CALL_CYCLES);
+    return model_scb(base)->rxIntr;
+}
+
+void Cy_SCB_ClearRxInterrupt(CySCB_Type *base, uint32_t interruptMask)
+{
+    model_scb(base)->rxIntr &= ~interruptMask;
+}
+
+uint32_t Cy_SCB_UART_Put(CySCB_Type *base, uint32_t data)
+{
+    uint32_t put = model_fifo_push(&model_scb(base)->tx, (uint8_t) data) ? 1UL : 0UL;
+
+    model_step(MODEL_CALL_CYCLES);
+    return put;
+}
+
+uint32_t Cy_SCB_UART_PutArray(CySCB_Type *base, void *buffer, uint32_t size)
+{
+    const uint8_t *data = (const uint8_t *) buffer;
+    uint32_t count = 0UL;
+
+    while ((count < size) && model_fifo_push(&model_scb(base)->tx, data[count]))
+    {
+        count++;
+    }
+    model_step(MODEL_CALL_CYCLES);
+    return count;
+}
+
+/* The PDL loops without a bound; on a stalled transmitter the model stops
+ * the test instead of hanging */
+void Cy_SCB_UART_PutArrayBlocking(CySCB_Type *base, void *buffer, uint32_t size)
+{
+    const uint8_t *data = (const uint8_t *) buffer;
+    uint32_t count = 0UL;
+
+    while (count < size)
+    {
+        count += Cy_SCB_UART_PutArray(base, (void *) &data[count], size - count);
+        if ((count < size) && model_scb(base)->txStall)
+        {
+            model_fatal("blocking UART write on a stalled transmitter");
+        }
+    }
+}
+
+void Cy_SCB_UART_PutString(CySCB_Type *base, char_t const *string)
+{
+    Cy_SCB_UART_PutArrayBlocking(base, (void *) string, (uint32_t) strlen(string));
+}
+
+uint32_t Cy_SCB_UART_Get(CySCB_Type const *base)
+{
+    model_step(MODEL_CALL_CYCLES);
+    return model_fifo_pop(&model_scb(base)->rx);
+}
+
+uint32_t Cy_SCB_UART_GetNumInTxFifo(CySCB_Type const *base)
+{
+    model_step(MODEL_CALL_CYCLES);
+    return model_scb(base)->tx.count;
+}
+
+uint32_t Cy_SCB_UART_GetNumInRxFifo(CySCB_Type const *base)
+{
+    model_step(MODEL_CALL_CYCLES);
+    return model_scb(base)->rx.count;
+}
+
+bool Cy_SCB_UART_IsTxComplete(CySCB_Type const *base)
+{
+    model_step(MODEL_CALL_CYCLES);
+    return (0UL == model_scb(base)->tx.count) && !model_scb(base)->shifting;
+}
+
+void Cy_SCB_SPI_SetActiveSlaveSelect(CySCB_Type *base, cy_en_scb_spi_slave_select_t slaveSelect)
+{
+    model_scb(base)->slaveSelect = slaveSelect;
+}
+
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/* Test interface of the host model. The model advances its cycle counter on
+ * every PDL call, moves one DMA element per four cycles on the winning
+ * channel, drains and fills the SCB FIFOs at the character rate set by the
+ * test, and delivers the SysTick and DMAC interrupts whenever PRIMASK is
+ * clear. A test resets the model, drives the module under test through its
+ * API and checks the outcome with model_check(). */
+#ifndef HOST_MODEL_H
+#define HOST_MODEL_H
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Core clock of the model */
+#define MODEL_CORE_CLOCK_HZ             48000000UL
+
+/* Depth of the SCB FIFOs */
+#define MODEL_SCB_FIFO_DEPTH            8UL
+
+/* Size of the capture buffer of the transmitted bytes of each SCB */
+#define MODEL_SCB_CAPTURE_SIZE          8192UL
+
+/* Called on every Cy_SysPm_CpuEnterSleep() before the CPU sleeps */
+typedef void (*model_hook_t)(void);
+
+void model_reset(void);
+void model_advance(uint32_t cycles);
+uint64_t model_cycles(void);
+void model_set_sleep_hook(model_hook_t hook);
+uint32_t model_sleeps(void);
+
+void model_dmac_hold(bool hold);
+bool model_dmac_channel_enabled(uint32_t channel);
+
+void model_scb_char_cycles(CySCB_Type *base, uint32_t cycles);
+void model_scb_tx_stall(CySCB_Type *base, bool stall);
+void model_scb_loopback(CySCB_Type *base, bool loopback);
+void model_scb_rx_feed(CySCB_Type *base, const uint8_t *data, uint32_t size, uint32_t delayCycles);
+bool model_scb_rx_fed(CySCB_Type const *base);
+uint32_t model_scb_tx_take(CySCB_Type *base, uint8_t *data, uint32_t size);
+uint32_t model_scb_tx_overflows(CySCB_Type const *base);
+
+bool model_check(bool condition, const char *name);
+uint32_t model_take_asserts(void);
+int model_summary(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HOST_MODEL_H */
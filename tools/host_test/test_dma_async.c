@@ -0,0 +1,297 @@
+/******************************************************************************
+* File Name:   test_dma_async.c
+*
+* Description: This file contains the host test of the stackless tasks. It runs
+*              the async benchmark against the model DMAC and the real DMA queue,
+*              checks that the pipelines stay in their part of the shared
+*              benchmark buffer, and drives a task through a copy, a yield, a UART
+*              drain and a copy that times out. The Makefile builds it with the
+*              default buffer and with the 1 KB buffer of an 8 KB device.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "host_model.h"
+#include "dma_async.h"
+#include "dma_benchmark.h"
+#include "uart_fmt.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Part of the shared buffer the benchmark uses: the output of four pipelines
+ * of two blocks and one work block per pipeline, DMA_BENCHMARK_MAX_SIZE / 16
+ * bytes each */
+#define TEST_BLOCK_SIZE                 (DMA_BENCHMARK_MAX_SIZE / 16UL)
+#define TEST_USED_SIZE                  (12UL * TEST_BLOCK_SIZE)
+#define TEST_GUARD                      0xA5U
+
+/* Bytes of the copy and of the text of the test task */
+#define TEST_COPY_SIZE                  64UL
+#define TEST_TEXT                       "drained\r\n"
+
+/* Timeout of the copy of the test task, and the cycles a timeout may take
+ * beyond it */
+#define TEST_TIMEOUT_CYCLES             10000UL
+#define TEST_SLACK                      400UL
+
+/* Cycles the main loop of the test spends between two calls of a task */
+#define TEST_POLL_CYCLES                50UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* State of the test task */
+typedef struct
+{
+    dma_async_t task;                   /* Resume point */
+    dma_queue_request_t request;        /* Copy */
+    uint32_t step;                      /* Last step reached */
+    bool timedOut;                      /* The copy did not complete in time */
+} test_task_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+static uint8_t g_testSrc[TEST_COPY_SIZE];
+static uint8_t g_testDst[TEST_COPY_SIZE];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static dma_async_status_t test_task_run(test_task_t *state);
+static uint32_t test_task_finish(test_task_t *state, uint32_t *calls);
+static uint32_t test_benchmark_rows(uint32_t *rows);
+
+/********************************************************************************
+* Function Name: test_task_run
+*********************************************************************************
+* Summary:
+* Test task: copies g_testSrc to g_testDst through the DMA queue with a
+* timeout, yields once, then sends TEST_TEXT and awaits the UART drain.
+*
+* Parameters:
+*  state: Task state
+*
+* Return:
+*  dma_async_status_t: DMA_ASYNC_WAITING until the task is finished
+*
+********************************************************************************/
+static dma_async_status_t test_task_run(test_task_t *state)
+{
+    DMA_ASYNC_BEGIN(&state->task);
+
+    state->step = 1UL;
+    state->request.src      = g_testSrc;
+    state->request.dst      = g_testDst;
+    state->request.size     = TEST_COPY_SIZE;
+    state->request.callback = NULL;
+    state->request.context  = NULL;
+    (void) dma_queue_submit(&state->request);
+    DMA_ASYNC_AWAIT_TIMEOUT(&state->task, dma_async_request_done(&state->request), TEST_TIMEOUT_CYCLES);
+    if (!dma_async_request_done(&state->request))
+    {
+        state->timedOut = true;
+        DMA_ASYNC_EXIT(&state->task);
+    }
+
+    state->step = 2UL;
+    DMA_ASYNC_YIELD(&state->task);
+
+    state->step = 3UL;
+    (void) uart_tx_dma_send(TEST_TEXT, sizeof(TEST_TEXT) - 1U);
+    DMA_ASYNC_AWAIT(&state->task, dma_async_uart_drained());
+
+    state->step = 4UL;
+    DMA_ASYNC_END(&state->task);
+}
+
+/********************************************************************************
+* Function Name: test_task_finish
+*********************************************************************************
+* Summary:
+* Calls the test task from a main loop until it is finished.
+*
+* Parameters:
+*  state: Task state
+*  calls: Set to the number of calls
+*
+* Return:
+*  uint32_t: Cycles until the task finished
+*
+********************************************************************************/
+static uint32_t test_task_finish(test_task_t *state, uint32_t *calls)
+{
+    uint64_t start = model_cycles();
+
+    *calls = 1UL;
+    while (DMA_ASYNC_WAITING == test_task_run(state))
+    {
+        model_advance(TEST_POLL_CYCLES);
+        (*calls)++;
+    }
+    return (uint32_t) (model_cycles() - start);
+}
+
+/********************************************************************************
+* Function Name: test_benchmark_rows
+*********************************************************************************
+* Summary:
+* Counts the async rows written to UART_HW that report the expected
+* pipelines, blocks and block size, and those that also end in ok = 1.
+*
+* Parameters:
+*  rows: Number of rows with the expected layout
+*
+* Return:
+*  uint32_t: Number of those rows with ok = 1
+*
+********************************************************************************/
+static uint32_t test_benchmark_rows(uint32_t *rows)
+{
+    char text[MODEL_SCB_CAPTURE_SIZE + 1U];
+    char layout[32];
+    uint32_t size = model_scb_tx_take(UART_HW, (uint8_t *) text, MODEL_SCB_CAPTURE_SIZE);
+    uint32_t ok = 0UL;
+    char *line;
+
+    (void) snprintf(layout, sizeof(layout), ",4,2,%lu,", (unsigned long) TEST_BLOCK_SIZE);
+    text[size] = '\0';
+    *rows = 0UL;
+    for (line = strtok(text, "\r\n"); NULL != line; line = strtok(NULL, "\r\n"))
+    {
+        if ((0 == strncmp(line, "async,", 6U)) && (NULL != strstr(line, layout)))
+        {
+            (*rows)++;
+            if (0 == strcmp(&line[strlen(line) - 2U], ",1"))
+            {
+                ok++;
+            }
+        }
+    }
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: main
+*********************************************************************************
+* Summary:
+* Runs the checks and prints the result of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int: 0 if all checks passed, 1 otherwise
+*
+********************************************************************************/
+int main(void)
+{
+    uint8_t *scratch = dma_benchmark_scratch();
+    uint8_t text[sizeof(TEST_TEXT)];
+    test_task_t state;
+    uint32_t cycles;
+    uint32_t calls;
+    uint32_t rows;
+    uint32_t i;
+    bool ok;
+
+    for (i = 0UL; i < TEST_COPY_SIZE; i++)
+    {
+        g_testSrc[i] = (uint8_t) ((i * 7UL) + 3UL);
+    }
+
+    model_reset();
+    model_scb_char_cycles(UART_HW, 16UL);
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+    dma_queue_init();
+    uart_tx_dma_init();
+
+    /* Both methods complete and check their output, and the pipelines use
+     * only their part of the shared buffer */
+    (void) memset(scratch, TEST_GUARD, DMA_BENCHMARK_MAX_SIZE);
+    dma_async_benchmark_run();
+    (void) uart_fmt_flush();
+    model_check((2UL == test_benchmark_rows(&rows)) && (2UL == rows), "benchmark rows ok");
+    ok = true;
+    for (i = TEST_USED_SIZE; i < DMA_BENCHMARK_MAX_SIZE; i++)
+    {
+        ok = ok && (TEST_GUARD == scratch[i]);
+    }
+    model_check(ok, "rest of the shared buffer untouched");
+
+    /* A task runs through its awaits and its yield, one step per call */
+    (void) memset(&state, 0, sizeof(state));
+    dma_async_init(&state.task);
+    model_check((DMA_ASYNC_WAITING == test_task_run(&state)) && (1UL == state.step), "first call waits for the copy");
+    cycles = test_task_finish(&state, &calls);
+    model_check((4UL == state.step) && !state.timedOut && (CY_DMAC_DONE == state.request.response) &&
+                (0 == memcmp(g_testSrc, g_testDst, TEST_COPY_SIZE)) && (calls >= 3UL), "task finished");
+    model_check((model_scb_tx_take(UART_HW, text, sizeof(text)) == (sizeof(TEST_TEXT) - 1U)) &&
+                (0 == memcmp(text, TEST_TEXT, sizeof(TEST_TEXT) - 1U)) && dma_async_uart_drained(), "UART drained");
+
+    /* A finished task stays finished until it is restarted */
+    state.step = 0UL;
+    model_check((DMA_ASYNC_DONE == test_task_run(&state)) && (0UL == state.step), "finished task does not rerun");
+
+    /* A copy held by the DMAC times out and ends the task early */
+    dma_async_init(&state.task);
+    model_dmac_hold(true);
+    cycles = test_task_finish(&state, &calls);
+    model_check(state.timedOut && (1UL == state.step) && (cycles >= TEST_TIMEOUT_CYCLES) &&
+                (cycles < (TEST_TIMEOUT_CYCLES + TEST_SLACK)), "held copy times out");
+    model_dmac_hold(false);
+    model_check(CY_DMAC_DONE == dma_queue_wait(&state.request), "held copy completes after release");
+
+    /* A task restarted after a timeout runs again */
+    state.timedOut = false;
+    dma_async_init(&state.task);
+    (void) test_task_finish(&state, &calls);
+    (void) model_scb_tx_take(UART_HW, text, sizeof(text));
+    model_check((4UL == state.step) && !state.timedOut, "restarted task finished");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
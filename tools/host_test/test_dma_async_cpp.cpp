@@ -0,0 +1,366 @@
+/******************************************************************************
+* File Name:   test_dma_async_cpp.cpp
+*
+* Description: This file contains the host test of the C++20 coroutine
+*              scheduler of dma_async.hpp. Four coroutine pipelines copy blocks
+*              from flash through the real DMA queue on the model DMAC, invert them
+*              and copy them out. The test also checks the frame pool, a yield, a
+*              UART drain and an await that times out.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <cstring>
+#include "host_model.h"
+#include "dma_async.hpp"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Pipelines and blocks of the pipeline test, and bytes per block */
+#define TEST_PIPELINES                  DMA_ASYNC_FRAMES
+#define TEST_BLOCKS                     2U
+#define TEST_BLOCK_SIZE                 64U
+
+/* Flash source of the pipelines */
+#define TEST_SRC                        (CY_FLASH_BASE + 0x100U)
+
+/* Text of the drain test */
+#define TEST_TEXT                       "drained\r\n"
+
+/* Timeout of the held await, and the cycles a timeout may take beyond it */
+#define TEST_TIMEOUT_CYCLES             10000U
+#define TEST_SLACK                      400U
+
+/* Cycles the main loop of the test spends between two polls */
+#define TEST_POLL_CYCLES                50U
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* State of one pipeline that lives outside its frame */
+typedef struct
+{
+    dma_queue_request_t request;        /* Copy in progress */
+    std::uint8_t work[TEST_BLOCK_SIZE]; /* Block being processed */
+    bool ok;                            /* Every copy completed */
+    bool finished;                      /* The coroutine returned */
+} test_pipeline_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+static test_pipeline_t g_testPipelines[TEST_PIPELINES];
+static std::uint8_t g_testOutput[TEST_PIPELINES * TEST_BLOCKS * TEST_BLOCK_SIZE];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void test_copy(dma_queue_request_t &request, const void *src, void *dst);
+static dma::async::task test_pipeline(std::uint32_t index);
+static dma::async::task test_yield(std::uint32_t &steps);
+static dma::async::task test_drain(bool &drained);
+static dma::async::task test_held(dma_queue_request_t &request, bool &completed, bool &resumed);
+static std::uint32_t test_finish(dma::async::task &pending);
+
+/********************************************************************************
+* Function Name: test_copy
+*********************************************************************************
+* Summary:
+* Submits one block copy to the DMA queue.
+*
+* Parameters:
+*  request: Request of the copy
+*  src: Source block
+*  dst: Destination block
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void test_copy(dma_queue_request_t &request, const void *src, void *dst)
+{
+    request.src      = src;
+    request.dst      = dst;
+    request.size     = TEST_BLOCK_SIZE;
+    request.callback = nullptr;
+    request.context  = nullptr;
+
+    (void) dma_queue_submit(&request);
+}
+
+/********************************************************************************
+* Function Name: test_pipeline
+*********************************************************************************
+* Summary:
+* Pipeline coroutine: copies each of its blocks from flash to its work
+* buffer, inverts it and copies it to its part of g_testOutput.
+*
+* Parameters:
+*  index: Pipeline number
+*
+* Return:
+*  dma::async::task: Task of the pipeline
+*
+********************************************************************************/
+static dma::async::task test_pipeline(std::uint32_t index)
+{
+    test_pipeline_t &pipeline = g_testPipelines[index];
+    const std::uint8_t *src = reinterpret_cast<const std::uint8_t *>(TEST_SRC);
+    std::uint32_t offset;
+    std::uint32_t block;
+    std::uint32_t i;
+
+    for (block = 0U; block < TEST_BLOCKS; block++)
+    {
+        offset = ((index * TEST_BLOCKS) + block) * TEST_BLOCK_SIZE;
+
+        test_copy(pipeline.request, &src[offset], pipeline.work);
+        pipeline.ok = (co_await dma::async::request_done(pipeline.request)) && pipeline.ok &&
+                      (CY_DMAC_DONE == pipeline.request.response);
+
+        for (i = 0U; i < TEST_BLOCK_SIZE; i++)
+        {
+            pipeline.work[i] = static_cast<std::uint8_t>(~pipeline.work[i]);
+        }
+
+        test_copy(pipeline.request, pipeline.work, &g_testOutput[offset]);
+        pipeline.ok = (co_await dma::async::request_done(pipeline.request)) && pipeline.ok &&
+                      (CY_DMAC_DONE == pipeline.request.response);
+    }
+
+    pipeline.finished = true;
+}
+
+/********************************************************************************
+* Function Name: test_yield
+*********************************************************************************
+* Summary:
+* Coroutine that counts a step before and after a yield.
+*
+* Parameters:
+*  steps: Counter of the steps
+*
+* Return:
+*  dma::async::task: Task of the coroutine
+*
+********************************************************************************/
+static dma::async::task test_yield(std::uint32_t &steps)
+{
+    steps++;
+    co_await dma::async::yield();
+    steps++;
+}
+
+/********************************************************************************
+* Function Name: test_drain
+*********************************************************************************
+* Summary:
+* Coroutine that sends TEST_TEXT through the DMA transmitter and awaits the
+* UART drain.
+*
+* Parameters:
+*  drained: Set to the result of the await
+*
+* Return:
+*  dma::async::task: Task of the coroutine
+*
+********************************************************************************/
+static dma::async::task test_drain(bool &drained)
+{
+    (void) uart_tx_dma_send(TEST_TEXT, sizeof(TEST_TEXT) - 1U);
+    drained = co_await dma::async::uart_drained();
+}
+
+/********************************************************************************
+* Function Name: test_held
+*********************************************************************************
+* Summary:
+* Coroutine that awaits a request with TEST_TIMEOUT_CYCLES.
+*
+* Parameters:
+*  request: Submitted request
+*  completed: Set to the result of the await
+*  resumed: Set when the await returns
+*
+* Return:
+*  dma::async::task: Task of the coroutine
+*
+********************************************************************************/
+static dma::async::task test_held(dma_queue_request_t &request, bool &completed, bool &resumed)
+{
+    completed = co_await dma::async::request_done(request, TEST_TIMEOUT_CYCLES);
+    resumed = true;
+}
+
+/********************************************************************************
+* Function Name: test_finish
+*********************************************************************************
+* Summary:
+* Polls a task from a main loop until it is done.
+*
+* Parameters:
+*  pending: Task to run
+*
+* Return:
+*  std::uint32_t: Cycles until the task was done
+*
+********************************************************************************/
+static std::uint32_t test_finish(dma::async::task &pending)
+{
+    std::uint64_t start = model_cycles();
+
+    while (pending.poll())
+    {
+        model_advance(TEST_POLL_CYCLES);
+    }
+    return static_cast<std::uint32_t>(model_cycles() - start);
+}
+
+/********************************************************************************
+* Function Name: main
+*********************************************************************************
+* Summary:
+* Runs the checks and prints the result of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int: 0 if all checks passed, 1 otherwise
+*
+********************************************************************************/
+int main(void)
+{
+    const std::uint8_t *src = reinterpret_cast<const std::uint8_t *>(TEST_SRC);
+    std::uint8_t text[sizeof(TEST_TEXT)];
+    std::uint32_t cycles;
+    std::uint32_t steps = 0U;
+    std::uint32_t i;
+    bool completed = true;
+    bool resumed = false;
+    bool drained = false;
+    bool ok;
+
+    model_reset();
+    model_scb_char_cycles(UART_HW, 16UL);
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+    dma_queue_init();
+    uart_tx_dma_init();
+
+    {
+        dma::async::scheduler<TEST_PIPELINES> pipelines;
+
+        /* Every frame of the pool holds a pipeline */
+        ok = true;
+        for (i = 0U; i < TEST_PIPELINES; i++)
+        {
+            g_testPipelines[i].ok = true;
+            g_testPipelines[i].finished = false;
+            ok = pipelines.spawn(test_pipeline(i)) && ok;
+        }
+        model_check(ok, "pipelines spawned");
+
+        /* The pool is empty: a further task is not created and not taken */
+        dma::async::task extra = test_yield(steps);
+        model_check(!extra.valid() && extra.done() && (0U == steps) && !pipelines.spawn(std::move(extra)),
+                    "empty pool refuses a task");
+
+        /* The pipelines share the queue and complete */
+        while (pipelines.poll())
+        {
+            model_advance(TEST_POLL_CYCLES);
+        }
+        ok = true;
+        for (i = 0U; i < TEST_PIPELINES; i++)
+        {
+            ok = ok && g_testPipelines[i].ok && g_testPipelines[i].finished;
+        }
+        for (i = 0U; i < sizeof(g_testOutput); i++)
+        {
+            ok = ok && (0xFFU == static_cast<std::uint8_t>(g_testOutput[i] ^ src[i]));
+        }
+        model_check(ok, "pipelines complete");
+
+        /* Finished tasks keep their frames until the scheduler is destroyed */
+        dma::async::task kept = test_yield(steps);
+        model_check(!kept.valid(), "finished tasks keep their frames");
+    }
+
+    /* A yield suspends the task for one poll */
+    {
+        dma::async::task yielding = test_yield(steps);
+
+        model_check(yielding.valid() && !yielding.done() && (0U == steps), "task starts suspended");
+        model_check(yielding.poll() && (1U == steps), "yield suspends");
+        model_check(!yielding.poll() && (2U == steps) && yielding.done(), "yield resumes on the next poll");
+    }
+
+    /* The UART drain */
+    {
+        dma::async::task draining = test_drain(drained);
+
+        (void) test_finish(draining);
+        model_check(drained && dma_async_uart_drained() &&
+                    (model_scb_tx_take(UART_HW, text, sizeof(text)) == (sizeof(TEST_TEXT) - 1U)) &&
+                    (0 == std::memcmp(text, TEST_TEXT, sizeof(TEST_TEXT) - 1U)), "UART drained");
+    }
+
+    /* A copy held by the DMAC: the await returns false after the timeout */
+    {
+        dma_queue_request_t request;
+
+        model_dmac_hold(true);
+        test_copy(request, src, g_testOutput);
+        dma::async::task held = test_held(request, completed, resumed);
+
+        cycles = test_finish(held);
+        model_check(resumed && !completed && (cycles >= TEST_TIMEOUT_CYCLES) &&
+                    (cycles < (TEST_TIMEOUT_CYCLES + TEST_SLACK)), "held await times out");
+        model_dmac_hold(false);
+        model_check(CY_DMAC_DONE == dma_queue_wait(&request), "held copy completes after release");
+    }
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,201 @@
+/******************************************************************************
+* File Name:   test_dma_fill.c
+*
+* Description: This file contains the host test of the DMA fill engine. Built with
+*              DMA_FILL_THRESHOLD set to 1, so every non-empty fill runs on the
+*              model DMAC, it fills every size up to 300 bytes at every alignment,
+*              with a byte value and with a word pattern, and one region longer
+*              than a descriptor, and checks the region and the guard bytes.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "host_model.h"
+#include "cycle_count.h"
+#include "dma_fill.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Largest size of the sweep, in bytes */
+#define TEST_MAX_SIZE                   300UL
+
+/* Guard bytes before and after each fill */
+#define TEST_GUARD_SIZE                 8UL
+#define TEST_GUARD                      0xC3U
+
+/* Fill values */
+#define TEST_VALUE                      0x5AU
+#define TEST_PATTERN                    0x44332211UL
+
+/* Long fill: more words than one descriptor moves, three tail bytes, and a
+ * start one byte past a word boundary */
+#define TEST_DESCRIPTOR_WORDS           65536UL
+#define TEST_LONG_SIZE                  (((TEST_DESCRIPTOR_WORDS + 5UL) * 4UL) + 3UL + 3UL)
+#define TEST_LONG_OFFSET                1UL
+
+/* Buffer of the fills: guards, the largest offset and the longest fill */
+#define TEST_BUFFER_SIZE                ((2UL * TEST_GUARD_SIZE) + 4UL + TEST_LONG_SIZE)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+static CY_ALIGN(4) uint8_t g_testBuffer[TEST_BUFFER_SIZE];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static bool test_fill(uint32_t offset, uint32_t size, bool pattern);
+
+/********************************************************************************
+* Function Name: test_fill
+*********************************************************************************
+* Summary:
+* Fills a region of the buffer, surrounded by guard bytes, and checks every
+* byte of the region and of the guards.
+*
+* Parameters:
+*  offset: Byte lane of the first byte of the region
+*  size: Size of the region in bytes
+*  pattern: Fill with TEST_PATTERN instead of TEST_VALUE
+*
+* Return:
+*  bool: true if the fill succeeded and every byte is right
+*
+********************************************************************************/
+static bool test_fill(uint32_t offset, uint32_t size, bool pattern)
+{
+    uint8_t *region = &g_testBuffer[TEST_GUARD_SIZE + offset];
+    uint32_t end = TEST_GUARD_SIZE + offset + size + TEST_GUARD_SIZE;
+    uint8_t expected;
+    uint32_t i;
+    bool ok;
+
+    (void) memset(g_testBuffer, TEST_GUARD, end);
+    ok = pattern ? dma_fill_pattern(region, TEST_PATTERN, size) : dma_fill(region, TEST_VALUE, size);
+
+    for (i = 0UL; ok && (i < end); i++)
+    {
+        if ((i < (TEST_GUARD_SIZE + offset)) || (i >= (TEST_GUARD_SIZE + offset + size)))
+        {
+            expected = TEST_GUARD;
+        }
+        else if (pattern)
+        {
+            /* Byte lane of the address selects the pattern byte */
+            expected = (uint8_t) (TEST_PATTERN >> ((i & 3UL) * 8UL));
+        }
+        else
+        {
+            expected = TEST_VALUE;
+        }
+
+        if (g_testBuffer[i] != expected)
+        {
+            printf("  %s fill of %lu bytes at offset %lu: byte %ld is 0x%02X\n", pattern ? "pattern" : "value",
+                   (unsigned long) size, (unsigned long) offset,
+                   (long) i - (long) (TEST_GUARD_SIZE + offset), g_testBuffer[i]);
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: main
+*********************************************************************************
+* Summary:
+* Runs the checks and prints the result of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int: 0 if all checks passed, 1 otherwise
+*
+********************************************************************************/
+int main(void)
+{
+    uint32_t offset;
+    uint32_t size;
+    bool ok;
+
+    model_reset();
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, DMA_FILL_CHANNEL);
+
+    /* Every size and alignment: head bytes by the CPU, body words and tail
+     * bytes by the DMAC */
+    ok = true;
+    for (offset = 0UL; offset < 4UL; offset++)
+    {
+        for (size = 0UL; size <= TEST_MAX_SIZE; size++)
+        {
+            ok = test_fill(offset, size, false) && ok;
+        }
+    }
+    model_check(ok, "value fills up to 300 bytes at every alignment");
+
+    ok = true;
+    for (offset = 0UL; offset < 4UL; offset++)
+    {
+        for (size = 0UL; size <= TEST_MAX_SIZE; size++)
+        {
+            ok = test_fill(offset, size, true) && ok;
+        }
+    }
+    model_check(ok, "pattern fills up to 300 bytes at every alignment");
+
+    /* A body split over two descriptors, followed by the tail in a second
+     * pair */
+    model_check(test_fill(TEST_LONG_OFFSET, TEST_LONG_SIZE, false), "value fill longer than a descriptor");
+    model_check(test_fill(TEST_LONG_OFFSET, TEST_LONG_SIZE, true), "pattern fill longer than a descriptor");
+
+    /* The channel is left usable */
+    model_check(test_fill(2UL, 100UL, false) && model_dmac_channel_enabled(DMA_FILL_CHANNEL), "channel usable");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,299 @@
+/******************************************************************************
+* File Name:   test_dma_power.c
+*
+* Description: This file contains the host test of dma_power_wait(). It runs the
+*              wait against the model DMAC and checks the wake-up on completion,
+*              a completion in the window between the response check and the
+*              sleep, an error response, and the deadline while the DMAC is held.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "host_model.h"
+#include "cycle_count.h"
+#include "dma_chain.h"
+#include "dma_power.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Channel under test */
+#define TEST_CHANNEL                    DMA_POWER_BENCHMARK_CHANNEL
+
+/* Words of a transfer and the cycles the model needs to move them */
+#define TEST_WORDS                      256UL
+#define TEST_TRANSFER_CYCLES            (TEST_WORDS * 8UL)
+
+/* Period of the SysTick wrap that bounds each sleep */
+#define TEST_WRAP_CYCLES                (1UL << CYCLE_COUNT_HW_BITS)
+
+/* Deadline spanning several SysTick wraps */
+#define TEST_LONG_TIMEOUT               ((3UL * TEST_WRAP_CYCLES) + 1000UL)
+
+/* Deadline shorter than a transfer */
+#define TEST_SHORT_TIMEOUT              1000UL
+
+/* Cycles of the wait loop around a sleep */
+#define TEST_SLACK                      400UL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Transfer buffers */
+static uint32_t g_testSrc[TEST_WORDS];
+static uint32_t g_testDst[TEST_WORDS];
+
+/* Completion callbacks, in total and when the sleep hook returned */
+static uint32_t g_testCallbacks;
+static uint32_t g_testCallbacksInHook;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void test_callback(uint32_t channel);
+static void test_race_hook(void);
+static void test_arm(const void *src);
+static void test_release(void);
+
+/********************************************************************************
+* Function Name: test_callback
+*********************************************************************************
+* Summary:
+* Counts the completion interrupts of the channel.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void test_callback(uint32_t channel)
+{
+    (void) channel;
+    g_testCallbacks++;
+}
+
+/********************************************************************************
+* Function Name: test_race_hook
+*********************************************************************************
+* Summary:
+* Runs in Cy_SysPm_CpuEnterSleep(), after dma_power_wait() has seen the
+* response pending and before the CPU sleeps. Releases the DMAC and lets the
+* transfer complete, so its interrupt is pending when the CPU goes to sleep.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void test_race_hook(void)
+{
+    model_set_sleep_hook(NULL);
+    model_dmac_hold(false);
+    model_advance(TEST_TRANSFER_CYCLES);
+    g_testCallbacksInHook = g_testCallbacks;
+}
+
+/********************************************************************************
+* Function Name: test_arm
+*********************************************************************************
+* Summary:
+* Configures PING for a word copy into g_testDst, with the completion
+* interrupt, and triggers it.
+*
+* Parameters:
+*  src: Source of the copy
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void test_arm(const void *src)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = src,
+        .dst          = g_testDst,
+        .count        = TEST_WORDS,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_IM,
+        .srcIncrement = true,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+
+    (void) memset(g_testDst, 0, sizeof(g_testDst));
+    g_testCallbacks = 0UL;
+    (void) dma_chain_config(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+    dma_chain_start(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+    dma_chain_trigger();
+}
+
+/********************************************************************************
+* Function Name: test_release
+*********************************************************************************
+* Summary:
+* Resets the channel after a timeout or an error and releases the DMAC.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void test_release(void)
+{
+    dma_chain_recover(TEST_CHANNEL);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, TEST_CHANNEL);
+    model_dmac_hold(false);
+}
+
+/********************************************************************************
+* Function Name: main
+*********************************************************************************
+* Summary:
+* Runs the checks and prints the result of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int: 0 if all checks passed, 1 otherwise
+*
+********************************************************************************/
+int main(void)
+{
+    dma_power_stats_t stats;
+    dma_chain_status_t status;
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t i;
+
+    for (i = 0UL; i < TEST_WORDS; i++)
+    {
+        g_testSrc[i] = (i * 0x01010101UL) ^ 0x5A5A5A5AUL;
+    }
+
+    model_reset();
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, TEST_CHANNEL);
+    dma_chain_register_callback(TEST_CHANNEL, test_callback);
+
+    /* A descriptor that completed before the call is returned without a sleep */
+    test_arm(g_testSrc);
+    model_advance(TEST_TRANSFER_CYCLES);
+    dma_power_stats_reset(&stats);
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_LONG_TIMEOUT, &stats);
+    model_check((DMA_CHAIN_STATUS_DONE == status) && (0UL == stats.wakes) && (0UL == stats.sleepCycles) &&
+                (1UL == stats.transfers), "done before the wait");
+
+    /* The completion interrupt ends the sleep, and most of the wait is slept */
+    test_arm(g_testSrc);
+    dma_power_stats_reset(&stats);
+    start = model_cycles();
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_LONG_TIMEOUT, &stats);
+    cycles = model_cycles() - start;
+    model_check((DMA_CHAIN_STATUS_DONE == status) && (1UL == g_testCallbacks) &&
+                (0 == memcmp(g_testDst, g_testSrc, sizeof(g_testSrc))), "woken by the completion");
+    model_check((1UL == stats.wakes) && (stats.sleepCycles > stats.activeCycles) &&
+                (cycles < (TEST_TRANSFER_CYCLES + TEST_SLACK)), "wait slept");
+
+    /* The completion falls between the response check and the sleep. Its
+     * interrupt stays pending with interrupts masked, so the sleep ends at
+     * once instead of at the next SysTick wrap. */
+    model_dmac_hold(true);
+    test_arm(g_testSrc);
+    model_set_sleep_hook(test_race_hook);
+    dma_power_stats_reset(&stats);
+    start = model_cycles();
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_LONG_TIMEOUT, &stats);
+    cycles = model_cycles() - start;
+    model_check((DMA_CHAIN_STATUS_DONE == status) && (0UL == g_testCallbacksInHook) && (1UL == g_testCallbacks),
+                "completion before the sleep");
+    model_check((1UL == stats.wakes) && (cycles < (TEST_TRANSFER_CYCLES + TEST_SLACK)),
+                "pending interrupt ends the sleep");
+
+    /* An error response ends the wait with its status */
+    test_arm((const uint8_t *) g_testSrc + 1);
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_LONG_TIMEOUT, NULL);
+    model_check((DMA_CHAIN_STATUS_SRC_MISALIGNED == status) && (1UL == g_testCallbacks), "error response");
+    test_release();
+
+    /* A descriptor that never completes: the SysTick wraps wake the CPU to
+     * check the deadline, and the wait ends within one wrap after it */
+    model_dmac_hold(true);
+    test_arm(g_testSrc);
+    dma_power_stats_reset(&stats);
+    start = model_cycles();
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_LONG_TIMEOUT, &stats);
+    cycles = model_cycles() - start;
+    model_check((DMA_CHAIN_STATUS_TIMEOUT == status) && (0UL == g_testCallbacks), "long deadline");
+    model_check((cycles >= TEST_LONG_TIMEOUT) && (cycles < (TEST_LONG_TIMEOUT + TEST_WRAP_CYCLES + TEST_SLACK)) &&
+                (stats.wakes >= 3UL) && ((stats.sleepCycles + stats.activeCycles) <= (uint32_t) cycles),
+                "long deadline within a wrap");
+    test_release();
+
+    /* A deadline shorter than a wrap also ends at the next wrap at the latest */
+    model_dmac_hold(true);
+    test_arm(g_testSrc);
+    start = model_cycles();
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_SHORT_TIMEOUT, NULL);
+    cycles = model_cycles() - start;
+    model_check((DMA_CHAIN_STATUS_TIMEOUT == status) && (cycles >= TEST_SHORT_TIMEOUT) &&
+                (cycles < (TEST_SHORT_TIMEOUT + TEST_WRAP_CYCLES + TEST_SLACK)), "short deadline");
+    test_release();
+
+    /* The channel works again after the timeouts */
+    test_arm(g_testSrc);
+    status = dma_power_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_LONG_TIMEOUT, NULL);
+    model_check((DMA_CHAIN_STATUS_DONE == status) && (0 == memcmp(g_testDst, g_testSrc, sizeof(g_testSrc))),
+                "recovered channel");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,226 @@
+/******************************************************************************
+* File Name:   test_spi_dma.c
+*
+* Description: Host test of the SPI engine against the model of the DMAC and
+*              SCB in this folder, with the model SCB looping MOSI back to
+*              MISO. It runs the loopback benchmark and checks queued
+*              transactions, the dummy transmit byte, discarded receive data
+*              and the end of the TX requests after the last byte. Build and
+*              run it with make in this folder.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <stdio.h>
+#include "host_model.h"
+#include "cycle_count.h"
+#include "dma_chain.h"
+#include "spi_dma.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* SCB of the SPI master and cycles per byte at a SPI clock of 6 MHz */
+#define TEST_SPI_HW                     SCB0
+#define TEST_BYTE_CYCLES                64UL
+
+/* Transactions of the queue case */
+#define TEST_QUEUE_LENGTH               3UL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+static uint8_t g_testTx[300];
+static uint8_t g_testRx[300];
+static uint8_t g_testWire[MODEL_SCB_CAPTURE_SIZE];
+
+/* Transactions in the order their callbacks ran */
+static spi_dma_transfer_t *g_testOrder[TEST_QUEUE_LENGTH];
+static uint32_t g_testCallbacks;
+
+/*******************************************************************************
+* Test helpers
+********************************************************************************/
+
+static void test_callback(spi_dma_transfer_t *transfer)
+{
+    if (g_testCallbacks < TEST_QUEUE_LENGTH)
+    {
+        g_testOrder[g_testCallbacks] = transfer;
+    }
+    g_testCallbacks++;
+}
+
+/* Rows of the benchmark output with ok = 1, and rows in total */
+static uint32_t test_benchmark_rows(uint32_t *rows)
+{
+    char text[MODEL_SCB_CAPTURE_SIZE + 1U];
+    uint32_t size = model_scb_tx_take(UART_HW, (uint8_t *) text, MODEL_SCB_CAPTURE_SIZE);
+    uint32_t ok = 0UL;
+    char *line;
+
+    text[size] = '\0';
+    *rows = 0UL;
+    for (line = strtok(text, "\r\n"); NULL != line; line = strtok(NULL, "\r\n"))
+    {
+        if (0 == strncmp(line, "spi,", 4U))
+        {
+            (*rows)++;
+            if (0 == strcmp(&line[strlen(line) - 2U], ",1"))
+            {
+                ok++;
+            }
+        }
+    }
+    return ok;
+}
+
+/*******************************************************************************
+* Test cases
+********************************************************************************/
+
+int main(void)
+{
+    spi_dma_transfer_t queue[TEST_QUEUE_LENGTH];
+    spi_dma_transfer_t transfer;
+    dma_chain_route_t route;
+    uint32_t rows;
+    uint32_t size;
+    uint32_t i;
+    bool ok;
+
+    for (i = 0UL; i < sizeof(g_testTx); i++)
+    {
+        g_testTx[i] = (uint8_t) ((i * 13UL) + 5UL);
+    }
+
+    model_reset();
+    model_scb_char_cycles(TEST_SPI_HW, TEST_BYTE_CYCLES);
+    model_scb_char_cycles(UART_HW, 16UL);
+    model_scb_loopback(TEST_SPI_HW, true);
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+
+    /* The SCB of the terminal is refused */
+    spi_dma_init(UART_HW);
+    model_check(1UL == model_take_asserts(), "UART_HW refused");
+
+    spi_dma_init(TEST_SPI_HW);
+    dma_chain_get_route(SPI_DMA_TX_CHANNEL, &route);
+    ok = (TRIG0_IN_SCB0_TR_TX_REQ == route.inTrig);
+    dma_chain_get_route(SPI_DMA_RX_CHANNEL, &route);
+    model_check(ok && (TRIG0_IN_SCB0_TR_RX_REQ == route.inTrig), "trigger inputs follow the SCB");
+
+    /* Invalid sizes are rejected */
+    transfer = (spi_dma_transfer_t) { .txData = g_testTx, .rxData = g_testRx, .size = 0UL };
+    ok = !spi_dma_submit(&transfer);
+    transfer.size = SPI_DMA_MAX_SIZE + 1UL;
+    model_check(ok && !spi_dma_submit(&transfer) && !spi_dma_is_busy(), "invalid sizes rejected");
+
+    /* The loopback benchmark gets every byte back */
+    spi_dma_benchmark_run();
+    model_check((6UL == test_benchmark_rows(&rows)) && (6UL == rows), "loopback benchmark rows ok");
+    (void) model_scb_tx_take(TEST_SPI_HW, g_testWire, sizeof(g_testWire));
+
+    /* One transaction: data back, TX requests stopped, nothing sent after the
+     * last byte */
+    (void) memset(g_testRx, 0, sizeof(g_testRx));
+    transfer = (spi_dma_transfer_t)
+    {
+        .txData = g_testTx, .rxData = g_testRx, .size = sizeof(g_testTx),
+        .slaveSelect = CY_SCB_SPI_SLAVE_SELECT1
+    };
+    model_check(spi_dma_submit(&transfer), "submit");
+    model_check(CY_DMAC_DONE == spi_dma_wait(&transfer), "transaction done");
+    model_check(0 == memcmp(g_testRx, g_testTx, sizeof(g_testTx)), "received data");
+    model_advance(TEST_BYTE_CYCLES * 4UL);
+    size = model_scb_tx_take(TEST_SPI_HW, g_testWire, sizeof(g_testWire));
+    model_check((0UL == SCB_TX_FIFO_CTRL(TEST_SPI_HW)) && (sizeof(g_testTx) == size) &&
+                (0 == memcmp(g_testWire, g_testTx, size)) && (0UL == model_scb_tx_overflows(TEST_SPI_HW)),
+                "TX requests stop after the last byte");
+
+    /* Queued transactions complete in order, each with its callback, and the
+     * caller is free while they run */
+    (void) memset(g_testRx, 0, sizeof(g_testRx));
+    g_testCallbacks = 0UL;
+    for (i = 0UL; i < TEST_QUEUE_LENGTH; i++)
+    {
+        queue[i] = (spi_dma_transfer_t)
+        {
+            .txData = &g_testTx[i * 100UL], .rxData = &g_testRx[i * 100UL], .size = 100UL,
+            .slaveSelect = (cy_en_scb_spi_slave_select_t) i, .callback = test_callback
+        };
+        (void) spi_dma_submit(&queue[i]);
+    }
+    model_check(spi_dma_is_busy() && (0UL == g_testCallbacks), "queue runs in the background");
+    model_check(CY_DMAC_DONE == spi_dma_wait(&queue[TEST_QUEUE_LENGTH - 1UL]), "last queued transaction done");
+    ok = (TEST_QUEUE_LENGTH == g_testCallbacks) && !spi_dma_is_busy();
+    for (i = 0UL; i < TEST_QUEUE_LENGTH; i++)
+    {
+        ok = ok && (&queue[i] == g_testOrder[i]) && (CY_DMAC_DONE == queue[i].response);
+    }
+    model_check(ok, "callbacks in queue order");
+    model_check(0 == memcmp(g_testRx, g_testTx, sizeof(g_testTx)), "queued data");
+    (void) model_scb_tx_take(TEST_SPI_HW, g_testWire, sizeof(g_testWire));
+
+    /* Without transmit data the dummy byte is sent */
+    (void) memset(g_testRx, 0, sizeof(g_testRx));
+    transfer = (spi_dma_transfer_t) { .txData = NULL, .rxData = g_testRx, .size = 20UL };
+    (void) spi_dma_submit(&transfer);
+    ok = (CY_DMAC_DONE == spi_dma_wait(&transfer));
+    for (i = 0UL; i < 20UL; i++)
+    {
+        ok = ok && (SPI_DMA_DUMMY_BYTE == g_testRx[i]);
+    }
+    model_check(ok && (0U == g_testRx[20]), "dummy transmit byte");
+    (void) model_scb_tx_take(TEST_SPI_HW, g_testWire, sizeof(g_testWire));
+
+    /* Without a receive buffer the data is sent and the received bytes dropped */
+    (void) memset(g_testRx, 0, sizeof(g_testRx));
+    transfer = (spi_dma_transfer_t) { .txData = g_testTx, .rxData = NULL, .size = 50UL };
+    (void) spi_dma_submit(&transfer);
+    ok = (CY_DMAC_DONE == spi_dma_wait(&transfer));
+    size = model_scb_tx_take(TEST_SPI_HW, g_testWire, sizeof(g_testWire));
+    model_check(ok && (50UL == size) && (0 == memcmp(g_testWire, g_testTx, size)) && (0U == g_testRx[0]),
+                "discarded receive data");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
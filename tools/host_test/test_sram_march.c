@@ -0,0 +1,305 @@
+/******************************************************************************
+* File Name:   test_sram_march.c
+*
+* Description: This file contains the host test of the background SRAM March test
+*              engine. It runs passes against the model DMAC and checks the result,
+*              that a preserved region holds its data after every poll, the bus
+*              time cap, the timeout of a starved transfer, and the benchmark rows.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "host_model.h"
+#include "cycle_count.h"
+#include "dma_chain.h"
+#include "sram_march.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Chunks of the test region */
+#define TEST_CHUNKS                     8UL
+
+/* Words of the test region */
+#define TEST_WORDS                      ((TEST_CHUNKS * SRAM_MARCH_CHUNK_SIZE) / 4UL)
+
+/* Last data background left in the region without preserve */
+#define TEST_LAST_BACKGROUND            0x55555555UL
+
+/* Bus time cap of the capped pass, and the share allowed for the poll
+ * granularity, in percent */
+#define TEST_CAP_PERCENT                25UL
+#define TEST_CAP_TOLERANCE              5UL
+
+/* Bound of a starved pass: one transfer timeout and the model's overhead */
+#define TEST_TIMEOUT_CYCLES             ((MODEL_CORE_CLOCK_HZ / 1000UL) * (SRAM_MARCH_TIMEOUT_MS + 1UL))
+
+/* Channel of the transfer that starves the engine, and the words of each of
+ * its two descriptors: together longer than SRAM_MARCH_TIMEOUT_MS */
+#define TEST_HOG_CHANNEL                0UL
+#define TEST_HOG_WORDS                  65536UL
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Region under test and its expected contents */
+static uint32_t g_testRegion[TEST_WORDS];
+static uint32_t g_testExpected[TEST_WORDS];
+
+/* Source of the transfer that starves the engine */
+static const uint32_t g_testHogWord = 0UL;
+static uint32_t g_testHogDst;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void test_fill(void);
+static bool test_run(uint32_t *polls, bool *intact);
+static uint32_t test_benchmark_rows(uint32_t *rows);
+
+/********************************************************************************
+* Function Name: test_fill
+*********************************************************************************
+* Summary:
+* Fills the region with data that differs from the data backgrounds.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void test_fill(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < TEST_WORDS; i++)
+    {
+        g_testRegion[i] = (i * 0x9E3779B9UL) + 1UL;
+    }
+    (void) memcpy(g_testExpected, g_testRegion, sizeof(g_testRegion));
+}
+
+/********************************************************************************
+* Function Name: test_run
+*********************************************************************************
+* Summary:
+* Polls the running pass to its end, checking the region after every poll.
+*
+* Parameters:
+*  polls: Number of polls that completed a chunk
+*  intact: Cleared if the region differed from its contents after a poll
+*
+* Return:
+*  bool: true if no poll completed more than one chunk
+*
+********************************************************************************/
+static bool test_run(uint32_t *polls, bool *intact)
+{
+    uint32_t chunks = 0UL;
+    bool single = true;
+    bool running = true;
+
+    *polls = 0UL;
+    *intact = true;
+    while (running)
+    {
+        running = sram_march_poll();
+        if (sram_march_get_stats()->chunks != chunks)
+        {
+            single = single && ((chunks + 1UL) == sram_march_get_stats()->chunks);
+            chunks = sram_march_get_stats()->chunks;
+            (*polls)++;
+        }
+        *intact = *intact && (0 == memcmp(g_testRegion, g_testExpected, sizeof(g_testRegion)));
+        model_advance(100UL);
+    }
+    return single;
+}
+
+/********************************************************************************
+* Function Name: test_benchmark_rows
+*********************************************************************************
+* Summary:
+* Counts the march rows written to UART_HW and those that end in ok = 1.
+*
+* Parameters:
+*  rows: Number of march rows
+*
+* Return:
+*  uint32_t: Number of rows with ok = 1
+*
+********************************************************************************/
+static uint32_t test_benchmark_rows(uint32_t *rows)
+{
+    char text[MODEL_SCB_CAPTURE_SIZE + 1U];
+    uint32_t size = model_scb_tx_take(UART_HW, (uint8_t *) text, MODEL_SCB_CAPTURE_SIZE);
+    uint32_t ok = 0UL;
+    char *line;
+
+    text[size] = '\0';
+    *rows = 0UL;
+    for (line = strtok(text, "\r\n"); NULL != line; line = strtok(NULL, "\r\n"))
+    {
+        if (0 == strncmp(line, "march,", 6U))
+        {
+            (*rows)++;
+            if (0 == strcmp(&line[strlen(line) - 2U], ",1"))
+            {
+                ok++;
+            }
+        }
+    }
+    return ok;
+}
+
+/********************************************************************************
+* Function Name: main
+*********************************************************************************
+* Summary:
+* Runs the checks and prints the result of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int: 0 if all checks passed, 1 otherwise
+*
+********************************************************************************/
+int main(void)
+{
+    const sram_march_stats_t *stats = sram_march_get_stats();
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t polls;
+    uint32_t rows;
+    uint32_t i;
+    bool intact;
+    bool ok;
+
+    model_reset();
+    model_scb_char_cycles(UART_HW, 16UL);
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+    sram_march_init();
+
+    /* Invalid regions are rejected */
+    ok = !sram_march_start((uint8_t *) g_testRegion + 2, SRAM_MARCH_CHUNK_SIZE, false, 100UL);
+    ok = ok && !sram_march_start(g_testRegion, SRAM_MARCH_CHUNK_SIZE + 4UL, false, 100UL);
+    ok = ok && !sram_march_start(g_testRegion, sizeof(g_testRegion), false, 0UL);
+    model_check(ok && (SRAM_MARCH_IDLE == sram_march_get_state()), "invalid regions rejected");
+
+    /* Without preserve, the region is left holding the last background */
+    test_fill();
+    model_check(sram_march_start(g_testRegion, sizeof(g_testRegion), false, 100UL), "start");
+    model_check(!sram_march_start(g_testRegion, sizeof(g_testRegion), false, 100UL), "second start rejected");
+    ok = test_run(&polls, &intact);
+    model_check((SRAM_MARCH_PASSED == sram_march_get_state()) && (TEST_CHUNKS == stats->chunks) &&
+                (0UL == stats->errors) && (0UL == stats->transferErrors), "pass");
+    ok = ok && (TEST_CHUNKS == polls);
+    for (i = 0UL; i < TEST_WORDS; i++)
+    {
+        ok = ok && (TEST_LAST_BACKGROUND == g_testRegion[i]);
+    }
+    model_check(ok, "one chunk per poll, last background left");
+
+    /* In preserve mode the region holds its data after every poll */
+    test_fill();
+    (void) sram_march_start(g_testRegion, sizeof(g_testRegion), true, 100UL);
+    ok = test_run(&polls, &intact);
+    model_check(ok && intact && (TEST_CHUNKS == polls) && (SRAM_MARCH_PASSED == sram_march_get_state()),
+                "preserved between polls");
+
+    /* With a cap, the engine idles between chunks only */
+    test_fill();
+    start = model_cycles();
+    (void) sram_march_start(g_testRegion, sizeof(g_testRegion), true, TEST_CAP_PERCENT);
+    ok = test_run(&polls, &intact);
+    cycles = model_cycles() - start;
+    model_check(ok && intact && (SRAM_MARCH_PASSED == sram_march_get_state()), "capped pass");
+    model_check(((uint64_t) stats->busCycles * 100U) <= (cycles * (TEST_CAP_PERCENT + TEST_CAP_TOLERANCE)),
+                "bus time within the cap");
+
+    /* A higher-priority transfer starves the engine: the transfer times out,
+     * the pass fails and the chunk is left as it was */
+    {
+        const dma_chain_segment_t hog =
+        {
+            .src = &g_testHogWord, .dst = &g_testHogDst, .count = TEST_HOG_WORDS,
+            .width = CY_DMAC_WORD_WORD, .triggerType = CY_DMAC_SINGLE_DESCR,
+            .retrigger = CY_DMAC_RETRIG_IM, .srcIncrement = false, .dstIncrement = false,
+            .interrupt = false
+        };
+
+        dma_chain_segment_t hogPing = hog;
+
+        hogPing.triggerType = CY_DMAC_DESCR_LIST;
+        (void) dma_chain_config(TEST_HOG_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &hogPing);
+        (void) dma_chain_config(TEST_HOG_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &hog);
+        dma_chain_start(TEST_HOG_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+        Cy_DMAC_Channel_SetPriority(USER_DMA_HW, TEST_HOG_CHANNEL, 0UL);
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, TEST_HOG_CHANNEL);
+        dma_chain_trigger();
+    }
+    test_fill();
+    start = model_cycles();
+    (void) sram_march_start(g_testRegion, sizeof(g_testRegion), true, 100UL);
+    (void) test_run(&polls, &intact);
+    cycles = model_cycles() - start;
+    model_check((SRAM_MARCH_FAILED == sram_march_get_state()) && (1UL == stats->transferErrors) &&
+                (0UL == stats->chunks) && intact && (cycles < TEST_TIMEOUT_CYCLES), "starved transfer times out");
+
+    /* After the other transfer ends the engine works again */
+    model_advance(TEST_HOG_WORDS * 2UL * 8UL);
+    test_fill();
+    (void) sram_march_start(g_testRegion, sizeof(g_testRegion), true, 100UL);
+    (void) test_run(&polls, &intact);
+    model_check(intact && (SRAM_MARCH_PASSED == sram_march_get_state()), "recovered channel");
+
+    /* The benchmark rows pass */
+    sram_march_benchmark_run();
+    model_check((4UL == test_benchmark_rows(&rows)) && (4UL == rows), "benchmark rows ok");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,163 @@
+/******************************************************************************
+* File Name:   test_uart_fmt.c
+*
+* Description: This file contains the host test of the bounded UART output. It
+*              stalls the transmitter of UART_HW in the model and checks that the
+*              uart_fmt writers and dump_compress_uart() give up after
+*              UART_FMT_TIMEOUT_MS, that later writes do not wait again, and that
+*              output resumes when the transmitter drains.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "host_model.h"
+#include "cycle_count.h"
+#include "uart_fmt.h"
+#include "dump_compress.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Cycles per character of the terminal */
+#define TEST_CHAR_CYCLES                64UL
+
+/* Timeout of one write in CPU cycles */
+#define TEST_TIMEOUT_CYCLES             ((MODEL_CORE_CLOCK_HZ / 1000UL) * UART_FMT_TIMEOUT_MS)
+
+/* Cycles a write may take after the timeout expired */
+#define TEST_TIMEOUT_SLACK              2000UL
+
+/* Cycles a write to a UART already known to be stalled may take */
+#define TEST_STALLED_CYCLES             500UL
+
+/* Line longer than the TX FIFO */
+#define TEST_LINE                       "0123456789abcdefghijklmnopqrstuvwxyz\r\n"
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Characters taken from the model */
+static uint8_t g_testWire[MODEL_SCB_CAPTURE_SIZE];
+
+/* Dump data */
+static uint8_t g_testDump[256];
+
+/********************************************************************************
+* Function Name: main
+*********************************************************************************
+* Summary:
+* Runs the checks and prints the result of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int: 0 if all checks passed, 1 otherwise
+*
+********************************************************************************/
+int main(void)
+{
+    uint64_t start;
+    uint64_t cycles;
+    uint32_t size;
+    uint32_t i;
+    bool ok;
+
+    for (i = 0UL; i < sizeof(g_testDump); i++)
+    {
+        g_testDump[i] = (uint8_t) (i * 7UL);
+    }
+
+    model_reset();
+    model_scb_char_cycles(UART_HW, TEST_CHAR_CYCLES);
+    cycle_count_init();
+
+    /* A line longer than the FIFO goes out completely */
+    ok = uart_fmt_str(TEST_LINE) && uart_fmt_u32(4294967295UL) && uart_fmt_flush();
+    size = model_scb_tx_take(UART_HW, g_testWire, sizeof(g_testWire));
+    model_check(ok && (sizeof(TEST_LINE) + 9UL == size) &&
+                (0 == memcmp(g_testWire, TEST_LINE "4294967295", size)), "line written");
+
+    /* A stalled transmitter: the write gives up after the timeout with the
+     * FIFO full */
+    model_scb_tx_stall(UART_HW, true);
+    start = model_cycles();
+    ok = !uart_fmt_str(TEST_LINE);
+    cycles = model_cycles() - start;
+    model_check(ok && (cycles >= TEST_TIMEOUT_CYCLES) && (cycles < (TEST_TIMEOUT_CYCLES + TEST_TIMEOUT_SLACK)),
+                "stalled write times out");
+
+    /* Later writes fail without waiting */
+    start = model_cycles();
+    ok = !uart_fmt_u32(12345UL) && !uart_fmt_hexdump(g_testDump, 32UL, 0UL) && !uart_fmt_char('x');
+    cycles = model_cycles() - start;
+    model_check(ok && (cycles < TEST_STALLED_CYCLES), "later writes do not wait");
+
+    start = model_cycles();
+    ok = !dump_compress_uart(g_testDump, sizeof(g_testDump), false);
+    cycles = model_cycles() - start;
+    model_check(ok && (cycles < TEST_STALLED_CYCLES), "dump reports the truncation");
+
+    /* The flush is bounded as well */
+    start = model_cycles();
+    ok = !uart_fmt_flush();
+    cycles = model_cycles() - start;
+    model_check(ok && (cycles < (TEST_TIMEOUT_CYCLES + TEST_TIMEOUT_SLACK)), "stalled flush times out");
+
+    /* Output resumes once the transmitter drains */
+    model_scb_tx_stall(UART_HW, false);
+    ok = uart_fmt_flush();
+    (void) model_scb_tx_take(UART_HW, g_testWire, sizeof(g_testWire));
+    ok = ok && uart_fmt_str(TEST_LINE) && uart_fmt_flush();
+    size = model_scb_tx_take(UART_HW, g_testWire, sizeof(g_testWire));
+    model_check(ok && ((sizeof(TEST_LINE) - 1UL) == size) && (0 == memcmp(g_testWire, TEST_LINE, size)),
+                "output resumes");
+
+    /* The next stall waits for the timeout again */
+    model_scb_tx_stall(UART_HW, true);
+    start = model_cycles();
+    ok = !uart_fmt_str(TEST_LINE);
+    cycles = model_cycles() - start;
+    model_check(ok && (cycles >= TEST_TIMEOUT_CYCLES), "next stall waits again");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,190 @@
+/******************************************************************************
+* File Name:   test_uart_rx_dma.c
+*
+* Description: Host test of the double-buffered UART receiver against the
+*              model of the DMAC and SCB in this folder. Bursts separated by
+*              idle gaps check the idle closure, a long burst the full-buffer
+*              hand-off, and a held frame the stall, restart and overrun
+*              accounting. Build and run it with make in this folder.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <stdio.h>
+#include "host_model.h"
+#include "cycle_count.h"
+#include "uart_rx_dma.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Baud rate of the receiver; the model sends one character per 10 bit times */
+#define TEST_BAUD_RATE                  115200UL
+#define TEST_CHAR_CYCLES                ((MODEL_CORE_CLOCK_HZ / TEST_BAUD_RATE) * 10UL)
+
+/* Main loop period between two calls of uart_rx_dma_poll() */
+#define TEST_POLL_CYCLES                500UL
+
+/* Gap that closes a frame, with margin */
+#define TEST_GAP_CYCLES                 (TEST_CHAR_CYCLES * (UART_RX_DMA_IDLE_CHARS + 2UL))
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+static uint8_t g_testLine[3UL * UART_RX_DMA_BUFFER_SIZE];
+
+/*******************************************************************************
+* Test helpers
+********************************************************************************/
+
+/* Sends bytes of the test pattern and runs the main loop until they are
+ * received and the line has been idle for the gap */
+static void test_receive(const uint8_t *data, uint32_t size)
+{
+    uint64_t end;
+
+    model_scb_rx_feed(UART_HW, data, size, TEST_CHAR_CYCLES);
+    while (!model_scb_rx_fed(UART_HW))
+    {
+        uart_rx_dma_poll();
+        model_advance(TEST_POLL_CYCLES);
+    }
+
+    end = model_cycles() + TEST_GAP_CYCLES;
+    while (model_cycles() < end)
+    {
+        uart_rx_dma_poll();
+        model_advance(TEST_POLL_CYCLES);
+    }
+}
+
+static bool test_frame(const uint8_t *expected, uint32_t length)
+{
+    uint32_t size = 0UL;
+    const uint8_t *frame = uart_rx_dma_get_frame(&size);
+
+    return (NULL != frame) && (length == size) && (0 == memcmp(frame, expected, length));
+}
+
+/*******************************************************************************
+* Test cases
+********************************************************************************/
+
+int main(void)
+{
+    uart_rx_dma_stats_t stats;
+    uint32_t size;
+    uint32_t i;
+
+    for (i = 0UL; i < sizeof(g_testLine); i++)
+    {
+        g_testLine[i] = (uint8_t) ((i * 37UL) + 11UL);
+    }
+
+    model_reset();
+    model_scb_char_cycles(UART_HW, TEST_CHAR_CYCLES);
+    cycle_count_init();
+    Cy_DMAC_Enable(USER_DMA_HW);
+    uart_rx_dma_init(TEST_BAUD_RATE);
+
+    /* Nothing is delivered before the first byte */
+    test_receive(g_testLine, 0UL);
+    model_check(NULL == uart_rx_dma_get_frame(&size), "no frame before data");
+
+    /* A short burst is closed by the idle gap */
+    test_receive(g_testLine, 10UL);
+    uart_rx_dma_get_stats(&stats);
+    model_check(test_frame(g_testLine, 10UL), "short burst closed by idle");
+    model_check((1UL == stats.idleFrames) && (0UL == stats.fullFrames), "idle closure counted");
+    uart_rx_dma_release();
+
+    /* Bursts separated by a gap are separate frames */
+    test_receive(&g_testLine[10], 3UL);
+    model_check(test_frame(&g_testLine[10], 3UL), "first of two bursts");
+    uart_rx_dma_release();
+    test_receive(&g_testLine[13], 7UL);
+    model_check(test_frame(&g_testLine[13], 7UL), "second of two bursts");
+    uart_rx_dma_release();
+
+    /* A burst longer than a buffer is handed off at the buffer size without
+     * losing a byte, and the remainder closed by the gap. Both buffers are
+     * then held, which stops the channel. */
+    test_receive(&g_testLine[20], UART_RX_DMA_BUFFER_SIZE + 36UL);
+    uart_rx_dma_get_stats(&stats);
+    model_check(1UL == stats.fullFrames, "full buffer closes a frame");
+    model_check((1UL == stats.stalls) && !model_dmac_channel_enabled(UART_RX_DMA_CHANNEL), "stall with both buffers held");
+    model_check(test_frame(&g_testLine[20], UART_RX_DMA_BUFFER_SIZE), "full frame data");
+    uart_rx_dma_release();
+    model_check(test_frame(&g_testLine[20UL + UART_RX_DMA_BUFFER_SIZE], 36UL), "remainder after hand-off");
+    uart_rx_dma_release();
+
+    /* During a stall the FIFO keeps the next burst until a release restarts
+     * the channel */
+    test_receive(g_testLine, 5UL);
+    test_receive(&g_testLine[5], 6UL);
+    uart_rx_dma_get_stats(&stats);
+    model_check(2UL == stats.stalls, "second stall");
+    test_receive(&g_testLine[11], 4UL);
+    model_check(test_frame(g_testLine, 5UL), "held frame unchanged");
+    uart_rx_dma_release();
+    test_receive(NULL, 0UL);
+    model_check(test_frame(&g_testLine[5], 6UL), "second held frame");
+    uart_rx_dma_release();
+    model_check(test_frame(&g_testLine[11], 4UL), "burst kept in the FIFO during the stall");
+    uart_rx_dma_release();
+
+    /* More than a FIFO of data during a stall overruns the FIFO */
+    test_receive(g_testLine, 2UL);
+    test_receive(&g_testLine[2], 2UL);
+    test_receive(&g_testLine[4], MODEL_SCB_FIFO_DEPTH + 4UL);
+    uart_rx_dma_get_stats(&stats);
+    model_check((4UL == stats.stalls) && (0UL != stats.fifoOverruns), "FIFO overrun counted");
+    uart_rx_dma_release();
+    uart_rx_dma_release();
+    test_receive(NULL, 0UL);
+    model_check(test_frame(&g_testLine[4], MODEL_SCB_FIFO_DEPTH), "FIFO contents after the overrun");
+    uart_rx_dma_release();
+
+    uart_rx_dma_get_stats(&stats);
+    model_check((11UL == stats.frames) && (4UL == stats.stalls), "frame and stall totals");
+
+    return model_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,28 @@
+/* Host stub of the FreeRTOS kernel configuration and port macros used by
+ * dma_rtos.c. The test drives the task and ISR sides by hand. */
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#define pdFALSE                         ((BaseType_t) 0)
+#define pdTRUE                          ((BaseType_t) 1)
+#define portMAX_DELAY                   ((TickType_t) 0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms)               ((TickType_t) (ms))
+
+#define configUSE_MUTEXES                       1
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   1
+
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+void vPortYield(void);
+#define taskENTER_CRITICAL()            vPortEnterCritical()
+#define taskEXIT_CRITICAL()             vPortExitCritical()
+#define portYIELD_FROM_ISR(woken)       do { if (pdFALSE != (woken)) { vPortYield(); } } while (0)
+
+#endif /* INC_FREERTOS_H */
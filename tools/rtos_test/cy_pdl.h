@@ -0,0 +1,38 @@
+/* Host stub of the PDL declarations used by dma_rtos.c, dma_chain.h and
+ * dma_benchmark.h. Only tools/rtos_test/test_dma_rtos.c includes it. */
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CY_ALIGN(align)                 __attribute__((aligned(align)))
+#define CY_FLASH_BASE                   0x00000000UL
+#define CPUSS_DMAC_CH_NR                8UL
+#define TRIG0_OUT_CPUSS_DMAC_TR_IN0     0x40000000UL
+
+typedef struct { volatile uint32_t ICSR; } SCB_Type;
+typedef struct { volatile uint32_t CTRL; volatile uint32_t LOAD; volatile uint32_t VAL; } SysTick_Type;
+extern SCB_Type *SCB;
+extern SysTick_Type *SysTick;
+#define SCB_ICSR_PENDSTSET_Msk          (1UL << 26)
+
+typedef struct { uint32_t reserved; } DMAC_Type;
+typedef enum { CY_DMAC_DESCRIPTOR_PING = 0, CY_DMAC_DESCRIPTOR_PONG = 1 } cy_en_dmac_descriptor_t;
+typedef enum { CY_DMAC_SUCCESS = 0, CY_DMAC_BAD_PARAM } cy_en_dmac_status_t;
+typedef enum
+{
+    CY_DMAC_DONE = 1, CY_DMAC_SRC_BUS_ERROR, CY_DMAC_DST_BUS_ERROR,
+    CY_DMAC_SRC_MISAL, CY_DMAC_DST_MISAL, CY_DMAC_INVALID_DESCR
+} cy_en_dmac_response_t;
+typedef enum { CY_DMAC_BYTE_BYTE = 0, CY_DMAC_WORD_WORD = 8 } cy_en_dmac_data_transfer_width_t;
+typedef enum { CY_DMAC_SINGLE_ELEMENT = 0, CY_DMAC_SINGLE_DESCR, CY_DMAC_DESCR_LIST } cy_en_dmac_trigger_type_t;
+typedef enum { CY_DMAC_RETRIG_IM = 0, CY_DMAC_RETRIG_4CYC, CY_DMAC_RETRIG_16CYC } cy_en_dmac_retrigger_t;
+
+cy_en_dmac_response_t Cy_DMAC_Descriptor_GetResponse(DMAC_Type const *base, uint32_t channel,
+                                                     cy_en_dmac_descriptor_t descriptor);
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+
+#endif /* CY_PDL_H */
@@ -0,0 +1,14 @@
+/* Host stub of the design aliases used by dma_rtos.c */
+#ifndef CYBSP_H
+#define CYBSP_H
+
+#include "cy_pdl.h"
+
+extern DMAC_Type *DMAC;
+#define USER_DMA_HW                     DMAC
+#define USER_DMA_CHANNEL                0UL
+
+/* Cycle counter of the model, read through DMA_RTOS_TIMESTAMP() */
+uint32_t test_timestamp(void);
+
+#endif /* CYBSP_H */
@@ -0,0 +1,46 @@
+/* Kernel configuration of the host test of dma_rtos.c on the FreeRTOS POSIX
+ * port (portable/ThirdParty/GCC/Posix of FreeRTOS-Kernel V11). Each task
+ * runs as a thread, and the tick is a 1 ms timer signal. */
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_TIME_SLICING                  1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configTICK_RATE_HZ                      1000
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configMAX_PRIORITIES                    6
+#define configMAX_TASK_NAME_LEN                 12
+
+/* Words of 8 bytes; a thread stack must be at least PTHREAD_STACK_MIN */
+#define configMINIMAL_STACK_SIZE                ((unsigned short) 4096)
+
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configSUPPORT_STATIC_ALLOCATION         0
+#define configTOTAL_HEAP_SIZE                   ((size_t) (1024 * 1024))
+
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             0
+#define configUSE_COUNTING_SEMAPHORES           0
+#define configQUEUE_REGISTRY_SIZE               0
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   1
+#define configUSE_TIMERS                        0
+
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_TRACE_FACILITY                0
+
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_xTaskGetSchedulerState          1
+
+/* A failed kernel assertion ends the test with a failure */
+void test_assert(const char *file, int line);
+#define configASSERT(x)                         do { if (!(x)) { test_assert(__FILE__, __LINE__); } } while (0)
+
+#endif /* FREERTOS_CONFIG_H */
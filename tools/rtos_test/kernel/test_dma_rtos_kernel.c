@@ -0,0 +1,447 @@
+/******************************************************************************
+* File Name:   test_dma_rtos_kernel.c
+*
+* Description: Host test of dma_rtos.c on the FreeRTOS POSIX port. The real
+*              kernel schedules the tasks; a task at the highest priority stands
+*              in for the DMAC completion interrupt. The cases cover a wake, a
+*              timeout, a completion before the wait, the wake latency while a
+*              lower-priority task keeps the CPU busy, and priority inheritance
+*              on the channel mutex. Build it with make FREERTOS_KERNEL=<path>
+*              in the parent folder.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "dma_rtos.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Channel under test */
+#define TEST_CHANNEL                    USER_DMA_CHANNEL
+
+/* Task priorities: the interrupt stand-in preempts every task */
+#define TEST_PRIORITY_ISR               (configMAX_PRIORITIES - 1U)
+#define TEST_PRIORITY_CONTROL           (configMAX_PRIORITIES - 2U)
+#define TEST_PRIORITY_HIGH              3U
+#define TEST_PRIORITY_MEDIUM            2U
+#define TEST_PRIORITY_LOW               1U
+
+/* Ticks from the trigger to the completion of a transfer */
+#define TEST_TRANSFER_TICKS             2U
+
+/* Timeout of the waits that are not expected to time out */
+#define TEST_WAIT_TICKS                 10U
+
+/* Timeout of the waits that are expected to time out */
+#define TEST_TIMEOUT_TICKS              3U
+
+/* Nanoseconds per tick, the unit of the timestamps */
+#define TEST_TICK_NS                    (1000000000UL / configTICK_RATE_HZ)
+
+/* The mean wake latency of a task that preempts a busy task is a small part
+ * of a tick; waiting for the next tick instead would take half a tick on
+ * average */
+#define TEST_WAKE_BOUND_NS              (TEST_TICK_NS / 4UL)
+
+/* Ticks the low-priority task holds the channel, and the ticks the
+ * medium-priority task keeps the CPU busy */
+#define TEST_HOLD_TICKS                 10U
+#define TEST_BUSY_TICKS                 30U
+
+/* Transfers of dma_rtos_benchmark_run() */
+#define TEST_BENCHMARK_TRANSFERS        32UL
+
+/* Events of the priority inheritance case, in the expected order */
+#define TEST_EVENTS                     3U
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Events of the priority inheritance case */
+typedef enum
+{
+    TEST_EVENT_LOW_UNLOCKED = 1,        /* The low-priority task gave the channel back */
+    TEST_EVENT_HIGH_LOCKED,             /* The high-priority task took the channel */
+    TEST_EVENT_MEDIUM_DONE              /* The medium-priority task stopped spinning */
+} test_event_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+SCB_Type *SCB = NULL;
+SysTick_Type *SysTick = NULL;
+DMAC_Type *DMAC = NULL;
+
+/* DMAC model */
+static dma_chain_callback_t g_testCallback = NULL;
+static volatile cy_en_dmac_response_t g_testResponse = DMA_CHAIN_RESPONSE_PENDING;
+static volatile TickType_t g_testTransferTicks = TEST_TRANSFER_TICKS;
+static volatile bool g_testCompleteOnRead = false;
+static SemaphoreHandle_t g_testTrigger = NULL;
+
+/* Last value of a benchmark row */
+static uint32_t g_testLastValue = 0UL;
+
+/* Busy task of the latency case */
+static volatile bool g_testSpin = false;
+
+/* Tasks and events of the priority inheritance case */
+static TaskHandle_t g_testLow = NULL;
+static test_event_t g_testEvents[TEST_EVENTS];
+static volatile uint32_t g_testEventCount = 0UL;
+static volatile UBaseType_t g_testLowPriority = 0U;
+
+static uint32_t g_testFailures = 0UL;
+
+/*******************************************************************************
+* Kernel hooks and PDL model
+********************************************************************************/
+
+void test_assert(const char *file, int line)
+{
+    printf("FAIL kernel assertion at %s:%d\n", file, line);
+    exit(1);
+}
+
+/* Monotonic time in nanoseconds, the cycle count of the host */
+uint32_t test_timestamp(void)
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) (((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec);
+}
+
+void dma_chain_register_callback(uint32_t channel, dma_chain_callback_t callback)
+{
+    (void) channel;
+    g_testCallback = callback;
+}
+
+dma_chain_status_t dma_chain_status(cy_en_dmac_response_t response)
+{
+    return (CY_DMAC_DONE == response) ? DMA_CHAIN_STATUS_DONE :
+           (CY_DMAC_SRC_BUS_ERROR == response) ? DMA_CHAIN_STATUS_SRC_BUS_ERROR :
+           DMA_CHAIN_STATUS_TIMEOUT;
+}
+
+cy_en_dmac_response_t Cy_DMAC_Descriptor_GetResponse(DMAC_Type const *base, uint32_t channel,
+                                                     cy_en_dmac_descriptor_t descriptor)
+{
+    (void) base;
+    (void) channel;
+    (void) descriptor;
+
+    /* Completion between the waiter registration and the response check:
+     * the interrupt stand-in preempts the read */
+    if (g_testCompleteOnRead)
+    {
+        g_testCompleteOnRead = false;
+        g_testTransferTicks = 0U;
+        (void) xSemaphoreGive(g_testTrigger);
+    }
+    return g_testResponse;
+}
+
+/* Configuring a descriptor clears its response */
+cy_en_dmac_status_t dma_chain_config(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                     const dma_chain_segment_t *segment)
+{
+    (void) channel;
+    (void) descriptor;
+    (void) segment;
+    g_testResponse = DMA_CHAIN_RESPONSE_PENDING;
+    return CY_DMAC_SUCCESS;
+}
+
+void dma_chain_start(uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    (void) channel;
+    (void) descriptor;
+}
+
+/* Starts the transfer: the interrupt stand-in completes it */
+void dma_chain_trigger(void)
+{
+    (void) xSemaphoreGive(g_testTrigger);
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    return 0UL;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    (void) savedIntrStatus;
+}
+
+void dma_benchmark_csv_comment(const char *text)
+{
+    printf("# %s\n", text);
+}
+
+void dma_benchmark_csv_begin(const char *test)
+{
+    printf("%s", test);
+}
+
+void dma_benchmark_csv_str(const char *value)
+{
+    printf(",%s", value);
+}
+
+void dma_benchmark_csv_u32(uint32_t value)
+{
+    printf(",%lu", (unsigned long) value);
+    g_testLastValue = value;
+}
+
+void dma_benchmark_csv_end(void)
+{
+    printf("\n");
+}
+
+/* Completion interrupt of the DMAC: completes each triggered transfer after
+ * g_testTransferTicks and calls the channel callback, which gives the
+ * notification and yields to the woken task */
+static void test_isr_task(void *parameters)
+{
+    (void) parameters;
+
+    for (;;)
+    {
+        (void) xSemaphoreTake(g_testTrigger, portMAX_DELAY);
+        if (0U != g_testTransferTicks)
+        {
+            vTaskDelay(g_testTransferTicks);
+        }
+        g_testResponse = CY_DMAC_DONE;
+        g_testCallback(TEST_CHANNEL);
+    }
+}
+
+/*******************************************************************************
+* Test cases
+********************************************************************************/
+
+static void test_check(bool condition, const char *name)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", name);
+    if (!condition)
+    {
+        g_testFailures++;
+    }
+}
+
+static void test_event(test_event_t event)
+{
+    taskENTER_CRITICAL();
+    if (g_testEventCount < TEST_EVENTS)
+    {
+        g_testEvents[g_testEventCount] = event;
+    }
+    g_testEventCount++;
+    taskEXIT_CRITICAL();
+}
+
+/* Starts a transfer that completes after a number of ticks */
+static void test_start(TickType_t ticks)
+{
+    const dma_chain_segment_t segment = { 0 };
+
+    g_testTransferTicks = ticks;
+    (void) dma_chain_config(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+    dma_chain_start(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+    dma_chain_trigger();
+}
+
+/* Keeps the CPU busy at low priority during the latency case */
+static void test_spin_task(void *parameters)
+{
+    (void) parameters;
+
+    while (g_testSpin)
+    {
+    }
+    vTaskDelete(NULL);
+}
+
+/* Spins until a number of ticks has passed, without blocking */
+static void test_busy(TickType_t ticks)
+{
+    TickType_t start = xTaskGetTickCount();
+
+    while ((xTaskGetTickCount() - start) < ticks)
+    {
+    }
+}
+
+/* Owns the channel and keeps the CPU busy while holding it */
+static void test_low_task(void *parameters)
+{
+    (void) parameters;
+
+    (void) dma_rtos_lock(TEST_CHANNEL, portMAX_DELAY);
+    test_busy(TEST_HOLD_TICKS);
+    test_event(TEST_EVENT_LOW_UNLOCKED);
+    dma_rtos_unlock(TEST_CHANNEL);
+    g_testLowPriority = uxTaskPriorityGet(NULL);
+    vTaskDelete(NULL);
+}
+
+/* Keeps the CPU busy between the low- and high-priority tasks */
+static void test_medium_task(void *parameters)
+{
+    (void) parameters;
+
+    test_busy(TEST_BUSY_TICKS);
+    test_event(TEST_EVENT_MEDIUM_DONE);
+    vTaskDelete(NULL);
+}
+
+/* Waits for the channel held by the low-priority task */
+static void test_high_task(void *parameters)
+{
+    (void) parameters;
+
+    (void) dma_rtos_lock(TEST_CHANNEL, portMAX_DELAY);
+    test_event(TEST_EVENT_HIGH_LOCKED);
+    dma_rtos_unlock(TEST_CHANNEL);
+    vTaskDelete(NULL);
+}
+
+static void test_control_task(void *parameters)
+{
+    dma_rtos_latency_t latency;
+    dma_chain_status_t status;
+    TickType_t start;
+    TickType_t ticks;
+    UBaseType_t inherited;
+
+    (void) parameters;
+
+    dma_rtos_attach(TEST_CHANNEL);
+    dma_rtos_reset_latency();
+
+    /* The completion interrupt wakes the blocked task */
+    test_start(TEST_TRANSFER_TICKS);
+    start = xTaskGetTickCount();
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_WAIT_TICKS);
+    ticks = xTaskGetTickCount() - start;
+    dma_rtos_get_latency(&latency);
+    test_check((DMA_CHAIN_STATUS_DONE == status) && (ticks >= TEST_TRANSFER_TICKS) && (ticks < TEST_WAIT_TICKS),
+               "wake on completion");
+    test_check((1UL == latency.wakes) && (latency.maxCycles < TEST_TICK_NS), "wake latency sample");
+
+    /* Without a completion the wait runs to its timeout */
+    g_testResponse = DMA_CHAIN_RESPONSE_PENDING;
+    start = xTaskGetTickCount();
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_TIMEOUT_TICKS);
+    ticks = xTaskGetTickCount() - start;
+    test_check((DMA_CHAIN_STATUS_TIMEOUT == status) && (ticks >= TEST_TIMEOUT_TICKS) &&
+               (ticks <= (TEST_TIMEOUT_TICKS + 1U)), "timeout");
+
+    /* A completion after the task registered as the waiter and before it
+     * read the response is seen without blocking. The notification it leaves
+     * only makes the next wait check the response again, and that wait still
+     * runs to its timeout without a latency sample. */
+    g_testResponse = DMA_CHAIN_RESPONSE_PENDING;
+    g_testCompleteOnRead = true;
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_WAIT_TICKS);
+    test_check(DMA_CHAIN_STATUS_DONE == status, "completion before the wait");
+    g_testResponse = DMA_CHAIN_RESPONSE_PENDING;
+    start = xTaskGetTickCount();
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, TEST_TIMEOUT_TICKS);
+    ticks = xTaskGetTickCount() - start;
+    dma_rtos_get_latency(&latency);
+    test_check((DMA_CHAIN_STATUS_TIMEOUT == status) && (ticks >= TEST_TIMEOUT_TICKS) && (1UL == latency.wakes),
+               "stale notification, then timeout");
+
+    /* The woken task preempts a busy lower-priority task at once instead of
+     * at the next tick */
+    g_testSpin = true;
+    (void) xTaskCreate(test_spin_task, "spin", configMINIMAL_STACK_SIZE, NULL, TEST_PRIORITY_LOW, NULL);
+    g_testTransferTicks = 1U;
+    dma_rtos_benchmark_run();
+    g_testSpin = false;
+    dma_rtos_get_latency(&latency);
+    test_check((1UL == g_testLastValue) && (TEST_BENCHMARK_TRANSFERS == latency.wakes), "benchmark transfers woke the task");
+    test_check((latency.totalCycles / latency.wakes) < TEST_WAKE_BOUND_NS, "wake latency below a quarter tick");
+    vTaskDelay(1U);
+
+    /* While the high-priority task waits for the channel, its owner runs at
+     * the high priority, ahead of the busy medium-priority task */
+    (void) xTaskCreate(test_low_task, "low", configMINIMAL_STACK_SIZE, NULL, TEST_PRIORITY_LOW, &g_testLow);
+    vTaskDelay(1U);
+    (void) xTaskCreate(test_high_task, "high", configMINIMAL_STACK_SIZE, NULL, TEST_PRIORITY_HIGH, NULL);
+    vTaskDelay(1U);
+    inherited = uxTaskPriorityGet(g_testLow);
+    (void) xTaskCreate(test_medium_task, "medium", configMINIMAL_STACK_SIZE, NULL, TEST_PRIORITY_MEDIUM, NULL);
+    vTaskDelay(TEST_HOLD_TICKS + TEST_BUSY_TICKS + 10U);
+    test_check(TEST_PRIORITY_HIGH == inherited, "owner inherits the priority of the waiter");
+    test_check((TEST_EVENTS == g_testEventCount) && (TEST_EVENT_LOW_UNLOCKED == g_testEvents[0]) &&
+               (TEST_EVENT_HIGH_LOCKED == g_testEvents[1]) && (TEST_EVENT_MEDIUM_DONE == g_testEvents[2]),
+               "owner runs ahead of the medium-priority task");
+    test_check(TEST_PRIORITY_LOW == g_testLowPriority, "owner priority restored on unlock");
+
+    printf("%lu failures\n", (unsigned long) g_testFailures);
+    exit((0UL == g_testFailures) ? 0 : 1);
+}
+
+int main(void)
+{
+    g_testTrigger = xSemaphoreCreateBinary();
+    dma_rtos_init();
+
+    (void) xTaskCreate(test_isr_task, "isr", configMINIMAL_STACK_SIZE, NULL, TEST_PRIORITY_ISR, NULL);
+    (void) xTaskCreate(test_control_task, "control", configMINIMAL_STACK_SIZE, NULL, TEST_PRIORITY_CONTROL, NULL);
+    vTaskStartScheduler();
+
+    /* The scheduler only returns if it could not start */
+    printf("FAIL scheduler did not start\n");
+    return 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,15 @@
+/* Host stub of the FreeRTOS semaphore API used by dma_rtos.c */
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include "FreeRTOS.h"
+
+typedef void *SemaphoreHandle_t;
+typedef struct { void *reserved[20]; } StaticSemaphore_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *mutexBuffer);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t blockTime);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif /* SEMAPHORE_H */
@@ -0,0 +1,19 @@
+/* Host stub of the FreeRTOS task API used by dma_rtos.c */
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef struct { BaseType_t overflowCount; TickType_t timeOnEntering; } TimeOut_t;
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+TickType_t xTaskGetTickCountFromISR(void);
+void vTaskSetTimeOutState(TimeOut_t *timeOut);
+BaseType_t xTaskCheckForTimeOut(TimeOut_t *timeOut, TickType_t *ticksToWait);
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t indexToWaitOn, BaseType_t clearCountOnExit,
+                                 TickType_t ticksToWait);
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t taskToNotify, UBaseType_t indexToNotify,
+                                   BaseType_t *higherPriorityTaskWoken);
+
+#endif /* INC_TASK_H */
@@ -0,0 +1,373 @@
+/******************************************************************************
+* File Name:   test_dma_rtos.c
+*
+* Description: Host test of the wait and timeout logic of dma_rtos_wait().
+*              The kernel, the DMAC response and the completion interrupt are
+*              replaced by a model that the cases drive by hand, so that
+*              completions before the wait, stale notifications and timeouts
+*              can be reproduced. Build and run it with make in this folder.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <stdio.h>
+#include "dma_rtos.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Cycles from the completion interrupt to the return of the woken task */
+#define TEST_WAKE_CYCLES                37UL
+
+/* Cycles per kernel tick of the model */
+#define TEST_TICK_CYCLES                1000UL
+
+/* Channel under test */
+#define TEST_CHANNEL                    0UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* What the DMAC does while the task is blocked */
+typedef enum
+{
+    TEST_DMAC_IDLE,                     /* Nothing completes */
+    TEST_DMAC_EARLY,                    /* Completes before the first response read */
+    TEST_DMAC_LATE,                     /* Completes as the wait times out, interrupt not served */
+    TEST_DMAC_COMPLETE,                 /* The descriptor completes after one tick */
+    TEST_DMAC_ERROR                     /* The descriptor fails after one tick */
+} test_dmac_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+SCB_Type *SCB = NULL;
+SysTick_Type *SysTick = NULL;
+DMAC_Type *DMAC = NULL;
+
+/* Model state */
+static dma_chain_callback_t g_testCallback = NULL;
+static cy_en_dmac_response_t g_testResponse = DMA_CHAIN_RESPONSE_PENDING;
+static test_dmac_t g_testDmac = TEST_DMAC_IDLE;
+static uint32_t g_testNotifications = 0UL;
+static uint32_t g_testBlocks = 0UL;
+static uint32_t g_testNow = 0UL;
+static uint32_t g_testFailures = 0UL;
+
+/*******************************************************************************
+* Kernel and PDL model
+********************************************************************************/
+
+uint32_t test_timestamp(void)
+{
+    return g_testNow;
+}
+
+static void test_interrupt(cy_en_dmac_response_t response)
+{
+    g_testResponse = response;
+    g_testCallback(TEST_CHANNEL);
+}
+
+void dma_chain_register_callback(uint32_t channel, dma_chain_callback_t callback)
+{
+    (void) channel;
+    g_testCallback = callback;
+}
+
+dma_chain_status_t dma_chain_status(cy_en_dmac_response_t response)
+{
+    return (CY_DMAC_DONE == response) ? DMA_CHAIN_STATUS_DONE :
+           (CY_DMAC_SRC_BUS_ERROR == response) ? DMA_CHAIN_STATUS_SRC_BUS_ERROR :
+           DMA_CHAIN_STATUS_TIMEOUT;
+}
+
+cy_en_dmac_response_t Cy_DMAC_Descriptor_GetResponse(DMAC_Type const *base, uint32_t channel,
+                                                     cy_en_dmac_descriptor_t descriptor)
+{
+    (void) base;
+    (void) channel;
+    (void) descriptor;
+
+    /* Completion between the waiter registration and the response check */
+    if (TEST_DMAC_EARLY == g_testDmac)
+    {
+        g_testDmac = TEST_DMAC_IDLE;
+        test_interrupt(CY_DMAC_DONE);
+    }
+    return g_testResponse;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return (TaskHandle_t) &g_testBlocks;
+}
+
+void vTaskSetTimeOutState(TimeOut_t *timeOut)
+{
+    timeOut->timeOnEntering = g_testNow / TEST_TICK_CYCLES;
+}
+
+BaseType_t xTaskCheckForTimeOut(TimeOut_t *timeOut, TickType_t *ticksToWait)
+{
+    TickType_t elapsed = (g_testNow / TEST_TICK_CYCLES) - timeOut->timeOnEntering;
+
+    if (elapsed >= *ticksToWait)
+    {
+        *ticksToWait = 0U;
+        return pdTRUE;
+    }
+    *ticksToWait -= elapsed;
+    timeOut->timeOnEntering += elapsed;
+    return pdFALSE;
+}
+
+/* Returns at once with a pending notification, otherwise blocks until the
+ * model completes the descriptor or the ticks run out */
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t indexToWaitOn, BaseType_t clearCountOnExit,
+                                 TickType_t ticksToWait)
+{
+    uint32_t count;
+
+    (void) indexToWaitOn;
+    (void) clearCountOnExit;
+
+    if (0UL == g_testNotifications)
+    {
+        g_testBlocks++;
+        if ((TEST_DMAC_IDLE == g_testDmac) || (TEST_DMAC_LATE == g_testDmac))
+        {
+            g_testNow += ticksToWait * TEST_TICK_CYCLES;
+            if (TEST_DMAC_LATE == g_testDmac)
+            {
+                g_testResponse = CY_DMAC_DONE;
+            }
+        }
+        else
+        {
+            g_testNow += TEST_TICK_CYCLES;
+            test_interrupt((TEST_DMAC_COMPLETE == g_testDmac) ? CY_DMAC_DONE : CY_DMAC_SRC_BUS_ERROR);
+            g_testNow += TEST_WAKE_CYCLES;
+        }
+    }
+
+    count = g_testNotifications;
+    g_testNotifications = 0UL;
+    return count;
+}
+
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t taskToNotify, UBaseType_t indexToNotify,
+                                   BaseType_t *higherPriorityTaskWoken)
+{
+    (void) taskToNotify;
+    (void) indexToNotify;
+    g_testNotifications++;
+    *higherPriorityTaskWoken = pdTRUE;
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return g_testNow / TEST_TICK_CYCLES;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *mutexBuffer)
+{
+    return (SemaphoreHandle_t) mutexBuffer;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return NULL;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t blockTime)
+{
+    (void) semaphore;
+    (void) blockTime;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    (void) semaphore;
+    return pdTRUE;
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    return 0UL;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    (void) savedIntrStatus;
+}
+
+void vPortEnterCritical(void)
+{
+}
+
+void vPortExitCritical(void)
+{
+}
+
+void vPortYield(void)
+{
+}
+
+/* Referenced by dma_rtos_benchmark_run(), which the test does not call */
+cy_en_dmac_status_t dma_chain_config(uint32_t channel, cy_en_dmac_descriptor_t descriptor,
+                                     const dma_chain_segment_t *segment)
+{
+    (void) channel;
+    (void) descriptor;
+    (void) segment;
+    return CY_DMAC_SUCCESS;
+}
+
+void dma_chain_start(uint32_t channel, cy_en_dmac_descriptor_t descriptor)
+{
+    (void) channel;
+    (void) descriptor;
+}
+
+void dma_chain_trigger(void)
+{
+}
+
+void dma_benchmark_csv_comment(const char *text)
+{
+    (void) text;
+}
+
+void dma_benchmark_csv_begin(const char *test)
+{
+    (void) test;
+}
+
+void dma_benchmark_csv_str(const char *value)
+{
+    (void) value;
+}
+
+void dma_benchmark_csv_u32(uint32_t value)
+{
+    (void) value;
+}
+
+void dma_benchmark_csv_end(void)
+{
+}
+
+/*******************************************************************************
+* Test cases
+********************************************************************************/
+
+static void test_check(bool condition, const char *name)
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", name);
+    if (!condition)
+    {
+        g_testFailures++;
+    }
+}
+
+static void test_start(cy_en_dmac_response_t response, test_dmac_t dmac)
+{
+    g_testResponse = response;
+    g_testDmac = dmac;
+    g_testBlocks = 0UL;
+}
+
+int main(void)
+{
+    dma_rtos_latency_t latency;
+    dma_chain_status_t status;
+
+    dma_rtos_init();
+    dma_rtos_attach(TEST_CHANNEL);
+    dma_rtos_reset_latency();
+
+    /* The completion interrupt wakes the blocked task */
+    test_start(DMA_CHAIN_RESPONSE_PENDING, TEST_DMAC_COMPLETE);
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, 5U);
+    dma_rtos_get_latency(&latency);
+    test_check((DMA_CHAIN_STATUS_DONE == status) && (1UL == g_testBlocks), "wake on completion");
+    test_check((1UL == latency.wakes) && (TEST_WAKE_CYCLES == latency.minCycles) &&
+               (TEST_WAKE_CYCLES == latency.maxCycles), "wake latency");
+
+    /* A completion before the task blocks is seen in the response without
+     * blocking, and leaves its notification behind */
+    test_start(DMA_CHAIN_RESPONSE_PENDING, TEST_DMAC_EARLY);
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, 5U);
+    test_check((DMA_CHAIN_STATUS_DONE == status) && (0UL == g_testBlocks), "completion before the wait");
+    test_check(1UL == g_testNotifications, "stale notification kept");
+
+    /* The stale notification only makes the next wait check the response
+     * again; the wait still runs to its timeout */
+    test_start(DMA_CHAIN_RESPONSE_PENDING, TEST_DMAC_IDLE);
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, 3U);
+    dma_rtos_get_latency(&latency);
+    test_check((DMA_CHAIN_STATUS_TIMEOUT == status) && (1UL == g_testBlocks), "stale notification, then timeout");
+    test_check(1UL == latency.wakes, "no latency sample without a wake");
+
+    /* A completion as the wait times out is returned, but without a wake
+     * there is no latency to record */
+    test_start(DMA_CHAIN_RESPONSE_PENDING, TEST_DMAC_LATE);
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, 3U);
+    dma_rtos_get_latency(&latency);
+    test_check((DMA_CHAIN_STATUS_DONE == status) && (1UL == latency.wakes), "completion at the timeout");
+
+    /* An error response ends the wait with the error */
+    test_start(DMA_CHAIN_RESPONSE_PENDING, TEST_DMAC_ERROR);
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, 5U);
+    test_check(DMA_CHAIN_STATUS_SRC_BUS_ERROR == status, "error response");
+
+    /* A zero timeout polls once */
+    test_start(DMA_CHAIN_RESPONSE_PENDING, TEST_DMAC_IDLE);
+    status = dma_rtos_wait(TEST_CHANNEL, CY_DMAC_DESCRIPTOR_PING, 0U);
+    test_check((DMA_CHAIN_STATUS_TIMEOUT == status) && (1UL == g_testBlocks), "zero timeout");
+
+    printf("%lu failures\n", (unsigned long) g_testFailures);
+
+    return (0UL == g_testFailures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+################################################################################
+# \file telemetry_decode.py
+# \version 1.0
+#
+# \brief
+# Decodes the binary telemetry packets in a raw serial capture. Packets are
+# COBS-encoded between zero delimiters and carry a type, a sequence number,
+# the payload and a CRC-16/CCITT. Text output between packets is skipped.
+#
+# Usage:
+#   python3 telemetry_decode.py capture.bin [--raw] [--buffers out.bin]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import binascii
+import struct
+import sys
+
+# Packet types (telemetry.h)
+TYPE_BUFFER = 0x01
+TYPE_COUNTERS = 0x02
+TYPE_USER = 0x80
+
+TYPE_NAMES = {TYPE_BUFFER: "buffer", TYPE_COUNTERS: "counters"}
+
+# CRC-16/CCITT initial value
+CRC_INIT = 0xFFFF
+
+
+def cobs_decode(data):
+    """Returns the decoded bytes, or None if the encoding is invalid."""
+    out = bytearray()
+    index = 0
+    while index < len(data):
+        code = data[index]
+        if code == 0 or index + code > len(data) + 1:
+            return None
+        out += data[index + 1:index + code]
+        index += code
+        if code < 0xFF and index < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def packets(capture):
+    """Yields (type, sequence, payload) for each valid packet, and (None, chunk,
+    None) for each non-empty chunk between delimiters that is not a packet."""
+    for chunk in capture.split(b"\x00"):
+        if not chunk:
+            continue
+        packet = cobs_decode(chunk)
+        if packet is None or len(packet) < 4:
+            yield None, chunk, None
+            continue
+        crc = struct.unpack_from("<H", packet, len(packet) - 2)[0]
+        if binascii.crc_hqx(packet[:-2], CRC_INIT) != crc:
+            yield None, chunk, None
+            continue
+        yield packet[0], packet[1], packet[2:-2]
+
+
+def describe(ptype, payload):
+    """Returns a one-line description of a payload."""
+    if ptype == TYPE_BUFFER and len(payload) >= 4:
+        address = struct.unpack_from("<I", payload)[0]
+        return "0x%08X %s" % (address, payload[4:].hex(" "))
+    if ptype == TYPE_COUNTERS and len(payload) % 4 == 0:
+        return " ".join(str(v) for v in struct.unpack("<%dI" % (len(payload) // 4), payload))
+    return payload.hex(" ")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode telemetry packets from a raw serial capture.")
+    parser.add_argument("capture", help="raw capture of the UART output")
+    parser.add_argument("--raw", action="store_true", help="print payloads as hex only")
+    parser.add_argument("--buffers", metavar="FILE",
+                        help="write the contents of buffer packets, in order, to FILE")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as capture:
+        data = capture.read()
+
+    count = 0
+    skipped = 0
+    gaps = 0
+    expected = None
+    buffers = bytearray()
+    for ptype, sequence, payload in packets(data):
+        if ptype is None:
+            # Text chunks are expected; count only chunks that look binary
+            if any(b < 0x09 or 0x0D < b < 0x20 for b in sequence):
+                skipped += 1
+            continue
+        if expected is not None and sequence != expected:
+            gaps += 1
+        expected = (sequence + 1) & 0xFF
+        count += 1
+
+        name = TYPE_NAMES.get(ptype, "user%02X" % ptype if ptype >= TYPE_USER else "type%02X" % ptype)
+        text = payload.hex(" ") if args.raw else describe(ptype, payload)
+        print("%3d %-8s %s" % (sequence, name, text))
+        if ptype == TYPE_BUFFER:
+            buffers += payload[4:]
+
+    if args.buffers:
+        with open(args.buffers, "wb") as out:
+            out.write(buffers)
+
+    print("%d packets, %d sequence gaps, %d corrupt frames" % (count, gaps, skipped), file=sys.stderr)
+    return 1 if skipped or gaps else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+################################################################################
+# \file trace_decode.py
+# \version 1.0
+#
+# \brief
+# Decodes the binary event trace dumped by event_trace.c (terminal command 't')
+# and writes Chrome trace JSON, which can be opened in Perfetto
+# (https://ui.perfetto.dev) or chrome://tracing.
+#
+# The capture may contain terminal text around the dump. Per-descriptor DMA
+# transfer spans are reconstructed from the select, trigger and completion
+# events; interrupt handlers, CPU Sleep periods and SPI and I2C transactions
+# become spans of their own, and UART FIFO levels become counter tracks. A
+# summary of interrupt durations, sleep time and channel idle gaps is printed
+# to stderr.
+#
+# Usage:
+#   python3 trace_decode.py capture.bin -o trace.json [--dump N]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import json
+import struct
+import sys
+
+# Dump format, see event_trace.c
+MAGIC = b"DTRC"
+VERSION = 1
+HEADER = struct.Struct("<4sBBHII")
+RECORD = struct.Struct("<II")
+STAMP_BITS = 24
+STAMP_MASK = (1 << STAMP_BITS) - 1
+
+# Event identifiers, see event_trace_id_t
+EVT_WRAP = 0x01
+EVT_DMA_SELECT = 0x10
+EVT_DMA_TRIGGER = 0x11
+EVT_DMA_DONE = 0x12
+EVT_DMA_RECOVER = 0x13
+EVT_ISR_ENTER = 0x20
+EVT_ISR_EXIT = 0x21
+EVT_UART_TX = 0x30
+EVT_UART_RX = 0x31
+EVT_SPI_START = 0x40
+EVT_SPI_DONE = 0x41
+EVT_I2C_START = 0x50
+EVT_I2C_DONE = 0x51
+EVT_POWER_SLEEP = 0x60
+EVT_POWER_WAKE = 0x61
+EVT_USER = 0x80
+
+DESCR_UNKNOWN = 0xFF
+DESCR_NAMES = {0: "PING", 1: "PONG"}
+RESPONSES = {0: "recovered", 1: "done", 2: "src_bus_error", 3: "dst_bus_error", 4: "src_misaligned",
+             5: "dst_misaligned", 6: "invalid_descriptor"}
+
+# Track layout of the output
+PID_DMAC = 1
+PID_CPU = 2
+PID_UART = 3
+PID_SPI = 4
+PID_I2C = 5
+
+# CPU track of Sleep periods, past the IRQ number tracks
+TID_SLEEP = 256
+
+# Status names of I2C_DONE, see i2c_dma_status_t
+I2C_STATUS = {1: "done", 2: "address_error", 3: "transfer_error"}
+
+
+def find_dumps(data):
+    """Yields (clock_hz, lost, [(id, stamp, arg)]) for every dump in a capture."""
+    offset = data.find(MAGIC)
+    while offset >= 0:
+        if offset + HEADER.size <= len(data):
+            _, version, size, count, clock, lost = HEADER.unpack_from(data, offset)
+            end = offset + HEADER.size + count * size
+            if version == VERSION and size == RECORD.size and end <= len(data):
+                records = []
+                for position in range(offset + HEADER.size, end, size):
+                    stamp, arg = RECORD.unpack_from(data, position)
+                    records.append((stamp >> STAMP_BITS, stamp & STAMP_MASK, arg))
+                yield clock, lost, records
+                offset = data.find(MAGIC, end)
+                continue
+        offset = data.find(MAGIC, offset + 1)
+
+
+def unwrap(records):
+    """Extends the 24-bit timestamps. The firmware records a wrap marker after
+    each wrap, so a timestamp smaller than its predecessor means one wrap.
+    While idle, the firmware moves the second of two markers forward instead
+    of adding more; a marker's argument is the wrap count, so the wraps since
+    the previous marker are restored from it."""
+    base = 0
+    previous = None
+    marker = None       # (wrap count, base) of the last wrap marker
+    for event, stamp, arg in records:
+        if event == EVT_WRAP and marker is not None:
+            base = marker[1] + ((arg - marker[0]) << STAMP_BITS)
+        elif previous is not None and stamp < previous:
+            base += 1 << STAMP_BITS
+        if event == EVT_WRAP:
+            marker = (arg, base)
+        previous = stamp
+        yield event, base + stamp, arg
+
+
+class Channel:
+    """Reconstructs descriptor spans of one DMAC channel."""
+
+    def __init__(self, number):
+        self.number = number
+        self.selected = 0
+        self.open = None        # (start, descriptor) of the running descriptor
+        self.chained = None     # (start, descriptor) that may follow a completion
+        self.spans = []         # (start, end, name, response)
+
+    def select(self, descriptor):
+        self.selected = descriptor
+
+    def trigger(self, time):
+        if self.open is None:
+            self.open = (time, self.selected)
+            self.chained = None
+
+    def done(self, time, descriptor, response):
+        if self.open is not None:
+            start, started = self.open
+            if descriptor == DESCR_UNKNOWN:
+                # Completion seen by the interrupt: the chain that started here
+                name = DESCR_NAMES.get(started, "?") + "+"
+                descriptor = started
+            else:
+                name = DESCR_NAMES.get(descriptor, "?")
+            self.open = None
+        elif self.chained is not None and descriptor != DESCR_UNKNOWN and descriptor == self.chained[1]:
+            # Continued from the previous descriptor of the list without a trigger
+            start = self.chained[0]
+            name = DESCR_NAMES.get(descriptor, "?")
+        else:
+            # Completion already reported by the polling path
+            return
+        self.spans.append((start, time, name, response))
+        self.selected = descriptor ^ 1
+        self.chained = (time, self.selected)
+
+    def recover(self, time):
+        # The channel was reset: the open span ends without a response
+        if self.open is not None:
+            start, started = self.open
+            self.spans.append((start, time, DESCR_NAMES.get(started, "?"), 0))
+        self.open = None
+        self.chained = None
+        self.selected = 0
+
+
+def decode(clock, records):
+    """Returns (trace events, summary lines) for one dump."""
+    scale = 1e6 / clock
+    events = []
+    channels = {}
+    isr_open = {}
+    isr_durations = []
+    spi_open = None
+    i2c_open = None
+    sleep_open = None
+    sleep_durations = []
+
+    def us(cycles):
+        return cycles * scale
+
+    def channel(arg):
+        number = (arg >> 8) & 0xFF
+        if number not in channels:
+            channels[number] = Channel(number)
+        return channels[number]
+
+    for event, time, arg in unwrap(records):
+        if event == EVT_DMA_SELECT:
+            channel(arg).select(arg & 0xFF)
+        elif event == EVT_DMA_TRIGGER:
+            channel(arg).trigger(time)
+            events.append({"name": "trigger", "ph": "i", "s": "t", "ts": us(time),
+                           "pid": PID_DMAC, "tid": (arg >> 8) & 0xFF})
+        elif event == EVT_DMA_DONE:
+            channel(arg).done(time, arg & 0xFF, (arg >> 16) & 0xFF)
+        elif event == EVT_DMA_RECOVER:
+            channel(arg).recover(time)
+            events.append({"name": "recover", "ph": "i", "s": "t", "ts": us(time),
+                           "pid": PID_DMAC, "tid": (arg >> 8) & 0xFF})
+        elif event == EVT_ISR_ENTER:
+            isr_open[arg] = time
+        elif event == EVT_ISR_EXIT and arg in isr_open:
+            start = isr_open.pop(arg)
+            isr_durations.append(time - start)
+            events.append({"name": "IRQ %d" % arg, "ph": "X", "ts": us(start), "dur": us(time - start),
+                           "pid": PID_CPU, "tid": arg})
+        elif event in (EVT_UART_TX, EVT_UART_RX):
+            name = "tx_fifo" if event == EVT_UART_TX else "rx_fifo"
+            events.append({"name": name, "ph": "C", "ts": us(time), "pid": PID_UART, "args": {"level": arg}})
+        elif event == EVT_SPI_START:
+            spi_open = (time, arg)
+        elif event == EVT_SPI_DONE and spi_open is not None:
+            start, size = spi_open
+            spi_open = None
+            events.append({"name": "%d bytes" % size, "ph": "X", "ts": us(start), "dur": us(time - start),
+                           "pid": PID_SPI, "tid": 0,
+                           "args": {"response": RESPONSES.get((arg >> 16) & 0xFF, arg >> 16),
+                                    "cycles": time - start}})
+        elif event == EVT_I2C_START:
+            i2c_open = (time, arg)
+        elif event == EVT_I2C_DONE and i2c_open is not None:
+            start, size = i2c_open
+            i2c_open = None
+            events.append({"name": "%d bytes" % size, "ph": "X", "ts": us(start), "dur": us(time - start),
+                           "pid": PID_I2C, "tid": 0,
+                           "args": {"status": I2C_STATUS.get(arg, arg), "cycles": time - start}})
+        elif event == EVT_POWER_SLEEP:
+            sleep_open = time
+        elif event == EVT_POWER_WAKE and sleep_open is not None:
+            sleep_durations.append(time - sleep_open)
+            events.append({"name": "sleep", "ph": "X", "ts": us(sleep_open), "dur": us(time - sleep_open),
+                           "pid": PID_CPU, "tid": TID_SLEEP, "args": {"channel": arg, "cycles": time - sleep_open}})
+            sleep_open = None
+        elif event >= EVT_USER:
+            events.append({"name": "user 0x%02x" % event, "ph": "i", "s": "g", "ts": us(time),
+                           "pid": PID_CPU, "args": {"arg": arg}})
+
+    summary = []
+    for number, chan in sorted(channels.items()):
+        gaps = [b[0] - a[1] for a, b in zip(chan.spans, chan.spans[1:]) if b[0] > a[1]]
+        busy = sum(end - start for start, end, _, _ in chan.spans)
+        for start, end, name, response in chan.spans:
+            events.append({"name": name, "ph": "X", "ts": us(start), "dur": us(end - start),
+                           "pid": PID_DMAC, "tid": number,
+                           "args": {"response": RESPONSES.get(response, response), "cycles": end - start}})
+        line = "channel %d: %d spans, %d busy cycles" % (number, len(chan.spans), busy)
+        if gaps:
+            line += ", idle gaps min/mean/max %d/%d/%d cycles" % (min(gaps), sum(gaps) // len(gaps), max(gaps))
+        summary.append(line)
+    if isr_durations:
+        summary.append("interrupts: %d, duration min/mean/max %d/%d/%d cycles" % (
+            len(isr_durations), min(isr_durations), sum(isr_durations) // len(isr_durations),
+            max(isr_durations)))
+    if sleep_durations:
+        summary.append("sleeps: %d, %d cycles, duration min/mean/max %d/%d/%d cycles" % (
+            len(sleep_durations), sum(sleep_durations), min(sleep_durations),
+            sum(sleep_durations) // len(sleep_durations), max(sleep_durations)))
+
+    metadata = [(PID_DMAC, "DMAC"), (PID_CPU, "CPU"), (PID_UART, "UART"), (PID_SPI, "SPI"), (PID_I2C, "I2C")]
+    for pid, name in metadata:
+        events.append({"name": "process_name", "ph": "M", "pid": pid, "args": {"name": name}})
+    for number in channels:
+        events.append({"name": "thread_name", "ph": "M", "pid": PID_DMAC, "tid": number,
+                       "args": {"name": "channel %d" % number}})
+    if sleep_durations:
+        events.append({"name": "thread_name", "ph": "M", "pid": PID_CPU, "tid": TID_SLEEP,
+                       "args": {"name": "sleep"}})
+    return events, summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an event trace dump to Chrome trace JSON.")
+    parser.add_argument("capture", help="raw serial capture containing one or more trace dumps")
+    parser.add_argument("-o", "--output", default="-", help="output JSON file (default: stdout)")
+    parser.add_argument("--dump", type=int, default=-1,
+                        help="index of the dump to decode when the capture has several (default: last)")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as capture:
+        dumps = list(find_dumps(capture.read()))
+    if not dumps:
+        sys.exit("no trace dump found in %s" % args.capture)
+
+    clock, lost, records = dumps[args.dump]
+    events, summary = decode(clock, records)
+    print("%d records at %d Hz, %d lost to overwrites" % (len(records), clock, lost), file=sys.stderr)
+    for line in summary:
+        print(line, file=sys.stderr)
+
+    trace = {"traceEvents": events, "displayTimeUnit": "ns", "otherData": {"clock_hz": clock, "lost": lost}}
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as output:
+            json.dump(trace, output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
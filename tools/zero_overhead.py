@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+################################################################################
+# \file zero_overhead.py
+# \version 1.0
+#
+# \brief
+# Compares the disassembly of C reference functions with their C++
+# counterparts, e.g. dma_transfer_check_configure_c and
+# dma_transfer_check_configure_cpp, and fails when a pair differs.
+# Addresses are dropped and branch targets compared by name and offset,
+# so only differences in the generated code are reported. The functions
+# may be spread over several files, e.g. the object of the C reference
+# and the object of the C++ counterpart.
+#
+# Usage:
+#   python3 zero_overhead.py <object file or ELF> ... [--pair C CPP ...]
+#
+################################################################################
+# \copyright
+# (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import difflib
+import re
+import subprocess
+import sys
+
+# Default disassembler of the GCC_ARM toolchain
+OBJDUMP = "arm-none-eabi-objdump"
+
+# Function label, instruction or relocation line of objdump -dr output
+LABEL = re.compile(r"^[0-9a-fA-F]+ <([^>]+)>:$")
+LINE = re.compile(r"^\s+[0-9a-fA-F]+:\s+(.*)$")
+
+# Symbolic address operand, e.g. "1c <dma_transfer_check_c+0x1c>"
+TARGET = re.compile(r"(?:0x)?[0-9a-fA-F]+ <([^>+]+)(\+0x[0-9a-fA-F]+)?>")
+
+# Trailing comments: "@ ..." (ARM), "; ..." and "# ..." (other targets)
+COMMENT = re.compile(r"\s+(?:@|;|#\s).*$")
+
+# Reference functions end in _c and the C++ functions in _cpp
+SUFFIX_C = "_c"
+SUFFIX_CPP = "_cpp"
+
+
+def disassemble(objdump, path):
+    """Returns {function: [normalized lines]} for a file."""
+    output = subprocess.run([objdump, "-dr", "--no-show-raw-insn", path], check=True,
+                            stdout=subprocess.PIPE, universal_newlines=True).stdout
+    functions = {}
+    current = None
+    for line in output.splitlines():
+        match = LABEL.match(line)
+        if match:
+            current = match.group(1)
+            functions[current] = []
+            continue
+        match = LINE.match(line)
+        if current is None or not match:
+            continue
+        text = COMMENT.sub("", match.group(1))
+        # Branches within the function compare by offset, other targets by name
+        text = TARGET.sub(lambda m: "<%s%s>" % ("." if m.group(1) == current else m.group(1),
+                                                m.group(2) or ""), text)
+        functions[current].append(" ".join(text.split()))
+    return functions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Check that C++ wrapper functions compile to the same code as their C references.")
+    parser.add_argument("files", nargs="+", metavar="file", help="object files or ELF containing the functions")
+    parser.add_argument("--pair", nargs=2, action="append", metavar=("C", "CPP"),
+                        help="functions to compare (default: every NAME_c with a NAME_cpp)")
+    parser.add_argument("--objdump", default=OBJDUMP, help="disassembler (default: %s)" % OBJDUMP)
+    args = parser.parse_args()
+
+    functions = {}
+    for path in args.files:
+        functions.update(disassemble(args.objdump, path))
+    files = " ".join(args.files)
+    pairs = args.pair
+    if not pairs:
+        pairs = [(name, name[:-len(SUFFIX_C)] + SUFFIX_CPP) for name in sorted(functions)
+                 if name.endswith(SUFFIX_C) and (name[:-len(SUFFIX_C)] + SUFFIX_CPP) in functions]
+    if not pairs:
+        sys.exit("no function pairs found in %s" % files)
+
+    failed = 0
+    for reference, wrapper in pairs:
+        for name in (reference, wrapper):
+            if name not in functions:
+                sys.exit("function %s not found in %s" % (name, files))
+        expected, actual = functions[reference], functions[wrapper]
+        if expected == actual:
+            print("same  %s / %s: %d lines" % (reference, wrapper, len(expected)))
+            continue
+        failed += 1
+        print("DIFF  %s / %s: %d / %d lines" % (reference, wrapper, len(expected), len(actual)))
+        for line in difflib.unified_diff(expected, actual, reference, wrapper, lineterm=""):
+            print("      " + line)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
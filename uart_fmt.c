@@ -0,0 +1,757 @@
+/******************************************************************************
+* File Name:   uart_fmt.c
+*
+* Description: This file contains a formatted output layer for UART_HW that does
+*              not use printf. Fields are formatted into a buffer on the stack and
+*              written to the TX FIFO. Decimal conversion subtracts powers of ten,
+*              because the Cortex-M0+ has no divide instruction and every library
+*              division costs a call to the runtime.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "uart_fmt.h"
+#include "dma_benchmark.h"
+#include "cycle_count.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Decimal digits of a uint32_t */
+#define UART_FMT_U32_DIGITS             10U
+
+/* Hexadecimal digits of a uint32_t */
+#define UART_FMT_HEX_DIGITS             8U
+
+/* Printable ASCII range of the hex dump */
+#define UART_FMT_ASCII_FIRST            0x20U
+#define UART_FMT_ASCII_LAST             0x7EU
+
+/* Number of runs per field of the benchmark. The fastest run is reported. */
+#define UART_FMT_BENCHMARK_REPEAT       4UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Conversion under test */
+typedef enum
+{
+    UART_FMT_FIELD_U32,
+    UART_FMT_FIELD_U32_DIV,
+    UART_FMT_FIELD_I32,
+    UART_FMT_FIELD_HEX,
+    UART_FMT_FIELD_FIXED,
+    UART_FMT_FIELD_HEXDUMP
+} uart_fmt_field_t;
+
+/* Field of the benchmark */
+typedef struct
+{
+    uart_fmt_field_t kind;
+    const char *field;
+    const char *method;
+    uint32_t value;
+    uint32_t param;
+} uart_fmt_benchmark_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Powers of ten, highest first */
+static const uint32_t g_uartFmtPow10[UART_FMT_U32_DIGITS] =
+{
+    1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+    10000UL, 1000UL, 100UL, 10UL, 1UL
+};
+
+/* Hexadecimal digit characters */
+static const char g_uartFmtHex[16] = "0123456789ABCDEF";
+
+/* A write timed out and the TX FIFO has not taken a character since */
+static bool g_uartFmtStalled = false;
+
+/* Fields of the benchmark */
+static const uart_fmt_benchmark_t g_uartFmtBenchmarks[] =
+{
+    { UART_FMT_FIELD_U32,     "u32",     "table", 0UL,          0UL },
+    { UART_FMT_FIELD_U32,     "u32",     "table", 12345UL,      0UL },
+    { UART_FMT_FIELD_U32,     "u32",     "table", 4294967295UL, 0UL },
+    { UART_FMT_FIELD_U32_DIV, "u32",     "div",   0UL,          0UL },
+    { UART_FMT_FIELD_U32_DIV, "u32",     "div",   12345UL,      0UL },
+    { UART_FMT_FIELD_U32_DIV, "u32",     "div",   4294967295UL, 0UL },
+    { UART_FMT_FIELD_I32,     "i32",     "table", 0x80000000UL, 0UL },
+    { UART_FMT_FIELD_HEX,     "hex",     "table", 0xDEADBEEFUL, 8UL },
+    { UART_FMT_FIELD_FIXED,   "fixed",   "table", 0xFFFE1DC0UL, 3UL },
+    { UART_FMT_FIELD_HEXDUMP, "hexdump", "table", 0UL,          UART_FMT_HEXDUMP_WIDTH }
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static uint32_t uart_fmt_digits_to(char *buffer, uint32_t value, uint32_t minDigits);
+static uint32_t uart_fmt_hexdump_line_to(char *line, const uint8_t *data, uint32_t size,
+                                         uint32_t address);
+static uint32_t uart_fmt_div_to(char *buffer, uint32_t value);
+static uint32_t uart_fmt_benchmark_field(const uart_fmt_benchmark_t *field, char *buffer);
+
+/********************************************************************************
+* Function Name: uart_fmt_u32_to
+*********************************************************************************
+* Summary:
+* Formats an unsigned decimal number.
+*
+* Parameters:
+*  buffer: Destination of at least UART_FMT_FIELD_SIZE characters
+*  value: Number to format
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+uint32_t uart_fmt_u32_to(char *buffer, uint32_t value)
+{
+    return uart_fmt_digits_to(buffer, value, 1UL);
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_i32_to
+*********************************************************************************
+* Summary:
+* Formats a signed decimal number.
+*
+* Parameters:
+*  buffer: Destination of at least UART_FMT_FIELD_SIZE characters
+*  value: Number to format
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+uint32_t uart_fmt_i32_to(char *buffer, int32_t value)
+{
+    uint32_t magnitude = (uint32_t) value;
+    uint32_t length = 0UL;
+
+    if (value < 0)
+    {
+        buffer[length++] = '-';
+        magnitude = 0UL - magnitude;
+    }
+
+    return length + uart_fmt_digits_to(&buffer[length], magnitude, 1UL);
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_hex_to
+*********************************************************************************
+* Summary:
+* Formats a hexadecimal number with upper-case digits and no prefix.
+*
+* Parameters:
+*  buffer: Destination of at least UART_FMT_FIELD_SIZE characters
+*  value: Number to format
+*  digits: Number of digits (1 to 8), or 0 for as many as needed
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+uint32_t uart_fmt_hex_to(char *buffer, uint32_t value, uint32_t digits)
+{
+    uint32_t length = 0UL;
+    int32_t shift;
+
+    if (0UL == digits)
+    {
+        digits = 1UL;
+        while ((digits < UART_FMT_HEX_DIGITS) && (0UL != (value >> (digits * 4UL))))
+        {
+            digits++;
+        }
+    }
+    else if (digits > UART_FMT_HEX_DIGITS)
+    {
+        digits = UART_FMT_HEX_DIGITS;
+    }
+    else
+    {
+        /* Fixed width as requested */
+    }
+
+    for (shift = (int32_t) ((digits - 1UL) * 4UL); shift >= 0; shift -= 4)
+    {
+        buffer[length++] = g_uartFmtHex[(value >> (uint32_t) shift) & 0xFUL];
+    }
+
+    return length;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_fixed_to
+*********************************************************************************
+* Summary:
+* Formats a fixed-point decimal number. The value is the number scaled by
+* 10^fracDigits; for example, -12345 with 3 fractional digits is "-12.345".
+*
+* Parameters:
+*  buffer: Destination of at least UART_FMT_FIELD_SIZE characters
+*  value: Scaled number
+*  fracDigits: Number of fractional digits (0 to UART_FMT_FIXED_MAX_FRAC)
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+uint32_t uart_fmt_fixed_to(char *buffer, int32_t value, uint32_t fracDigits)
+{
+    uint32_t magnitude = (uint32_t) value;
+    uint32_t length = 0UL;
+    uint32_t digits;
+    uint32_t i;
+
+    if (fracDigits > UART_FMT_FIXED_MAX_FRAC)
+    {
+        fracDigits = UART_FMT_FIXED_MAX_FRAC;
+    }
+
+    if (value < 0)
+    {
+        buffer[length++] = '-';
+        magnitude = 0UL - magnitude;
+    }
+
+    digits = uart_fmt_digits_to(&buffer[length], magnitude, fracDigits + 1UL);
+    length += digits;
+
+    if (0UL != fracDigits)
+    {
+        /* Move the fractional digits up by one and insert the point */
+        for (i = 0UL; i < fracDigits; i++)
+        {
+            buffer[length - i] = buffer[length - i - 1UL];
+        }
+        buffer[length - fracDigits] = '.';
+        length++;
+    }
+
+    return length;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_char
+*********************************************************************************
+* Summary:
+* Writes a character to UART_HW.
+*
+* Parameters:
+*  character: Character to write
+*
+* Return:
+*  bool: true if the character is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_char(char character)
+{
+    return (1UL == uart_fmt_chars(&character, 1UL));
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_str
+*********************************************************************************
+* Summary:
+* Writes a null-terminated string to UART_HW.
+*
+* Parameters:
+*  text: String to write
+*
+* Return:
+*  bool: true if the string is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_str(const char *text)
+{
+    uint32_t length = (uint32_t) strlen(text);
+
+    return (length == uart_fmt_chars(text, length));
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_u32
+*********************************************************************************
+* Summary:
+* Writes an unsigned decimal number to UART_HW.
+*
+* Parameters:
+*  value: Number to write
+*
+* Return:
+*  bool: true if the field is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_u32(uint32_t value)
+{
+    char field[UART_FMT_FIELD_SIZE];
+    uint32_t length = uart_fmt_u32_to(field, value);
+
+    return (length == uart_fmt_chars(field, length));
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_i32
+*********************************************************************************
+* Summary:
+* Writes a signed decimal number to UART_HW.
+*
+* Parameters:
+*  value: Number to write
+*
+* Return:
+*  bool: true if the field is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_i32(int32_t value)
+{
+    char field[UART_FMT_FIELD_SIZE];
+    uint32_t length = uart_fmt_i32_to(field, value);
+
+    return (length == uart_fmt_chars(field, length));
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_hex
+*********************************************************************************
+* Summary:
+* Writes a hexadecimal number to UART_HW.
+*
+* Parameters:
+*  value: Number to write
+*  digits: Number of digits (1 to 8), or 0 for as many as needed
+*
+* Return:
+*  bool: true if the field is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_hex(uint32_t value, uint32_t digits)
+{
+    char field[UART_FMT_FIELD_SIZE];
+    uint32_t length = uart_fmt_hex_to(field, value, digits);
+
+    return (length == uart_fmt_chars(field, length));
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_fixed
+*********************************************************************************
+* Summary:
+* Writes a fixed-point decimal number to UART_HW.
+*
+* Parameters:
+*  value: Number scaled by 10^fracDigits
+*  fracDigits: Number of fractional digits (0 to UART_FMT_FIXED_MAX_FRAC)
+*
+* Return:
+*  bool: true if the field is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_fixed(int32_t value, uint32_t fracDigits)
+{
+    char field[UART_FMT_FIELD_SIZE];
+    uint32_t length = uart_fmt_fixed_to(field, value, fracDigits);
+
+    return (length == uart_fmt_chars(field, length));
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_hexdump
+*********************************************************************************
+* Summary:
+* Writes a hex dump to UART_HW, UART_FMT_HEXDUMP_WIDTH bytes per line with
+* the address and an ASCII column. Stops at the first line the UART does not
+* take.
+*
+* Parameters:
+*  data: Data to dump
+*  size: Number of bytes
+*  address: Address printed for the first byte
+*
+* Return:
+*  bool: true if the dump is in the TX FIFO, false if the UART stalled
+*
+********************************************************************************/
+bool uart_fmt_hexdump(const void *data, uint32_t size, uint32_t address)
+{
+    char line[UART_FMT_HEXDUMP_LINE_SIZE];
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t chunk;
+    uint32_t length;
+    bool written = true;
+
+    while (written && (0UL != size))
+    {
+        chunk = (size < UART_FMT_HEXDUMP_WIDTH) ? size : UART_FMT_HEXDUMP_WIDTH;
+        length = uart_fmt_hexdump_line_to(line, bytes, chunk, address);
+        written = (length == uart_fmt_chars(line, length));
+
+        bytes += chunk;
+        address += chunk;
+        size -= chunk;
+    }
+
+    return written;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_chars
+*********************************************************************************
+* Summary:
+* Writes characters to UART_HW, waiting at most UART_FMT_TIMEOUT_MS for TX
+* FIFO space for each. Stops at the first character that times out. After a
+* timeout, later writes do not wait until the FIFO takes a character again,
+* so a stalled UART costs one timeout instead of one per field.
+*
+* Parameters:
+*  data: Characters to write
+*  size: Number of characters
+*
+* Return:
+*  uint32_t: Number of characters placed in the TX FIFO
+*
+********************************************************************************/
+uint32_t uart_fmt_chars(const char *data, uint32_t size)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(UART_FMT_TIMEOUT_MS);
+    uint32_t start;
+    uint32_t count = 0UL;
+    bool placed = true;
+
+    while (placed && (count < size))
+    {
+        start = cycle_count_now();
+        while (0UL == Cy_SCB_UART_Put(UART_HW, (uint32_t) (uint8_t) data[count]))
+        {
+            if (g_uartFmtStalled || cycle_count_expired(start, timeout))
+            {
+                g_uartFmtStalled = true;
+                placed = false;
+                break;
+            }
+        }
+
+        if (placed)
+        {
+            g_uartFmtStalled = false;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_flush
+*********************************************************************************
+* Summary:
+* Waits until the TX FIFO and the shift register of UART_HW are empty, for at
+* most UART_FMT_TIMEOUT_MS.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the transmission completed, false on timeout
+*
+********************************************************************************/
+bool uart_fmt_flush(void)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(UART_FMT_TIMEOUT_MS);
+    uint32_t start = cycle_count_now();
+    bool complete;
+
+    do
+    {
+        complete = Cy_SCB_UART_IsTxComplete(UART_HW);
+    } while (!complete && !cycle_count_expired(start, timeout));
+
+    return complete;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_benchmark_run
+*********************************************************************************
+* Summary:
+* Measures the cycles to format each field into a buffer, without the UART
+* transfer, and writes them as CSV. The "div" rows use the conventional
+* divide-by-ten conversion for comparison.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_fmt_benchmark_run(void)
+{
+    char buffer[UART_FMT_HEXDUMP_LINE_SIZE];
+    uint32_t best;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t length = 0UL;
+    uint32_t f;
+    uint32_t run;
+
+    dma_benchmark_csv_comment("uart_fmt");
+    dma_benchmark_csv_begin("test");
+    dma_benchmark_csv_str("field");
+    dma_benchmark_csv_str("value");
+    dma_benchmark_csv_str("method");
+    dma_benchmark_csv_str("cycles");
+    dma_benchmark_csv_str("chars");
+    dma_benchmark_csv_end();
+
+    for (f = 0UL; f < (sizeof(g_uartFmtBenchmarks) / sizeof(g_uartFmtBenchmarks[0])); f++)
+    {
+        best = UINT32_MAX;
+        for (run = 0UL; run < UART_FMT_BENCHMARK_REPEAT; run++)
+        {
+            start = cycle_count_now();
+            length = uart_fmt_benchmark_field(&g_uartFmtBenchmarks[f], buffer);
+            cycles = cycle_count_elapsed(start);
+            best = (cycles < best) ? cycles : best;
+        }
+
+        dma_benchmark_csv_begin("fmt");
+        dma_benchmark_csv_str(g_uartFmtBenchmarks[f].field);
+        dma_benchmark_csv_u32(g_uartFmtBenchmarks[f].value);
+        dma_benchmark_csv_str(g_uartFmtBenchmarks[f].method);
+        dma_benchmark_csv_u32(best);
+        dma_benchmark_csv_u32(length);
+        dma_benchmark_csv_end();
+    }
+
+    dma_benchmark_csv_comment("end");
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_digits_to
+*********************************************************************************
+* Summary:
+* Decimal conversion by repeated subtraction of powers of ten. Each digit
+* takes at most nine subtractions, which is cheaper on the Cortex-M0+ than a
+* library division per digit.
+*
+* Parameters:
+*  buffer: Destination of at least UART_FMT_U32_DIGITS characters
+*  value: Number to format
+*  minDigits: Minimum number of digits, padded with leading zeros
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+static uint32_t uart_fmt_digits_to(char *buffer, uint32_t value, uint32_t minDigits)
+{
+    uint32_t length = 0UL;
+    uint32_t i = 0UL;
+    uint32_t power;
+    char digit;
+
+    /* Skip leading zeros */
+    while ((i < (UART_FMT_U32_DIGITS - minDigits)) && (value < g_uartFmtPow10[i]))
+    {
+        i++;
+    }
+
+    for (; i < UART_FMT_U32_DIGITS; i++)
+    {
+        power = g_uartFmtPow10[i];
+        digit = '0';
+        while (value >= power)
+        {
+            value -= power;
+            digit++;
+        }
+        buffer[length++] = digit;
+    }
+
+    return length;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_hexdump_line_to
+*********************************************************************************
+* Summary:
+* Formats one hex dump line, including CRLF.
+*
+* Parameters:
+*  line: Destination of UART_FMT_HEXDUMP_LINE_SIZE characters
+*  data: Bytes of the line
+*  size: Number of bytes (1 to UART_FMT_HEXDUMP_WIDTH)
+*  address: Address of the first byte
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+static uint32_t uart_fmt_hexdump_line_to(char *line, const uint8_t *data, uint32_t size,
+                                         uint32_t address)
+{
+    uint32_t length = uart_fmt_hex_to(line, address, UART_FMT_HEX_DIGITS);
+    uint32_t i;
+
+    line[length++] = ':';
+    line[length++] = ' ';
+
+    for (i = 0UL; i < UART_FMT_HEXDUMP_WIDTH; i++)
+    {
+        if (i < size)
+        {
+            line[length++] = g_uartFmtHex[data[i] >> 4U];
+            line[length++] = g_uartFmtHex[data[i] & 0xFU];
+        }
+        else
+        {
+            line[length++] = ' ';
+            line[length++] = ' ';
+        }
+        line[length++] = ' ';
+    }
+
+    line[length++] = ' ';
+    for (i = 0UL; i < size; i++)
+    {
+        line[length++] = ((data[i] >= UART_FMT_ASCII_FIRST) && (data[i] <= UART_FMT_ASCII_LAST)) ?
+                         (char) data[i] : '.';
+    }
+
+    line[length++] = '\r';
+    line[length++] = '\n';
+
+    return length;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_div_to
+*********************************************************************************
+* Summary:
+* Reference decimal conversion with a division and a modulo per digit.
+*
+* Parameters:
+*  buffer: Destination of at least UART_FMT_U32_DIGITS characters
+*  value: Number to format
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+static uint32_t uart_fmt_div_to(char *buffer, uint32_t value)
+{
+    char digits[UART_FMT_U32_DIGITS];
+    uint32_t pos = UART_FMT_U32_DIGITS;
+    uint32_t length = 0UL;
+
+    do
+    {
+        pos--;
+        digits[pos] = (char) ('0' + (value % 10UL));
+        value /= 10UL;
+    } while (0UL != value);
+
+    while (pos < UART_FMT_U32_DIGITS)
+    {
+        buffer[length++] = digits[pos++];
+    }
+
+    return length;
+}
+
+/********************************************************************************
+* Function Name: uart_fmt_benchmark_field
+*********************************************************************************
+* Summary:
+* Formats one benchmark field into a buffer.
+*
+* Parameters:
+*  field: Field of the benchmark
+*  buffer: Destination of UART_FMT_HEXDUMP_LINE_SIZE characters
+*
+* Return:
+*  uint32_t: Number of characters written
+*
+********************************************************************************/
+static uint32_t uart_fmt_benchmark_field(const uart_fmt_benchmark_t *field, char *buffer)
+{
+    uint32_t length;
+
+    switch (field->kind)
+    {
+        case UART_FMT_FIELD_U32:
+            length = uart_fmt_u32_to(buffer, field->value);
+            break;
+
+        case UART_FMT_FIELD_U32_DIV:
+            length = uart_fmt_div_to(buffer, field->value);
+            break;
+
+        case UART_FMT_FIELD_I32:
+            length = uart_fmt_i32_to(buffer, (int32_t) field->value);
+            break;
+
+        case UART_FMT_FIELD_FIXED:
+            length = uart_fmt_fixed_to(buffer, (int32_t) field->value, field->param);
+            break;
+
+        case UART_FMT_FIELD_HEXDUMP:
+            /* Dumps the power-of-ten table as sample data */
+            length = uart_fmt_hexdump_line_to(buffer, (const uint8_t *) g_uartFmtPow10, field->param,
+                                              (uint32_t) (uintptr_t) g_uartFmtPow10);
+            break;
+
+        default:
+            length = uart_fmt_hex_to(buffer, field->value, field->param);
+            break;
+    }
+
+    return length;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,111 @@
+/******************************************************************************
+* File Name:   uart_fmt.h
+*
+* Description: Public interface of the formatted UART output layer.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef UART_FMT_H
+#define UART_FMT_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Largest field written by the uart_fmt_*_to() functions, in characters:
+ * a sign, ten digits and a decimal point. No terminator is written. */
+#define UART_FMT_FIELD_SIZE             12U
+
+/* Largest number of fractional digits of uart_fmt_fixed() */
+#define UART_FMT_FIXED_MAX_FRAC         9U
+
+/* Bytes per line of uart_fmt_hexdump() */
+#define UART_FMT_HEXDUMP_WIDTH          16U
+
+/* Characters of a hex dump line: eight address digits, ": ", three per byte,
+ * a space, the ASCII column and CRLF */
+#define UART_FMT_HEXDUMP_LINE_SIZE      (8U + 2U + (3U * UART_FMT_HEXDUMP_WIDTH) + 1U + \
+                                         UART_FMT_HEXDUMP_WIDTH + 2U)
+
+/* Bound of the bounded waits for TX FIFO space and for the end of
+ * transmission. A full FIFO drains well within it at 9600 baud. */
+#ifndef UART_FMT_TIMEOUT_MS
+#define UART_FMT_TIMEOUT_MS             50UL
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+/* Formatting into a caller buffer of at least UART_FMT_FIELD_SIZE characters.
+ * Each function returns the number of characters written. */
+uint32_t uart_fmt_u32_to(char *buffer, uint32_t value);
+uint32_t uart_fmt_i32_to(char *buffer, int32_t value);
+uint32_t uart_fmt_hex_to(char *buffer, uint32_t value, uint32_t digits);
+uint32_t uart_fmt_fixed_to(char *buffer, int32_t value, uint32_t fracDigits);
+
+/* Formatting to UART_HW through uart_fmt_chars(). Each function returns false
+ * if the UART stalled before the whole field was in the TX FIFO. */
+bool uart_fmt_char(char character);
+bool uart_fmt_str(const char *text);
+bool uart_fmt_u32(uint32_t value);
+bool uart_fmt_i32(int32_t value);
+bool uart_fmt_hex(uint32_t value, uint32_t digits);
+bool uart_fmt_fixed(int32_t value, uint32_t fracDigits);
+bool uart_fmt_hexdump(const void *data, uint32_t size, uint32_t address);
+
+/* Bounded waits, so that output cannot hang on a stalled UART */
+uint32_t uart_fmt_chars(const char *data, uint32_t size);
+bool uart_fmt_flush(void);
+
+void uart_fmt_benchmark_run(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_FMT_H */
+
+/* [] END OF FILE */
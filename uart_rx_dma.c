@@ -0,0 +1,459 @@
+/******************************************************************************
+* File Name:   uart_rx_dma.c
+*
+* Description: This file contains the DMA-based UART receiver. The SCB RX FIFO
+*              request triggers one single-element DMA transfer per received byte,
+*              so the CPU is not interrupted per byte. PING and PONG each own a
+*              receive buffer; the channel flips to the other buffer when one is
+*              full, and uart_rx_dma_poll() closes a partially filled buffer when
+*              the line has been idle for UART_RX_DMA_IDLE_CHARS characters.
+*
+*              A closed buffer belongs to the application until it is released.
+*              If both buffers are closed, the channel stops and received data
+*              stays in the RX FIFO until a buffer is released; bytes beyond the
+*              FIFO depth are counted as FIFO overruns.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include <string.h>
+#include "uart_rx_dma.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* Bits per character at 8N1 */
+#define UART_RX_DMA_BITS_PER_CHAR       10UL
+
+/* Trigger the DMA as soon as the RX FIFO holds one byte */
+#define UART_RX_DMA_FIFO_LEVEL          0UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Receive buffer state */
+typedef struct
+{
+    uint32_t length;                    /* Bytes in a closed buffer */
+    bool armed;                         /* Descriptor owns the buffer */
+    bool ready;                         /* Closed, owned by the application */
+} uart_rx_dma_buffer_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Receive buffers, buffer 0 on PING and buffer 1 on PONG */
+static uint8_t g_uartRxData[UART_RX_DMA_BUFFERS][UART_RX_DMA_BUFFER_SIZE];
+static volatile uart_rx_dma_buffer_t g_uartRxBuffers[UART_RX_DMA_BUFFERS];
+
+/* Buffer the channel is filling, and the next buffer to deliver */
+static volatile uint32_t g_uartRxActive = 0UL;
+static uint32_t g_uartRxDeliver = 0UL;
+
+/* Channel stopped because no buffer was free */
+static volatile bool g_uartRxStalled = false;
+
+/* Idle detection */
+static uint32_t g_uartRxIdleCycles = 0UL;
+static uint32_t g_uartRxLastIndex = 0UL;
+static uint32_t g_uartRxLastActivity = 0UL;
+
+/* Statistics */
+static volatile uart_rx_dma_stats_t g_uartRxStats;
+
+/* Descriptor of each buffer */
+static const cy_en_dmac_descriptor_t g_uartRxDescriptors[UART_RX_DMA_BUFFERS] =
+{
+    CY_DMAC_DESCRIPTOR_PING,
+    CY_DMAC_DESCRIPTOR_PONG
+};
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void uart_rx_dma_arm(uint32_t buffer);
+static void uart_rx_dma_close(uint32_t length);
+static void uart_rx_dma_callback(uint32_t channel);
+
+/********************************************************************************
+* Function Name: uart_rx_dma_init
+*********************************************************************************
+* Summary:
+* Routes the UART RX FIFO request to the receiver channel, arms both buffers
+* and starts reception. UART_HW must be initialized and the DMAC enabled.
+*
+* Parameters:
+*  baudRate: Baud rate of UART_HW, used for the idle timeout
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_rx_dma_init(uint32_t baudRate)
+{
+    const cy_stc_dmac_channel_config_t channelConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = UART_RX_DMA_PRIORITY,
+        .enable     = false
+    };
+    uint32_t i;
+
+    g_uartRxIdleCycles = (SystemCoreClock / baudRate) * UART_RX_DMA_BITS_PER_CHAR * UART_RX_DMA_IDLE_CHARS;
+    g_uartRxActive = 0UL;
+    g_uartRxDeliver = 0UL;
+    g_uartRxStalled = false;
+    g_uartRxLastIndex = 0UL;
+    (void) memset((void *) &g_uartRxStats, 0, sizeof(g_uartRxStats));
+
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, UART_RX_DMA_CHANNEL, &channelConfig);
+    for (i = 0UL; i < UART_RX_DMA_BUFFERS; i++)
+    {
+        g_uartRxBuffers[i].ready = false;
+        uart_rx_dma_arm(i);
+    }
+    dma_chain_register_callback(UART_RX_DMA_CHANNEL, uart_rx_dma_callback);
+
+    Cy_SCB_SetRxFifoLevel(UART_HW, UART_RX_DMA_FIFO_LEVEL);
+    Cy_SCB_ClearRxInterrupt(UART_HW, CY_SCB_UART_RX_OVERFLOW);
+    dma_chain_connect(UART_RX_DMA_CHANNEL, UART_RX_DMA_TRIGGER_IN, UART_RX_DMA_TRIGGER_OUT);
+
+    g_uartRxLastActivity = cycle_count_now();
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_suspend
+*********************************************************************************
+* Summary:
+* Stops reception, so that UART_HW can be read by polling or reinitialized.
+* Received data stays in the current buffer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_rx_dma_suspend(void)
+{
+    Cy_DMAC_Channel_Disable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_resume
+*********************************************************************************
+* Summary:
+* Restarts reception after uart_rx_dma_suspend(), restoring the RX FIFO
+* trigger level in case UART_HW was reinitialized.
+*
+* Parameters:
+*  baudRate: Baud rate of UART_HW, used for the idle timeout
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_rx_dma_resume(uint32_t baudRate)
+{
+    g_uartRxIdleCycles = (SystemCoreClock / baudRate) * UART_RX_DMA_BITS_PER_CHAR * UART_RX_DMA_IDLE_CHARS;
+
+    Cy_SCB_SetRxFifoLevel(UART_HW, UART_RX_DMA_FIFO_LEVEL);
+    Cy_SCB_ClearRxInterrupt(UART_HW, CY_SCB_UART_RX_OVERFLOW);
+
+    g_uartRxLastActivity = cycle_count_now();
+    if (!g_uartRxStalled)
+    {
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+    }
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_poll
+*********************************************************************************
+* Summary:
+* Closes the active buffer when data was received and the line has been idle
+* for the idle timeout, and accounts RX FIFO overruns. Call at least once per
+* character time, for example from the main loop.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_rx_dma_poll(void)
+{
+    uint32_t index;
+    uint32_t interruptState;
+
+    if (0UL != (Cy_SCB_GetRxInterruptStatus(UART_HW) & CY_SCB_UART_RX_OVERFLOW))
+    {
+        Cy_SCB_ClearRxInterrupt(UART_HW, CY_SCB_UART_RX_OVERFLOW);
+        g_uartRxStats.fifoOverruns++;
+    }
+
+    if (g_uartRxStalled)
+    {
+        return;
+    }
+
+    index = dma_chain_get_index(UART_RX_DMA_CHANNEL);
+    if (index != g_uartRxLastIndex)
+    {
+        g_uartRxLastIndex = index;
+        g_uartRxLastActivity = cycle_count_now();
+    }
+    else if ((0UL != index) && (cycle_count_elapsed(g_uartRxLastActivity) >= g_uartRxIdleCycles))
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+
+        /* The descriptor may have completed since the index was read */
+        index = dma_chain_get_index(UART_RX_DMA_CHANNEL);
+        if ((0UL != index) && !g_uartRxStalled)
+        {
+            Cy_DMAC_Channel_Disable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+            index = dma_chain_get_index(UART_RX_DMA_CHANNEL);
+            g_uartRxStats.idleFrames++;
+            uart_rx_dma_close(index);
+        }
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+    else
+    {
+        /* Still receiving, or nothing received */
+    }
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_get_frame
+*********************************************************************************
+* Summary:
+* Returns the oldest received frame. The buffer stays valid until
+* uart_rx_dma_release() is called.
+*
+* Parameters:
+*  length: Returns the frame length in bytes
+*
+* Return:
+*  const uint8_t*: Frame data, or NULL when no frame is available
+*
+********************************************************************************/
+const uint8_t *uart_rx_dma_get_frame(uint32_t *length)
+{
+    const uint8_t *frame = NULL;
+
+    if (g_uartRxBuffers[g_uartRxDeliver].ready)
+    {
+        *length = g_uartRxBuffers[g_uartRxDeliver].length;
+        frame = g_uartRxData[g_uartRxDeliver];
+    }
+
+    return frame;
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_release
+*********************************************************************************
+* Summary:
+* Returns the frame obtained with uart_rx_dma_get_frame() to the receiver and
+* restarts the channel if it stopped for lack of a buffer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_rx_dma_release(void)
+{
+    uint32_t buffer = g_uartRxDeliver;
+    uint32_t interruptState;
+
+    if (g_uartRxBuffers[buffer].ready)
+    {
+        g_uartRxStats.frames++;
+        g_uartRxStats.bytes += g_uartRxBuffers[buffer].length;
+
+        interruptState = Cy_SysLib_EnterCriticalSection();
+
+        g_uartRxBuffers[buffer].ready = false;
+        uart_rx_dma_arm(buffer);
+        g_uartRxDeliver = buffer ^ 1UL;
+
+        if (g_uartRxStalled)
+        {
+            g_uartRxStalled = false;
+            g_uartRxLastIndex = 0UL;
+            g_uartRxLastActivity = cycle_count_now();
+            dma_chain_start(UART_RX_DMA_CHANNEL, g_uartRxDescriptors[g_uartRxActive]);
+            Cy_DMAC_Channel_Enable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+        }
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_get_stats
+*********************************************************************************
+* Summary:
+* Copies the receiver statistics.
+*
+* Parameters:
+*  stats: Destination of the statistics
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_rx_dma_get_stats(uart_rx_dma_stats_t *stats)
+{
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+    *stats = g_uartRxStats;
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_arm
+*********************************************************************************
+* Summary:
+* Configures the descriptor of a buffer for a full buffer of single-element
+* transfers from the RX FIFO.
+*
+* Parameters:
+*  buffer: Buffer index
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void uart_rx_dma_arm(uint32_t buffer)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = (const void *) &SCB_RX_FIFO_RD(UART_HW),
+        .dst          = g_uartRxData[buffer],
+        .count        = UART_RX_DMA_BUFFER_SIZE,
+        .width        = CY_DMAC_WORD_BYTE,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = true,
+        .interrupt    = true
+    };
+
+    (void) dma_chain_config(UART_RX_DMA_CHANNEL, g_uartRxDescriptors[buffer], &segment);
+    g_uartRxBuffers[buffer].armed = true;
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_close
+*********************************************************************************
+* Summary:
+* Hands the active buffer to the application and continues in the other
+* buffer, or stops the channel when the other buffer is not free. Called with
+* interrupts masked or from the DMAC interrupt.
+*
+* Parameters:
+*  length: Number of bytes in the active buffer
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void uart_rx_dma_close(uint32_t length)
+{
+    uint32_t buffer = g_uartRxActive;
+
+    g_uartRxBuffers[buffer].armed = false;
+    g_uartRxBuffers[buffer].length = length;
+    g_uartRxBuffers[buffer].ready = true;
+    event_trace_record(EVENT_TRACE_UART_RX, length);
+
+    buffer ^= 1UL;
+    g_uartRxActive = buffer;
+    g_uartRxLastIndex = 0UL;
+
+    if (g_uartRxBuffers[buffer].armed)
+    {
+        dma_chain_start(UART_RX_DMA_CHANNEL, g_uartRxDescriptors[buffer]);
+        Cy_DMAC_Channel_Enable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+    }
+    else
+    {
+        Cy_DMAC_Channel_Disable(USER_DMA_HW, UART_RX_DMA_CHANNEL);
+        g_uartRxStalled = true;
+        g_uartRxStats.stalls++;
+    }
+}
+
+/********************************************************************************
+* Function Name: uart_rx_dma_callback
+*********************************************************************************
+* Summary:
+* Descriptor completion callback: the active buffer is full.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void uart_rx_dma_callback(uint32_t channel)
+{
+    CY_UNUSED_PARAMETER(channel);
+
+    g_uartRxStats.fullFrames++;
+    uart_rx_dma_close(UART_RX_DMA_BUFFER_SIZE);
+}
+
+/* [] END OF FILE */
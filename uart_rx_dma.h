@@ -0,0 +1,126 @@
+/******************************************************************************
+* File Name:   uart_rx_dma.h
+*
+* Description: Public interface of the DMA-based UART receiver. Received data is
+*              moved by a DMAC channel into alternating PING/PONG buffers that are
+*              closed on RX idle or when full.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef UART_RX_DMA_H
+#define UART_RX_DMA_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_chain.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channel of the receiver */
+#ifndef UART_RX_DMA_CHANNEL
+#define UART_RX_DMA_CHANNEL             1UL
+#endif
+
+/* Channel priority. RX must win against bulk transfers to avoid FIFO overruns. */
+#ifndef UART_RX_DMA_PRIORITY
+#define UART_RX_DMA_PRIORITY            0UL
+#endif
+
+/* Trigger multiplexer input of the UART SCB RX request and the output to the
+ * receiver channel. The input follows the SCB of UART_HW. */
+#ifndef UART_RX_DMA_TRIGGER_IN
+#define UART_RX_DMA_TRIGGER_IN          DMA_CHAIN_SCB_RX_TRIGGER(UART_HW)
+#endif
+
+#ifndef UART_RX_DMA_TRIGGER_OUT
+#define UART_RX_DMA_TRIGGER_OUT         TRIG0_OUT_CPUSS_DMAC_TR_IN1
+#endif
+
+/* Size of each receive buffer. A full buffer closes a frame. */
+#ifndef UART_RX_DMA_BUFFER_SIZE
+#define UART_RX_DMA_BUFFER_SIZE         64UL
+#endif
+
+/* Idle time that closes a frame, in character times (10 bits at 8N1) */
+#ifndef UART_RX_DMA_IDLE_CHARS
+#define UART_RX_DMA_IDLE_CHARS          2UL
+#endif
+
+/* Number of receive buffers */
+#define UART_RX_DMA_BUFFERS             2UL
+
+/*******************************************************************************
+* Data Types
+********************************************************************************/
+
+/* Receiver statistics */
+typedef struct
+{
+    uint32_t frames;                    /* Frames delivered */
+    uint32_t bytes;                     /* Bytes delivered */
+    uint32_t idleFrames;                /* Frames closed by RX idle */
+    uint32_t fullFrames;                /* Frames closed by a full buffer */
+    uint32_t stalls;                    /* No free buffer when a frame closed */
+    uint32_t fifoOverruns;              /* RX FIFO overflows (data lost) */
+} uart_rx_dma_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void uart_rx_dma_init(uint32_t baudRate);
+void uart_rx_dma_suspend(void);
+void uart_rx_dma_resume(uint32_t baudRate);
+void uart_rx_dma_poll(void);
+const uint8_t *uart_rx_dma_get_frame(uint32_t *length);
+void uart_rx_dma_release(void);
+void uart_rx_dma_get_stats(uart_rx_dma_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_RX_DMA_H */
+
+/* [] END OF FILE */
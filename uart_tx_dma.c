@@ -0,0 +1,294 @@
+/******************************************************************************
+* File Name:   uart_tx_dma.c
+*
+* Description: This file contains the DMA-based UART transmitter. PING moves the
+*              data into the TX FIFO, one byte per SCB request. PONG then writes
+*              zero to the TX FIFO control register, which sets the trigger level
+*              to zero and stops the requests, so the channel stays enabled and
+*              idles without a CPU intervention between transfers.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "uart_tx_dma.h"
+#include "dma_chain.h"
+#include "cycle_count.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* Value written to the TX FIFO control register to stop the requests */
+static const uint32_t g_uartTxFifoStop = 0UL;
+
+/* A transfer is in progress */
+static volatile bool g_uartTxBusy = false;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+static void uart_tx_dma_arm_stop(void);
+static void uart_tx_dma_recover(void);
+static void uart_tx_dma_callback(uint32_t channel);
+
+/********************************************************************************
+* Function Name: uart_tx_dma_init
+*********************************************************************************
+* Summary:
+* Routes the UART TX FIFO request to the transmitter channel and enables the
+* channel. UART_HW must be initialized and the DMAC enabled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+void uart_tx_dma_init(void)
+{
+    const cy_stc_dmac_channel_config_t channelConfig =
+    {
+        .descriptor = CY_DMAC_DESCRIPTOR_PING,
+        .priority   = UART_TX_DMA_PRIORITY,
+        .enable     = false
+    };
+
+    g_uartTxBusy = false;
+
+    /* No requests until a transfer is started */
+    Cy_SCB_SetTxFifoLevel(UART_HW, 0UL);
+
+    (void) Cy_DMAC_Channel_Init(USER_DMA_HW, UART_TX_DMA_CHANNEL, &channelConfig);
+    dma_chain_register_callback(UART_TX_DMA_CHANNEL, uart_tx_dma_callback);
+    dma_chain_connect(UART_TX_DMA_CHANNEL, UART_TX_DMA_TRIGGER_IN, UART_TX_DMA_TRIGGER_OUT);
+
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, UART_TX_DMA_CHANNEL);
+}
+
+/********************************************************************************
+* Function Name: uart_tx_dma_send
+*********************************************************************************
+* Summary:
+* Starts the transfer of a buffer to the TX FIFO. The buffer must stay valid
+* until the transfer is complete.
+*
+* Parameters:
+*  data: Data to send
+*  size: Number of bytes (1 to UART_TX_DMA_MAX_SIZE)
+*
+* Return:
+*  bool: true if the transfer was started, false if a transfer is in progress
+*        or the size is out of range
+*
+********************************************************************************/
+bool uart_tx_dma_send(const void *data, uint32_t size)
+{
+    const dma_chain_segment_t segment =
+    {
+        .src          = data,
+        .dst          = (void *) &SCB_TX_FIFO_WR(UART_HW),
+        .count        = size,
+        .width        = CY_DMAC_BYTE_WORD,
+        .triggerType  = CY_DMAC_SINGLE_ELEMENT,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = true,
+        .dstIncrement = false,
+        .interrupt    = false
+    };
+
+    if (g_uartTxBusy || (0UL == size) || (size > UART_TX_DMA_MAX_SIZE))
+    {
+        return false;
+    }
+
+    g_uartTxBusy = true;
+    event_trace_record(EVENT_TRACE_UART_TX, size);
+
+    /* Both descriptors are invalidated on completion, so both are rewritten */
+    (void) dma_chain_config(UART_TX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING, &segment);
+    uart_tx_dma_arm_stop();
+    dma_chain_start(UART_TX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PING);
+
+    Cy_SCB_SetTxFifoLevel(UART_HW, UART_TX_DMA_FIFO_LEVEL);
+
+    return true;
+}
+
+/********************************************************************************
+* Function Name: uart_tx_dma_is_busy
+*********************************************************************************
+* Summary:
+* Reports whether a transfer is in progress. A completed transfer may still
+* have up to a FIFO of data to shift out.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true while a transfer is in progress
+*
+********************************************************************************/
+bool uart_tx_dma_is_busy(void)
+{
+    return g_uartTxBusy;
+}
+
+/********************************************************************************
+* Function Name: uart_tx_dma_wait
+*********************************************************************************
+* Summary:
+* Waits until the transfer in progress, if any, is complete. The deadline
+* restarts whenever the channel moves a byte, so long transfers are not cut
+* short. A transfer that stalls for UART_TX_DMA_STALL_MS is abandoned: the
+* channel is reset and the transmitter is ready for the next transfer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the transfer completed, false if it was abandoned
+*
+********************************************************************************/
+bool uart_tx_dma_wait(void)
+{
+    uint32_t timeout = CYCLE_COUNT_MS_TO_CYCLES(UART_TX_DMA_STALL_MS);
+    uint32_t start = cycle_count_now();
+    uint32_t index = dma_chain_get_index(UART_TX_DMA_CHANNEL);
+    uint32_t current;
+    bool complete = true;
+
+    while (g_uartTxBusy)
+    {
+        current = dma_chain_get_index(UART_TX_DMA_CHANNEL);
+        if (current != index)
+        {
+            index = current;
+            start = cycle_count_now();
+        }
+        else if (cycle_count_expired(start, timeout))
+        {
+            uart_tx_dma_recover();
+            complete = false;
+        }
+        else
+        {
+            /* Still within the deadline */
+        }
+    }
+
+    return complete;
+}
+
+/********************************************************************************
+* Function Name: uart_tx_dma_recover
+*********************************************************************************
+* Summary:
+* Abandons a stalled transfer: stops the SCB requests, resets the channel and
+* enables it again. The next uart_tx_dma_send() rewrites both descriptors.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void uart_tx_dma_recover(void)
+{
+    Cy_SCB_SetTxFifoLevel(UART_HW, 0UL);
+    dma_chain_recover(UART_TX_DMA_CHANNEL);
+    Cy_DMAC_Channel_Enable(USER_DMA_HW, UART_TX_DMA_CHANNEL);
+
+    g_uartTxBusy = false;
+}
+
+/********************************************************************************
+* Function Name: uart_tx_dma_arm_stop
+*********************************************************************************
+* Summary:
+* Configures PONG to set the TX FIFO trigger level to zero. It runs on the
+* request that follows the last byte and interrupts on completion.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void uart_tx_dma_arm_stop(void)
+{
+    const dma_chain_segment_t stop =
+    {
+        .src          = &g_uartTxFifoStop,
+        .dst          = (void *) &SCB_TX_FIFO_CTRL(UART_HW),
+        .count        = 1UL,
+        .width        = CY_DMAC_WORD_WORD,
+        .triggerType  = CY_DMAC_SINGLE_DESCR,
+        .retrigger    = CY_DMAC_RETRIG_4CYC,
+        .srcIncrement = false,
+        .dstIncrement = false,
+        .interrupt    = true
+    };
+
+    (void) dma_chain_config(UART_TX_DMA_CHANNEL, CY_DMAC_DESCRIPTOR_PONG, &stop);
+}
+
+/********************************************************************************
+* Function Name: uart_tx_dma_callback
+*********************************************************************************
+* Summary:
+* Stop descriptor completion callback: all data is in the TX FIFO.
+*
+* Parameters:
+*  channel: DMAC channel number
+*
+* Return:
+*  void
+*
+********************************************************************************/
+static void uart_tx_dma_callback(uint32_t channel)
+{
+    CY_UNUSED_PARAMETER(channel);
+
+    g_uartTxBusy = false;
+}
+
+/* [] END OF FILE */
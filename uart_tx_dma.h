@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   uart_tx_dma.h
+*
+* Description: Public interface of the DMA-based UART transmitter.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+ * (c) 2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef UART_TX_DMA_H
+#define UART_TX_DMA_H
+
+/*******************************************************************************
+ * Include Header files
+ *******************************************************************************/
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "dma_chain.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+
+/* DMAC channel of the transmitter */
+#ifndef UART_TX_DMA_CHANNEL
+#define UART_TX_DMA_CHANNEL             2UL
+#endif
+
+/* Channel priority */
+#ifndef UART_TX_DMA_PRIORITY
+#define UART_TX_DMA_PRIORITY            1UL
+#endif
+
+/* Trigger multiplexer input of the UART SCB TX request and the output to the
+ * transmitter channel. The input follows the SCB of UART_HW. */
+#ifndef UART_TX_DMA_TRIGGER_IN
+#define UART_TX_DMA_TRIGGER_IN          DMA_CHAIN_SCB_TX_TRIGGER(UART_HW)
+#endif
+
+#ifndef UART_TX_DMA_TRIGGER_OUT
+#define UART_TX_DMA_TRIGGER_OUT         TRIG0_OUT_CPUSS_DMAC_TR_IN2
+#endif
+
+/* The SCB requests data while the TX FIFO holds fewer entries than this */
+#ifndef UART_TX_DMA_FIFO_LEVEL
+#define UART_TX_DMA_FIFO_LEVEL          4UL
+#endif
+
+/* uart_tx_dma_wait() gives up when the channel moves no byte for this long.
+ * One character takes about 1 ms at 9600 baud. */
+#ifndef UART_TX_DMA_STALL_MS
+#define UART_TX_DMA_STALL_MS            20UL
+#endif
+
+/* Largest transfer of one descriptor, in bytes */
+#define UART_TX_DMA_MAX_SIZE            65536UL
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+void uart_tx_dma_init(void);
+bool uart_tx_dma_send(const void *data, uint32_t size);
+bool uart_tx_dma_is_busy(void);
+bool uart_tx_dma_wait(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UART_TX_DMA_H */
+
+/* [] END OF FILE */